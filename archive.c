@@ -0,0 +1,653 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "utils.h"
+#include "frame.h"
+#include "objfile.h"
+
+/*
+ * An archive packs assembled modules ('.obj', '.ent' and '.ext' files) into a single file:
+ *   ARCHIVE_MAGIC
+ *   header: symbol capacity, symbol count, member capacity, member count, dead bytes
+ *   member table: memberCapacity fixed width records (name, offset, length)
+ *   symbol directory: symbolCapacity fixed width records (name, member index), sorted by name
+ *   members: every member is a run of frames tagged by extension, appended at the end
+ * All the records are fixed width text, so the directory can be binary searched straight from an mmap.
+ * Replacing a member appends its new version and only rewrites the tables at the front; the old
+ * version becomes dead bytes until the archive grows past its capacities or is compacted.
+ */
+#define ARCHIVE_MAGIC "!<asmlib>\n"
+#define MAGIC_LENGTH 10
+#define HEADER_LENGTH 55 /* five numbers of 10 digits, separated and ended by a single character */
+#define HEADER_NUMBERS 5
+#define NUMBER_FIELD_LENGTH 10 /* the numbers of the header and the records are written with 10 digits */
+#define MAX_MEMBER_NAME_LENGTH 63
+#define MEMBER_RECORD_LENGTH (MAX_MEMBER_NAME_LENGTH + 23)
+#define SYMBOL_RECORD_LENGTH (MAX_LABEL_LENGTH + 12)
+#define INITIAL_MEMBER_CAPACITY 64
+#define INITIAL_SYMBOL_CAPACITY 512
+#define MAX_PATH_LENGTH 1024
+#define COPY_CHUNK_SIZE 65536
+#define NUM_OF_MEMBER_EXTENSIONS 3
+
+/* A member of the archive: the files of a single module */
+typedef struct archive_member {
+    char name[MAX_MEMBER_NAME_LENGTH+1]; /* adding one extra space for NULL ending */
+    long offset; /* where its frames start in the archive */
+    long length; /* bytes of frames */
+} archive_member;
+
+/* An entry of the symbol directory: an '.entry' label and the member that defines it */
+typedef struct archive_symbol {
+    char name[MAX_LABEL_LENGTH+1]; /* adding one extra space for NULL ending */
+    int member;
+} archive_symbol;
+
+/* An archive read into memory, except for the contents of its members */
+typedef struct archive_t {
+    char *path;
+    int symbolCapacity;
+    int symbolCount;
+    int memberCapacity;
+    int memberCount;
+    long deadBytes; /* bytes of replaced members that are still in the file */
+    archive_member *members;
+    archive_symbol *symbols;
+} archive_t;
+
+static char *memberExtensions[NUM_OF_MEMBER_EXTENSIONS] = {".obj", ".ent", ".ext"};
+
+/**
+ * Returns the size of the tables at the front of an archive.
+ * @param archive The archive.
+ * @return The offset of the first member.
+ */
+static long frontLength (archive_t *archive) {
+    return MAGIC_LENGTH + HEADER_LENGTH + (long) archive->memberCapacity * MEMBER_RECORD_LENGTH +
+           (long) archive->symbolCapacity * SYMBOL_RECORD_LENGTH;
+}
+
+/**
+ * Allocates the tables of an archive.
+ * @param archive The archive, whose capacities are set.
+ * @return TRUE if successful, FALSE if out of memory.
+ */
+static boolean allocateTables (archive_t *archive) {
+    archive->members = calloc(archive->memberCapacity, sizeof(archive_member));
+    archive->symbols = calloc(archive->symbolCapacity, sizeof(archive_symbol));
+    return (archive->members != NULL && archive->symbols != NULL);
+}
+
+/**
+ * Frees the tables of an archive.
+ * @param archive The archive.
+ */
+static void freeTables (archive_t *archive) {
+    free(archive->members);
+    free(archive->symbols);
+    archive->members = NULL;
+    archive->symbols = NULL;
+}
+
+/**
+ * Reads the tables at the front of an archive.
+ * @param file The archive file.
+ * @param archive Receives the tables.
+ * @return TRUE if the file is a valid archive, FALSE otherwise.
+ */
+static boolean readTables (FILE *file, archive_t *archive) {
+    char magic[MAGIC_LENGTH + 1];
+    int i;
+
+    if (fread(magic, 1, MAGIC_LENGTH, file) != MAGIC_LENGTH || memcmp(magic, ARCHIVE_MAGIC, MAGIC_LENGTH) != 0)
+        return FALSE;
+    if (fscanf(file, "%d %d %d %d %ld", &archive->symbolCapacity, &archive->symbolCount,
+               &archive->memberCapacity, &archive->memberCount, &archive->deadBytes) != 5 ||
+        archive->symbolCount > archive->symbolCapacity || archive->memberCount > archive->memberCapacity)
+        return FALSE;
+    if (allocateTables(archive) == FALSE)
+        return FALSE;
+    for (i = 0; i < archive->memberCount; i++) {
+        fseek(file, MAGIC_LENGTH + HEADER_LENGTH + (long) i * MEMBER_RECORD_LENGTH, SEEK_SET);
+        if (fscanf(file, "%63s %ld %ld", archive->members[i].name, &archive->members[i].offset,
+                   &archive->members[i].length) != 3)
+            return FALSE;
+    }
+    for (i = 0; i < archive->symbolCount; i++) {
+        fseek(file, MAGIC_LENGTH + HEADER_LENGTH + (long) archive->memberCapacity * MEMBER_RECORD_LENGTH +
+                    (long) i * SYMBOL_RECORD_LENGTH, SEEK_SET);
+        if (fscanf(file, "%31s %d", archive->symbols[i].name, &archive->symbols[i].member) != 2)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * Writes the tables at the front of an archive, padding the unused records with spaces.
+ * @param file The archive file.
+ * @param archive The tables to write.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean writeTables (FILE *file, archive_t *archive) {
+    int i;
+
+    fseek(file, 0, SEEK_SET);
+    fputs(ARCHIVE_MAGIC, file);
+    fprintf(file, "%10d %10d %10d %10d %10ld\n", archive->symbolCapacity, archive->symbolCount,
+            archive->memberCapacity, archive->memberCount, archive->deadBytes);
+    for (i = 0; i < archive->memberCapacity; i++) {
+        if (i < archive->memberCount)
+            fprintf(file, "%-63s %10ld %10ld\n", archive->members[i].name, archive->members[i].offset,
+                    archive->members[i].length);
+        else
+            fprintf(file, "%*s\n", MEMBER_RECORD_LENGTH - 1, "");
+    }
+    for (i = 0; i < archive->symbolCapacity; i++) {
+        if (i < archive->symbolCount)
+            fprintf(file, "%-31s %10d\n", archive->symbols[i].name, archive->symbols[i].member);
+        else
+            fprintf(file, "%*s\n", SYMBOL_RECORD_LENGTH - 1, "");
+    }
+    return (fflush(file) == 0 && ferror(file) == 0);
+}
+
+/**
+ * Compares two symbols by name, for sorting the directory.
+ * @param a The first symbol.
+ * @param b The second symbol.
+ * @return Negative, zero or positive like strcmp.
+ */
+static int compareSymbols (const void *a, const void *b) {
+    return strcmp(((const archive_symbol *) a)->name, ((const archive_symbol *) b)->name);
+}
+
+/**
+ * Finds a symbol in the sorted directory of an archive read into memory.
+ * @param archive The archive.
+ * @param name The symbol name.
+ * @return The symbol, or NULL if it is not in the directory.
+ */
+static archive_symbol *findSymbol (archive_t *archive, char *name) {
+    archive_symbol key;
+    strncpy(key.name, name, MAX_LABEL_LENGTH);
+    key.name[MAX_LABEL_LENGTH] = '\0';
+    return bsearch(&key, archive->symbols, archive->symbolCount, sizeof(archive_symbol), compareSymbols);
+}
+
+/**
+ * Adds symbols to the sorted directory of an archive that has room for them, by merging from the end.
+ * @param archive The archive.
+ * @param symbols The symbols to add, which are sorted in place.
+ * @param count The number of symbols to add.
+ */
+static void insertSymbols (archive_t *archive, archive_symbol symbols[], int count) {
+    int i = archive->symbolCount - 1, j = count - 1, k = archive->symbolCount + count - 1;
+
+    qsort(symbols, count, sizeof(archive_symbol), compareSymbols);
+    while (j >= 0) {
+        if (i >= 0 && strcmp(archive->symbols[i].name, symbols[j].name) > 0)
+            archive->symbols[k--] = archive->symbols[i--];
+        else
+            archive->symbols[k--] = symbols[j--];
+    }
+    archive->symbolCount += count;
+}
+
+/**
+ * Copies bytes from one file into another.
+ * @param from The file to read, at the position to copy from.
+ * @param to The file to write, at the position to copy to.
+ * @param length The number of bytes to copy.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean copyBytes (FILE *from, FILE *to, long length) {
+    char buffer[COPY_CHUNK_SIZE];
+    size_t chunk;
+    while (length > 0) {
+        chunk = (length < COPY_CHUNK_SIZE) ? (size_t) length : COPY_CHUNK_SIZE;
+        if (fread(buffer, 1, chunk, from) != chunk || fwrite(buffer, 1, chunk, to) != chunk)
+            return FALSE;
+        length -= chunk;
+    }
+    return TRUE;
+}
+
+/**
+ * Rewrites an archive with larger capacities, copying only its live members.
+ * @param file The archive file, which is replaced and closed.
+ * @param archive The archive, whose offsets are updated.
+ * @param members The number of members it needs room for.
+ * @param symbols The number of symbols it needs room for.
+ * @param pending A member that was appended but is not in the member table yet, or NULL.
+ * @return The rewritten archive file, or NULL on failure.
+ */
+static FILE *rewriteArchive (FILE *file, archive_t *archive, int members, int symbols, archive_member *pending) {
+    archive_member *member;
+    char tmpPath[MAX_PATH_LENGTH + 8];
+    archive_member *biggerMembers;
+    archive_symbol *biggerSymbols;
+    FILE *rewritten;
+    int i;
+
+    while (archive->memberCapacity < members)
+        archive->memberCapacity *= 2;
+    while (archive->symbolCapacity < symbols)
+        archive->symbolCapacity *= 2;
+    biggerMembers = realloc(archive->members, archive->memberCapacity * sizeof(archive_member));
+    if (biggerMembers != NULL)
+        archive->members = biggerMembers;
+    biggerSymbols = realloc(archive->symbols, archive->symbolCapacity * sizeof(archive_symbol));
+    if (biggerSymbols != NULL)
+        archive->symbols = biggerSymbols;
+    if (biggerMembers == NULL || biggerSymbols == NULL) {
+        fclose(file);
+        return NULL;
+    }
+
+    sprintf(tmpPath, "%.1000s.tmp", archive->path);
+    rewritten = fopen(tmpPath, "w+b");
+    if (rewritten == NULL) {
+        fclose(file);
+        return NULL;
+    }
+    fseek(rewritten, frontLength(archive), SEEK_SET);
+    for (i = 0; i <= archive->memberCount; i++) {
+        member = (i < archive->memberCount) ? &archive->members[i] : pending;
+        if (member == NULL)
+            break;
+        fseek(file, member->offset, SEEK_SET);
+        member->offset = ftell(rewritten);
+        if (copyBytes(file, rewritten, member->length) == FALSE) {
+            fclose(file);
+            fclose(rewritten);
+            remove(tmpPath);
+            return NULL;
+        }
+    }
+    archive->deadBytes = 0;
+    fclose(file);
+    if (writeTables(rewritten, archive) == FALSE || rename(tmpPath, archive->path) != 0) {
+        fclose(rewritten);
+        remove(tmpPath);
+        return NULL;
+    }
+    return rewritten;
+}
+
+/**
+ * Opens an archive for updating, creating an empty one if it does not exist.
+ * @param path The path of the archive.
+ * @param archive Receives the tables.
+ * @return The archive file, or NULL on failure.
+ */
+static FILE *openArchive (char *path, archive_t *archive) {
+    FILE *file = fopen(path, "r+b");
+
+    archive->path = path;
+    archive->members = NULL;
+    archive->symbols = NULL;
+    if (file != NULL) {
+        if (readTables(file, archive) == FALSE) {
+            fprintf(stderr, "archive: '%s' is not a valid archive\n", path);
+            fclose(file);
+            freeTables(archive);
+            return NULL;
+        }
+        return file;
+    }
+
+    file = fopen(path, "w+b");
+    if (file == NULL)
+        return NULL;
+    archive->memberCapacity = INITIAL_MEMBER_CAPACITY;
+    archive->symbolCapacity = INITIAL_SYMBOL_CAPACITY;
+    archive->memberCount = archive->symbolCount = 0;
+    archive->deadBytes = 0;
+    if (allocateTables(archive) == FALSE || writeTables(file, archive) == FALSE) {
+        fclose(file);
+        freeTables(archive);
+        return NULL;
+    }
+    return file;
+}
+
+/**
+ * Returns the name of a module without its directories.
+ * @param path The base name of the module's files.
+ * @return The member name.
+ */
+static char *memberName (char *path) {
+    char *slash = strrchr(path, '/');
+    return (slash != NULL) ? slash + 1 : path;
+}
+
+/**
+ * Appends the files of a module to the end of the archive as a member, and collects its '.entry' labels.
+ * @param file The archive file.
+ * @param path The base name of the module's files.
+ * @param member Receives the offset and length of the member.
+ * @param symbols Receives the names of the '.entry' labels, MAX_MEMORY_SPACE at most.
+ * @param symbolCount Receives the number of '.entry' labels.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean appendMember (FILE *file, char *path, archive_member *member,
+                             archive_symbol symbols[], int *symbolCount) {
+    char fileName[MAX_PATH_LENGTH + 8];
+    int i, address;
+    long length;
+    char *data;
+    FILE *input;
+    boolean success = TRUE;
+
+    *symbolCount = 0;
+    fseek(file, 0, SEEK_END);
+    member->offset = ftell(file);
+    for (i = 0; i < NUM_OF_MEMBER_EXTENSIONS && success == TRUE; i++) {
+        sprintf(fileName, "%.1000s%s", path, memberExtensions[i]);
+        input = fopen(fileName, "rb");
+        if (input == NULL) {
+            if (i == 0) { /* the '.obj' file is the only one every module has */
+                fprintf(stderr, "archive: cannot read '%s'\n", fileName);
+                success = FALSE;
+            }
+            continue;
+        }
+        data = readFileContents(input, &length);
+        success = (data != NULL && writeFrame(file, memberExtensions[i], data, length) == TRUE);
+        free(data);
+        if (strcmp(memberExtensions[i], ".ent") == 0) {
+            rewind(input);
+            while (*symbolCount < MAX_MEMORY_SPACE && readSymbolLine(input, symbols[*symbolCount].name, &address) == TRUE)
+                (*symbolCount)++;
+        }
+        fclose(input);
+    }
+    member->length = ftell(file) - member->offset;
+    return success;
+}
+
+/**
+ * Adds modules to an archive, replacing the members that have the same name.
+ * Only the new members are written, at the end, and then the tables at the front.
+ * @param path The path of the archive.
+ * @param modules The base names of the modules' files.
+ * @param count The number of modules.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean addMembers (char *path, char *modules[], int count) {
+    static archive_symbol newSymbols[MAX_MEMORY_SPACE];
+    archive_t archive;
+    archive_member member;
+    archive_symbol *existing;
+    int i, j, index, newCount, kept;
+    boolean success = TRUE;
+    FILE *file = openArchive(path, &archive);
+
+    if (file == NULL) {
+        fprintf(stderr, "archive: cannot open '%s'\n", path);
+        return FALSE;
+    }
+    for (i = 0; i < count && success == TRUE; i++) {
+        strncpy(member.name, memberName(modules[i]), MAX_MEMBER_NAME_LENGTH);
+        member.name[MAX_MEMBER_NAME_LENGTH] = '\0';
+        if (appendMember(file, modules[i], &member, newSymbols, &newCount) == FALSE) {
+            success = FALSE;
+            break;
+        }
+
+        for (index = 0; index < archive.memberCount; index++)
+            if (strcmp(archive.members[index].name, member.name) == 0)
+                break;
+        if (index < archive.memberCount) { /* replace: drop the symbols of the old version */
+            archive.deadBytes += archive.members[index].length;
+            archive.members[index] = member;
+            for (j = 0, kept = 0; j < archive.symbolCount; j++)
+                if (archive.symbols[j].member != index)
+                    archive.symbols[kept++] = archive.symbols[j];
+            archive.symbolCount = kept;
+        }
+
+        /* keep the first definition of every symbol */
+        for (j = 0, kept = 0; j < newCount; j++) {
+            existing = findSymbol(&archive, newSymbols[j].name);
+            if (existing != NULL) {
+                fprintf(stderr, "archive: symbol '%s' of '%s' is already defined by '%s', keeping the first\n",
+                        newSymbols[j].name, member.name, archive.members[existing->member].name);
+                continue;
+            }
+            newSymbols[j].member = index;
+            newSymbols[kept++] = newSymbols[j];
+        }
+
+        /* make room in the tables, rewriting the archive only when they are full */
+        if (index == archive.memberCapacity || archive.symbolCount + kept > archive.symbolCapacity) {
+            file = rewriteArchive(file, &archive, index + 1, archive.symbolCount + kept,
+                                  (index == archive.memberCount) ? &member : NULL);
+            if (file == NULL) {
+                fprintf(stderr, "archive: cannot rewrite '%s'\n", path);
+                freeTables(&archive);
+                return FALSE;
+            }
+        }
+        if (index == archive.memberCount)
+            archive.members[archive.memberCount++] = member;
+        insertSymbols(&archive, newSymbols, kept);
+    }
+    if (writeTables(file, &archive) == FALSE)
+        success = FALSE;
+    if (fclose(file) != 0)
+        success = FALSE;
+    freeTables(&archive);
+    return success;
+}
+
+/**
+ * Rewrites an archive without the dead bytes of replaced members.
+ * @param path The path of the archive.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean compactArchive (char *path) {
+    archive_t archive;
+    FILE *file = openArchive(path, &archive);
+    if (file == NULL)
+        return FALSE;
+    file = rewriteArchive(file, &archive, archive.memberCount, archive.symbolCount, NULL);
+    freeTables(&archive);
+    return (file != NULL && fclose(file) == 0);
+}
+
+/**
+ * Lists the members of an archive and the symbols they define.
+ * @param path The path of the archive.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean listArchive (char *path) {
+    archive_t archive;
+    int i, j;
+    FILE *file = fopen(path, "rb");
+
+    archive.members = NULL;
+    archive.symbols = NULL;
+    if (file == NULL || readTables(file, &archive) == FALSE) {
+        fprintf(stderr, "archive: cannot read '%s'\n", path);
+        if (file != NULL)
+            fclose(file);
+        freeTables(&archive);
+        return FALSE;
+    }
+    for (i = 0; i < archive.memberCount; i++) {
+        printf("%s\t%ld bytes\n", archive.members[i].name, archive.members[i].length);
+        for (j = 0; j < archive.symbolCount; j++)
+            if (archive.symbols[j].member == i)
+                printf("\t%s\n", archive.symbols[j].name);
+    }
+    printf("%d members, %d symbols, %ld dead bytes\n", archive.memberCount, archive.symbolCount, archive.deadBytes);
+    fclose(file);
+    freeTables(&archive);
+    return TRUE;
+}
+
+/**
+ * Finds the member that defines a symbol with a binary search of the directory, mapped straight from the file.
+ * @param path The path of the archive.
+ * @param symbol The symbol name.
+ * @return TRUE if the symbol was found, FALSE otherwise.
+ */
+static boolean findMember (char *path, char *symbol) {
+    char key[SYMBOL_RECORD_LENGTH], header[HEADER_LENGTH + 1], field[NUMBER_FIELD_LENGTH + 1];
+    char *map, *record = NULL, *directory, *next, *end;
+    long numbers[HEADER_NUMBERS], symbolCapacity, symbolCount, memberCapacity, memberCount, member;
+    int i, low, high, middle, comparison;
+    struct stat status;
+    boolean found = FALSE;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &status) != 0 || status.st_size < MAGIC_LENGTH + HEADER_LENGTH) {
+        fprintf(stderr, "archive: cannot read '%s'\n", path);
+        if (fd >= 0)
+            close(fd);
+        return FALSE;
+    }
+    map = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return FALSE;
+
+    /* the mapping has no NULL ending, so the numbers are parsed from copies of their fixed width fields */
+    memcpy(header, map + MAGIC_LENGTH, HEADER_LENGTH);
+    header[HEADER_LENGTH] = '\0';
+    for (i = 0, next = header; i < HEADER_NUMBERS; i++, next = end) {
+        numbers[i] = strtol(next, &end, 10);
+        if (end == next)
+            break;
+    }
+    symbolCapacity = numbers[0];
+    symbolCount = numbers[1];
+    memberCapacity = numbers[2];
+    memberCount = numbers[3];
+    if (memcmp(map, ARCHIVE_MAGIC, MAGIC_LENGTH) != 0 || i < HEADER_NUMBERS ||
+        symbolCount < 0 || symbolCount > symbolCapacity || memberCount < 0 || memberCount > memberCapacity ||
+        MAGIC_LENGTH + HEADER_LENGTH + memberCapacity * MEMBER_RECORD_LENGTH +
+        symbolCapacity * SYMBOL_RECORD_LENGTH > status.st_size) {
+        fprintf(stderr, "archive: '%s' is not a valid archive\n", path);
+        munmap(map, status.st_size);
+        return FALSE;
+    }
+
+    /* the records are padded with spaces, which sort before every character of a label */
+    sprintf(key, "%-31.31s", symbol);
+    directory = map + MAGIC_LENGTH + HEADER_LENGTH + memberCapacity * MEMBER_RECORD_LENGTH;
+    low = 0;
+    high = symbolCount - 1;
+    while (low <= high && found == FALSE) {
+        middle = low + (high - low) / 2;
+        record = directory + (long) middle * SYMBOL_RECORD_LENGTH;
+        comparison = memcmp(key, record, MAX_LABEL_LENGTH);
+        if (comparison == 0)
+            found = TRUE;
+        else if (comparison < 0)
+            high = middle - 1;
+        else
+            low = middle + 1;
+    }
+    if (found == TRUE) {
+        /* the member number follows the name and a space */
+        memcpy(field, record + MAX_LABEL_LENGTH + 1, NUMBER_FIELD_LENGTH);
+        field[NUMBER_FIELD_LENGTH] = '\0';
+        member = strtol(field, &end, 10);
+        found = (end != field && member >= 0 && member < memberCount);
+    }
+    if (found == TRUE) {
+        record = map + MAGIC_LENGTH + HEADER_LENGTH + member * MEMBER_RECORD_LENGTH;
+        end = memchr(record, ' ', MAX_MEMBER_NAME_LENGTH);
+        printf("%.*s\n", (end != NULL) ? (int) (end - record) : MAX_MEMBER_NAME_LENGTH, record);
+    } else {
+        fprintf(stderr, "archive: symbol '%s' is not defined in '%s'\n", symbol, path);
+        found = FALSE;
+    }
+    munmap(map, status.st_size);
+    return found;
+}
+
+/**
+ * Extracts the files of members of an archive into the current directory.
+ * @param path The path of the archive.
+ * @param names The names of the members.
+ * @param count The number of members.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean extractMembers (char *path, char *names[], int count) {
+    char fileName[MAX_PATH_LENGTH + 8], tag[MAX_FRAME_TAG_LENGTH + 1];
+    archive_t archive;
+    int i, index;
+    long length, end;
+    char *data;
+    FILE *output, *file = fopen(path, "rb");
+    boolean success = TRUE;
+
+    archive.members = NULL;
+    archive.symbols = NULL;
+    if (file == NULL || readTables(file, &archive) == FALSE) {
+        fprintf(stderr, "archive: cannot read '%s'\n", path);
+        if (file != NULL)
+            fclose(file);
+        freeTables(&archive);
+        return FALSE;
+    }
+    for (i = 0; i < count; i++) {
+        for (index = 0; index < archive.memberCount; index++)
+            if (strcmp(archive.members[index].name, names[i]) == 0)
+                break;
+        if (index == archive.memberCount) {
+            fprintf(stderr, "archive: no member '%s' in '%s'\n", names[i], path);
+            success = FALSE;
+            continue;
+        }
+        fseek(file, archive.members[index].offset, SEEK_SET);
+        end = archive.members[index].offset + archive.members[index].length;
+        while (ftell(file) < end && readFrame(file, tag, &data, &length) == TRUE) {
+            sprintf(fileName, "%.1000s%s", names[i], tag);
+            output = fopen(fileName, "wb");
+            if (output == NULL || fwrite(data, 1, length, output) != (size_t) length)
+                success = FALSE;
+            if (output != NULL)
+                fclose(output);
+            free(data);
+        }
+    }
+    fclose(file);
+    freeTables(&archive);
+    return success;
+}
+
+int main (int argc, char *argv[]) {
+    boolean success;
+
+    if (argc >= 4 && strcmp(argv[1], "r") == 0)
+        success = addMembers(argv[2], argv + 3, argc - 3);
+    else if (argc == 3 && strcmp(argv[1], "t") == 0)
+        success = listArchive(argv[2]);
+    else if (argc == 4 && strcmp(argv[1], "f") == 0)
+        success = findMember(argv[2], argv[3]);
+    else if (argc >= 4 && strcmp(argv[1], "x") == 0)
+        success = extractMembers(argv[2], argv + 3, argc - 3);
+    else if (argc == 3 && strcmp(argv[1], "c") == 0)
+        success = compactArchive(argv[2]);
+    else {
+        fprintf(stderr, "usage: archive r <archive> <module>...   add or replace modules ('.obj', '.ent', '.ext')\n");
+        fprintf(stderr, "       archive t <archive>               list the members and their symbols\n");
+        fprintf(stderr, "       archive f <archive> <symbol>      print the member that defines a symbol\n");
+        fprintf(stderr, "       archive x <archive> <member>...   extract members into the current directory\n");
+        fprintf(stderr, "       archive c <archive>               drop the replaced versions of members\n");
+        return 1;
+    }
+    return success ? 0 : 1;
+}
@@ -0,0 +1,329 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "assemble.h"
+#include "preprocessor.h"
+#include "parser.h"
+#include "labels.h"
+#include "utils.h"
+#include "generateOutput.h"
+#include "print.h"
+#include "stats.h"
+#include "memory.h"
+#include "trace.h"
+#include "perfcounters.h"
+#include "optimizer.h"
+#include "incremental.h"
+
+/* set from '--check' and '--fail-fast' */
+boolean checkOnly = FALSE;
+fail_fast_t failFast = FAIL_FAST_NONE;
+
+/* the build cache is shared by the stages of '--pipeline' */
+static pthread_mutex_t cacheLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Lists the extensions of the output files written for a successfully assembled file.
+ * @param labels The label tables of the file.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param IC The instruction counter.
+ * @param extensions Receives the extensions (room for at least five).
+ * @return The number of extensions listed.
+ */
+static int listWrittenOutputs (labels_tables labels, machine_word codeImage[], int IC, char *extensions[]) {
+    int i, count = 0;
+    boolean external = FALSE, relocatable = FALSE;
+    extensions[count++] = ".am";
+    extensions[count++] = ".obj";
+
+    /* '.ext' is only created when an external label is actually used by the code, and '.rel' when an internal one is
+       or the base is not the default */
+    for (i = 0; i < IC; i++) {
+        if (codeImage[i].isLabel == TRUE && codeImage[i].word.immdt_drct_word.ARE == ARE_EXTERNAL)
+            external = TRUE;
+        else if (codeImage[i].isLabel == TRUE && codeImage[i].word.immdt_drct_word.ARE == ARE_RELOCATABLE)
+            relocatable = TRUE;
+    }
+    if (external == TRUE)
+        extensions[count++] = ".ext";
+    if (labels.exportal != NULL)
+        extensions[count++] = ".ent";
+    if (relocatable == TRUE || baseAddress != BASE_ADDRESS)
+        extensions[count++] = ".rel";
+    return count;
+}
+
+/**
+ * Marks the start of a phase of the current file for the statistics, the trace and the hardware counters.
+ * @param phase The phase that starts.
+ */
+static void beginPhase (phase_t phase) {
+    STATS_BEGIN(phase);
+    TRACE_BEGIN(phaseNames[phase], NULL);
+    if (perfEnabled == TRUE)
+        perfPhaseBegin(phase);
+}
+
+/**
+ * Marks the end of a phase of the current file for the statistics, the trace, the hardware counters and the memory report.
+ * @param phase The phase that ends.
+ */
+static void endPhase (phase_t phase) {
+    if (perfEnabled == TRUE)
+        perfPhaseEnd(phase);
+    STATS_END(phase);
+    TRACE_END(phaseNames[phase]);
+    if (memoryReportEnabled == TRUE)
+        sampleMemoryPhase(phase);
+}
+
+/**
+ * Preprocesses a single source file into its '.am' file, or restores all of its outputs from the build cache.
+ * @param fileName The base name of the file (without the '.as' extension).
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @param cacheKey Receives the cache key of the file, or an empty string if it is not cached.
+ * @return How far the file got.
+ */
+stage_result preprocessSource (char *fileName, cache_t *cache, char *optionsKey, char *cacheKey) {
+    boolean preprocessError, restored = FALSE;
+    FILE *fileAs, *fileAm;
+    long int file_offset;
+
+    fileAs = openFile(fileName, ".as", "r");
+    if (fileAs == NULL) {
+        printWarningGeneral("Skipping file ");
+        printMessage("'%s.as'.\n", fileName);
+        return STAGE_FAILED;
+    }
+
+    /* a cache hit restores every output without preprocessing or parsing the file */
+    cacheKey[0] = '\0';
+    if (cache != NULL) {
+        pthread_mutex_lock(&cacheLock);
+        restored = (computeCacheKey(fileAs, fileName, optionsKey, cacheKey) == TRUE &&
+                    restoreFromCache(cache, cacheKey, fileName) == TRUE);
+        pthread_mutex_unlock(&cacheLock);
+    }
+    if (restored == TRUE) {
+        printMessage("Restored file '%s' from cache\n", fileName);
+        fclose(fileAs);
+        return STAGE_RESTORED;
+    }
+    
+    fileAm = openFile(fileName, ".am", "w");
+    if (fileAm == NULL) {
+        printWarningGeneral("Skipping file ");
+        printMessage("'%s.as'.\n", fileName);
+        fclose(fileAs);
+        return STAGE_FAILED;
+    }
+    
+    /*preproccess files*/
+    fseek(fileAs, 0, SEEK_END);
+    file_offset = ftell(fileAs); 
+    rewind(fileAs);
+
+    printMessage("Preprocessing file: '%s'\n", fileName);
+    beginPhase(PHASE_PREPROCESS);
+    preprocessError = preprocessFile(fileAs, fileAm, 0, file_offset, fileName);
+    endPhase(PHASE_PREPROCESS);
+    fclose(fileAs);
+    fclose(fileAm);
+    if (preprocessError == TRUE) { /*preprocessor error occured */ 
+        printWarningGeneral("Skipping file ");
+        printMessage("'%s.as'.\n", fileName);
+        return STAGE_FAILED;
+    }
+            
+    printMessage("Finished preprocessing file: '%s'\n", fileName);
+    return STAGE_PREPROCESSED;
+}
+
+/**
+ * Parses the '.am' file of a preprocessed source file, resolves its labels and writes its output files.
+ * With '--check' it stops once the labels are checked.
+ * @param fileName The base name of the file (without the '.as' extension).
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param cacheKey The cache key of the file, or an empty string if it is not cached.
+ * @return TRUE if all the output files were written (or the file has no errors with '--check'), FALSE otherwise.
+ */
+boolean parseSource (char *fileName, cache_t *cache, char *cacheKey) {
+    int IC = 0, DC = 0, lineNumber = 1, saved;
+    boolean ERROR_FOUND = FALSE, outputWritten = FALSE;
+    FILE *fileAm;
+    machine_word *codeImage, *dataImage;
+    char line[MAX_LINE_LENGTH+1]; /* adding one extra space for NULL ending */
+    char *outputs[5];
+    labels_tables labels;
+    peephole_report report;
+    pool_report poolReport;
+    dead_report deadReport;
+    line_cache *lines;
+    labels.internal = NULL;
+    labels.external = NULL;
+    labels.exportal = NULL;
+    labels.pooled = NULL;
+    labels.kept = NULL;
+
+    /* the images are too big for the stack once MAX_MEMORY_SPACE is raised */
+    codeImage = allocateMemory(MAX_MEMORY_SPACE * sizeof(machine_word), MEMORY_IMAGES);
+    dataImage = allocateMemory(MAX_MEMORY_SPACE * sizeof(machine_word), MEMORY_IMAGES);
+    if (codeImage == NULL || dataImage == NULL) {
+        printErrorGeneral("Not enough memory for the code and data images\n");
+        freeMemory(codeImage, MEMORY_IMAGES);
+        freeMemory(dataImage, MEMORY_IMAGES);
+        return FALSE;
+    }
+
+    /*Reopening .am file to assemble it: */
+    fileAm = openFile(fileName, ".am", "r");
+    if (fileAm == NULL) {
+        printWarningGeneral("Skipping file ");
+        printMessage("'%s.as'.\n", fileName);
+        freeMemory(codeImage, MEMORY_IMAGES);
+        freeMemory(dataImage, MEMORY_IMAGES);
+        return FALSE;
+    }
+    
+    printMessage("Processing file: '%s'\n", fileName);
+    /*process the file line by line*/
+    beginPhase(PHASE_PARSE);
+    lines = (incrementalEnabled == TRUE) ? allocateMemory(sizeof(line_cache), MEMORY_SIDECARS) : NULL;
+    if (lines != NULL)
+        loadLineCache(lines, fileName);
+    while (fgets(line, sizeof(line), fileAm) != NULL) {
+        if (lines != NULL)
+            ERROR_FOUND |= (parseLineIncremental(lines, line, codeImage, dataImage, &labels, &IC, &DC, lineNumber) == FALSE);
+        else
+            ERROR_FOUND |= (parseLine(line, codeImage, dataImage, &labels, &IC, &DC, lineNumber) == FALSE);
+        lineNumber++;
+        STATS_COUNT(lines);
+        if (ERROR_FOUND == TRUE && failFast != FAIL_FAST_NONE)
+            break;
+    }
+    if (lines != NULL) {
+        printMessage("Reused %d of %d lines of file '%s'\n", lines->reused, lines->reused + lines->parsed, fileName);
+        if (saveLineCache(lines, fileName) == FALSE)
+            printWarningGeneral("Could not write the sidecar of the file\n");
+        freeLineCache(lines);
+        freeMemory(lines, MEMORY_SIDECARS);
+    }
+    endPhase(PHASE_PARSE);
+    STATS_ADD(words, IC + DC);
+    /*close file*/
+    fclose(fileAm);
+
+    /* after a parse error the labels are only half known, so with '--fail-fast' they are not checked */
+    if (ERROR_FOUND == FALSE || failFast == FAIL_FAST_NONE) {
+        beginPhase(PHASE_LABELS);
+        if (checkValidLabelsTables(labels) == FALSE) {
+            ERROR_FOUND = TRUE;
+        } else if (checkAllLabelsDefined(labels, codeImage, IC) == FALSE) {
+            ERROR_FOUND = TRUE;
+        }
+        endPhase(PHASE_LABELS);
+    }
+    if (ERROR_FOUND == TRUE) {
+        printErrorGeneral("Skipping file ");
+        printMessage("%s because it has at least one error in it! \n", fileName);
+        freeTables(labels);
+        freeMemory(codeImage, MEMORY_IMAGES);
+        freeMemory(dataImage, MEMORY_IMAGES);
+        return FALSE;
+    }
+    if (checkOnly == TRUE) {
+        freeTables(labels);
+        freeMemory(codeImage, MEMORY_IMAGES);
+        freeMemory(dataImage, MEMORY_IMAGES);
+        printMessage("Checked file '%s': no errors\n", fileName);
+        return TRUE;
+    }
+
+    if (optimizeEnabled == TRUE || poolEnabled == TRUE || deadStripEnabled == TRUE)
+        beginPhase(PHASE_OPTIMIZE);
+    if (deadStripEnabled == TRUE) {
+        printMessage("Removing unreachable code and data of file '%s'\n", fileName);
+        if (removeUnreachable(codeImage, dataImage, &IC, &DC, &labels, &deadReport) == TRUE)
+            printMessage("Removed %d labels of file '%s': %d code words and %d data words saved\n",
+                         deadReport.labels, fileName, deadReport.codeWords, deadReport.dataWords);
+        else
+            printWarningGeneral("Not enough memory to remove unreachable code, it is left as is\n");
+    }
+    if (optimizeEnabled == TRUE) {
+        saved = peepholeOptimize(codeImage, &IC, &labels, &report);
+        printMessage("Optimized file '%s': %d words saved (%d no-op moves, %d jumps to the next instruction, %d unreachable)\n",
+                     fileName, saved, report.noOpMoves, report.jumpsToNext, report.deadWords);
+    }
+    if (poolEnabled == TRUE) {
+        if (poolData(dataImage, &DC, &labels, &poolReport) == TRUE)
+            printMessage("Pooled data of file '%s': %d data words saved (%d labels share an identical copy)\n",
+                         fileName, poolReport.wordsSaved, poolReport.pooledLabels);
+        else
+            printWarningGeneral("Not enough memory to pool the data, it is left as is\n");
+    }
+    if (optimizeEnabled == TRUE || poolEnabled == TRUE || deadStripEnabled == TRUE)
+        endPhase(PHASE_OPTIMIZE);
+    
+    /*if no errors were found then creates the files */
+    if (baseAddress + IC + DC > MAX_ADDRESS + 1) {
+        printErrorGeneral("The code and data do not fit in memory at base ");
+        printMessage("%d (%d words), skipping file '%s'\n", baseAddress, IC + DC, fileName);
+    } else {
+        beginPhase(PHASE_RELOCATE);
+        outputWritten = updateAdressesAndWriteExtFile(fileName, labels, codeImage, IC);
+        endPhase(PHASE_RELOCATE);
+        if (outputWritten == FALSE)
+            printErrorGeneral("Updating addresses and writing .ext file failed\n");
+    }
+    if (outputWritten == TRUE) {
+        beginPhase(PHASE_WRITE);
+        if (writeObjFile(fileName, codeImage, dataImage, IC, DC) == FALSE) {
+            printErrorGeneral("Writing .obj file failed\n");
+            outputWritten = FALSE;
+        } else if (writeEntFile(fileName, labels) == FALSE) {
+            printErrorGeneral("Writing .ent file failed\n");
+            outputWritten = FALSE;
+        } else if (writeRelFile(fileName, codeImage, IC) == FALSE) {
+            printErrorGeneral("Writing .rel file failed\n");
+            outputWritten = FALSE;
+        }
+        endPhase(PHASE_WRITE);
+    }
+    if (outputWritten == TRUE) {
+        if (cacheKey[0] != '\0') {
+            pthread_mutex_lock(&cacheLock);
+            storeInCache(cache, cacheKey, fileName, outputs, listWrittenOutputs(labels, codeImage, IC, outputs));
+            pthread_mutex_unlock(&cacheLock);
+        }
+    }
+   
+    freeTables(labels);
+    freeMemory(codeImage, MEMORY_IMAGES);
+    freeMemory(dataImage, MEMORY_IMAGES);
+    printMessage("Finished processing file: '%s'\n", fileName);
+    return outputWritten;
+}
+
+/**
+ * Assembles a single source file and writes its output files. With '--check' it stops once the labels are checked.
+ * @param fileName The base name of the file (without the '.as' extension).
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @return TRUE if all the output files were written (or the file has no errors with '--check'), FALSE otherwise.
+ */
+boolean assembleFile (char *fileName, cache_t *cache, char *optionsKey) {
+    char cacheKey[CACHE_KEY_LENGTH+1];
+
+    switch (preprocessSource(fileName, cache, optionsKey, cacheKey)) {
+        case STAGE_PREPROCESSED:
+            return parseSource(fileName, cache, cacheKey);
+        case STAGE_RESTORED:
+            return TRUE;
+        default:
+            return FALSE;
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef ASSEMBLE_H
+#define ASSEMBLE_H
+
+#include "utils.h"
+#include "cache.h"
+#include "options.h"
+
+/* How far preprocessing got with a source file */
+typedef enum stage_result {
+    STAGE_FAILED = 0, /* the file could not be read or has a preprocessor error */
+    STAGE_RESTORED, /* every output was restored from the build cache */
+    STAGE_PREPROCESSED /* the '.am' file is ready to be parsed */
+} stage_result;
+
+/* set from '--check' and '--fail-fast' */
+extern boolean checkOnly;
+extern fail_fast_t failFast;
+
+/**
+ * Preprocesses a single source file into its '.am' file, or restores all of its outputs from the build cache.
+ * @param fileName The base name of the file (without the '.as' extension).
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @param cacheKey Receives the cache key of the file, or an empty string if it is not cached.
+ * @return How far the file got.
+ */
+stage_result preprocessSource(char *fileName, cache_t *cache, char *optionsKey, char *cacheKey);
+
+/**
+ * Parses the '.am' file of a preprocessed source file, resolves its labels and writes its output files.
+ * With '--check' it stops once the labels are checked.
+ * @param fileName The base name of the file (without the '.as' extension).
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param cacheKey The cache key of the file, or an empty string if it is not cached.
+ * @return TRUE if all the output files were written (or the file has no errors with '--check'), FALSE otherwise.
+ */
+boolean parseSource(char *fileName, cache_t *cache, char *cacheKey);
+
+/**
+ * Assembles a single source file and writes its output files. With '--check' it stops once the labels are checked.
+ * @param fileName The base name of the file (without the '.as' extension).
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @return TRUE if all the output files were written (or the file has no errors with '--check'), FALSE otherwise.
+ */
+boolean assembleFile(char *fileName, cache_t *cache, char *optionsKey);
+
+#endif /* ASSEMBLE_H */
@@ -0,0 +1,556 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+#include "batchio.h"
+#include "print.h"
+#include "utils.h"
+
+#define CLOSE_FLAG 1 /* the user data of a completion is the index of its file shifted left, with this bit for the close */
+#define NOT_COMPLETED (-ECANCELED) /* the result of an operation the ring never completed */
+#define RING_RETRY_LIMIT 1000 /* io_uring_enter calls in a row that may fail with EAGAIN or EBUSY before the ring is given up */
+
+/* The result of the operations on one file of a batch */
+typedef struct io_slot {
+    int fd;
+    long result; /* bytes read or written, or a negative error */
+    boolean closeQueued; /* the ring was given the close of the file, so only the ring may close it */
+} io_slot;
+
+#ifdef __linux__
+/* An io_uring instance and its rings, mapped from the kernel */
+struct io_ring {
+    int fd;
+    void *sqMemory;
+    void *cqMemory; /* the same as sqMemory when the kernel maps both rings at once */
+    size_t sqSize;
+    size_t cqSize;
+    struct io_uring_sqe *sqes;
+    size_t sqesSize;
+    unsigned *sqTail;
+    unsigned *sqMask;
+    unsigned *sqArray;
+    unsigned *cqHead;
+    unsigned *cqTail;
+    unsigned *cqMask;
+    struct io_uring_cqe *cqes;
+    unsigned entries;
+    unsigned queued; /* entries filled in since the last submit */
+};
+#else
+struct io_ring {
+    int unused;
+};
+#endif
+
+/**
+ * Opens a file, counting the system call.
+ * @param io The batched file I/O.
+ * @param path The path of the file, NULL if it could not be built.
+ * @param flags The flags of open.
+ * @return The file descriptor, or -1 on failure.
+ */
+static int openCounted (io_batch *io, const char *path, int flags) {
+    if (path == NULL)
+        return -1;
+    io->syscalls++;
+    return open(path, flags, 0666);
+}
+
+/**
+ * Closes a file, counting the system call.
+ * @param io The batched file I/O.
+ * @param fd The file descriptor.
+ */
+static void closeCounted (io_batch *io, int fd) {
+    io->syscalls++;
+    close(fd);
+}
+
+/**
+ * Reads a whole file with pread, sized by fstat.
+ * @param io The batched file I/O.
+ * @param file The file, whose data and length receive the contents.
+ * @return TRUE if the file was read, FALSE otherwise.
+ */
+static boolean preadFile (io_batch *io, io_file *file) {
+    struct stat status;
+    size_t capacity = IO_READ_SIZE, size = 0;
+    ssize_t count = 1;
+    char *bigger;
+    int fd = openCounted(io, file->path, O_RDONLY);
+
+    file->data = NULL;
+    file->length = 0;
+    file->done = FALSE;
+    if (fd < 0)
+        return FALSE;
+    io->syscalls++;
+    if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+        capacity = size = (size_t) status.st_size;
+    file->data = malloc(capacity + 1);
+
+    /* a regular file is read until its size, anything else until the end */
+    while (file->data != NULL && count > 0 && (size == 0 || file->length < size)) {
+        if (file->length == capacity) {
+            capacity *= 2;
+            bigger = realloc(file->data, capacity + 1);
+            if (bigger == NULL) {
+                free(file->data);
+                file->data = NULL;
+                break;
+            }
+            file->data = bigger;
+        }
+        io->syscalls++;
+        count = pread(fd, file->data + file->length, capacity - file->length, (off_t) file->length);
+        if (count > 0)
+            file->length += count;
+    }
+    closeCounted(io, fd);
+    if (file->data == NULL || count < 0) {
+        free(file->data);
+        file->data = NULL;
+        file->length = 0;
+        return FALSE;
+    }
+    file->data[file->length] = '\0';
+    file->done = TRUE;
+    return TRUE;
+}
+
+/**
+ * Writes a file with pwrite, from an offset to its end.
+ * @param io The batched file I/O.
+ * @param file The file and its contents.
+ * @param offset The number of bytes already written, 0 to create (or truncate) the file.
+ * @return TRUE if the file was written, FALSE otherwise.
+ */
+static boolean pwriteFile (io_batch *io, io_file *file, size_t offset) {
+    ssize_t count = 0;
+    int fd = openCounted(io, file->path, offset == 0 ? O_WRONLY | O_CREAT | O_TRUNC : O_WRONLY);
+
+    file->done = FALSE;
+    if (fd < 0)
+        return FALSE;
+    while (offset < file->length) {
+        io->syscalls++;
+        count = pwrite(fd, file->data + offset, file->length - offset, (off_t) offset);
+        if (count <= 0)
+            break;
+        offset += count;
+    }
+    io->syscalls++;
+    if (close(fd) != 0 || offset < file->length)
+        return FALSE;
+    file->done = TRUE;
+    return TRUE;
+}
+
+#ifdef __linux__
+/**
+ * Sets up an io_uring instance and maps its rings.
+ * @param io The batched file I/O.
+ * @return The ring, or NULL if io_uring is not available.
+ */
+static io_ring *setupRing (io_batch *io) {
+    struct io_uring_params params;
+    io_ring *ring = calloc(1, sizeof(io_ring));
+
+    if (ring == NULL)
+        return NULL;
+    memset(&params, 0, sizeof(params));
+    io->syscalls++;
+    ring->fd = (int) syscall(__NR_io_uring_setup, IO_RING_ENTRIES, &params);
+    if (ring->fd < 0) {
+        free(ring);
+        return NULL;
+    }
+    ring->entries = params.sq_entries;
+    ring->sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cqSize > ring->sqSize)
+            ring->sqSize = ring->cqSize;
+        ring->cqSize = 0;
+    }
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    io->syscalls += (ring->cqSize > 0) ? 3 : 2;
+    ring->sqMemory = mmap(NULL, ring->sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    ring->cqMemory = (ring->cqSize > 0) ? mmap(NULL, ring->cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                               ring->fd, IORING_OFF_CQ_RING) : ring->sqMemory;
+    ring->sqes = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqMemory == MAP_FAILED || ring->cqMemory == MAP_FAILED || (void *) ring->sqes == MAP_FAILED) {
+        if (ring->sqMemory != MAP_FAILED)
+            munmap(ring->sqMemory, ring->sqSize);
+        if (ring->cqSize > 0 && ring->cqMemory != MAP_FAILED)
+            munmap(ring->cqMemory, ring->cqSize);
+        if ((void *) ring->sqes != MAP_FAILED)
+            munmap(ring->sqes, ring->sqesSize);
+        close(ring->fd);
+        free(ring);
+        return NULL;
+    }
+
+    ring->sqTail = (unsigned *) ((char *) ring->sqMemory + params.sq_off.tail);
+    ring->sqMask = (unsigned *) ((char *) ring->sqMemory + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned *) ((char *) ring->sqMemory + params.sq_off.array);
+    ring->cqHead = (unsigned *) ((char *) ring->cqMemory + params.cq_off.head);
+    ring->cqTail = (unsigned *) ((char *) ring->cqMemory + params.cq_off.tail);
+    ring->cqMask = (unsigned *) ((char *) ring->cqMemory + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *) ((char *) ring->cqMemory + params.cq_off.cqes);
+    return ring;
+}
+
+/**
+ * Unmaps the rings of an io_uring instance and closes it.
+ * @param io The batched file I/O.
+ * @param ring The ring.
+ */
+static void teardownRing (io_batch *io, io_ring *ring) {
+    munmap(ring->sqes, ring->sqesSize);
+    if (ring->cqSize > 0)
+        munmap(ring->cqMemory, ring->cqSize);
+    munmap(ring->sqMemory, ring->sqSize);
+    closeCounted(io, ring->fd);
+    io->syscalls += (ring->cqSize > 0) ? 3 : 2;
+    free(ring);
+}
+
+/**
+ * Fills in the next submission entry. It is only seen by the kernel at the next submit.
+ * @param ring The ring, with at least one free entry.
+ * @param opcode The operation.
+ * @param fd The file descriptor.
+ * @param userData The user data of its completion.
+ * @return The entry, with everything else zero.
+ */
+static struct io_uring_sqe *queueEntry (io_ring *ring, int opcode, int fd, unsigned long userData) {
+    unsigned index = (*ring->sqTail + ring->queued) & *ring->sqMask;
+    struct io_uring_sqe *entry = &ring->sqes[index];
+
+    memset(entry, 0, sizeof(*entry));
+    entry->opcode = (unsigned char) opcode;
+    entry->fd = fd;
+    entry->user_data = userData;
+    ring->sqArray[index] = index;
+    ring->queued++;
+    return entry;
+}
+
+/**
+ * Checks if an io_uring_enter that failed may be called again.
+ * @param retries The number of calls in a row that failed with EAGAIN or EBUSY, counting this one.
+ * @return TRUE if it was interrupted, or the kernel was short of room for a while, FALSE otherwise.
+ */
+static boolean isTransientRingError (int retries) {
+    return (errno == EINTR || ((errno == EAGAIN || errno == EBUSY) && retries <= RING_RETRY_LIMIT));
+}
+
+/**
+ * Reaps the completions the kernel posted, into the slots of their files.
+ * @param ring The ring.
+ * @param slots The files of the batch, which receive the results.
+ * @return The number of completions reaped.
+ */
+static unsigned reapCompletions (io_ring *ring, io_slot slots[]) {
+    struct io_uring_cqe *completion;
+    unsigned head = *ring->cqHead, reaped = 0;
+
+    __sync_synchronize(); /* the completions must be read after the tail that publishes them */
+    while (head != *ring->cqTail) {
+        completion = &ring->cqes[head & *ring->cqMask];
+        /* the result of a close does not matter: the file is gone either way */
+        if ((completion->user_data & CLOSE_FLAG) == 0)
+            slots[completion->user_data >> 1].result = completion->res;
+        head++;
+        reaped++;
+    }
+    __sync_synchronize();
+    *ring->cqHead = head;
+    return reaped;
+}
+
+/**
+ * Gives up a ring that failed, and falls back to pread and pwrite. The entries the kernel has not taken are withdrawn,
+ * so their files are closed as usual, and the ones it took are waited for, so that no buffer is freed while the kernel
+ * may still use it. The ring is then torn down, which cancels whatever could not be waited for.
+ * @param io The batched file I/O.
+ * @param slots The files of the batch, which receive the results.
+ * @param unsubmitted The number of entries at the end of the submission ring that the kernel has not taken.
+ * @param running The number of entries the kernel took and has not completed.
+ */
+static void abandonRing (io_batch *io, io_slot slots[], unsigned unsubmitted, unsigned running) {
+    io_ring *ring = io->ring;
+    struct io_uring_sqe *entry;
+    unsigned i;
+    int retries = 0;
+
+    /* without a polling thread, the kernel only reads the submission ring inside io_uring_enter */
+    *ring->sqTail -= unsubmitted;
+    __sync_synchronize();
+    for (i = 0; i < unsubmitted; i++) {
+        entry = &ring->sqes[ring->sqArray[(*ring->sqTail + i) & *ring->sqMask]];
+        if (entry->user_data & CLOSE_FLAG)
+            slots[entry->user_data >> 1].closeQueued = FALSE;
+    }
+    /* waiting may still work when submitting does not */
+    while (running > 0) {
+        io->syscalls++;
+        if (syscall(__NR_io_uring_enter, ring->fd, 0, running, IORING_ENTER_GETEVENTS, NULL, 0) < 0 &&
+            isTransientRingError(++retries) == FALSE)
+            break;
+        running -= reapCompletions(ring, slots);
+    }
+    printWarningGeneral("io_uring failed, falling back to pread and pwrite.\n");
+    teardownRing(io, ring);
+    io->ring = NULL;
+    io->backend = IO_BACKEND_PREAD;
+}
+
+/**
+ * Submits the queued entries in as few system calls as the kernel allows, and waits for all of their completions.
+ * If the ring fails, the backend falls back to pread and pwrite, and the operations not completed keep NOT_COMPLETED.
+ * @param io The batched file I/O.
+ * @param slots The files of the batch, which receive the results.
+ */
+static void submitAndWait (io_batch *io, io_slot slots[]) {
+    io_ring *ring = io->ring;
+    unsigned pending = ring->queued, submitting = ring->queued, completed = 0;
+    long submitted;
+    int retries = 0;
+
+    __sync_synchronize(); /* the entries must be seen before the tail that publishes them */
+    *ring->sqTail += ring->queued;
+    __sync_synchronize();
+    ring->queued = 0;
+
+    while (completed < pending) {
+        io->syscalls++;
+        submitted = syscall(__NR_io_uring_enter, ring->fd, submitting, pending - completed, IORING_ENTER_GETEVENTS, NULL, 0);
+        /* EAGAIN and EBUSY mean the kernel is short of room until completions are reaped, as they are below */
+        if (submitted < 0 && isTransientRingError(++retries) == FALSE) {
+            abandonRing(io, slots, submitting, pending - completed - submitting);
+            return;
+        }
+        if (submitted >= 0)
+            retries = 0;
+        if (submitted > 0)
+            submitting -= (unsigned) submitted;
+        completed += reapCompletions(ring, slots);
+    }
+}
+
+/**
+ * Makes room for a pair of entries, submitting the queued ones if the ring is full.
+ * @param io The batched file I/O.
+ * @param slots The files of the batch.
+ * @return TRUE if there is room, FALSE if the ring failed.
+ */
+static boolean reservePair (io_batch *io, io_slot slots[]) {
+    if (io->backend != IO_BACKEND_URING)
+        return FALSE;
+    if (io->ring->entries - io->ring->queued < 2)
+        submitAndWait(io, slots);
+    return (io->backend == IO_BACKEND_URING);
+}
+
+/**
+ * Reads the files of a batch through the ring: every file is opened, and then the read and close of all of them are
+ * submitted together. A file bigger than IO_READ_SIZE (or that the ring could not read) is read again with pread.
+ * @param io The batched file I/O.
+ * @param files The files, whose data and length receive the contents.
+ * @param count The number of files.
+ * @param slots Room for the results of every file.
+ */
+static void ringReadFiles (io_batch *io, io_file files[], int count, io_slot slots[]) {
+    struct io_uring_sqe *entry;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        slots[i].fd = openCounted(io, files[i].path, O_RDONLY);
+        slots[i].result = NOT_COMPLETED;
+        slots[i].closeQueued = FALSE;
+        files[i].data = (slots[i].fd >= 0) ? malloc(IO_READ_SIZE + 1) : NULL;
+        files[i].length = 0;
+        files[i].done = FALSE;
+        if (files[i].data == NULL || reservePair(io, slots) == FALSE)
+            continue;
+        /* a hard link closes the file even after a short read, which is how every small file ends */
+        entry = queueEntry(io->ring, IORING_OP_READ, slots[i].fd, (unsigned long) i << 1);
+        entry->addr = (unsigned long) files[i].data;
+        entry->len = IO_READ_SIZE;
+        entry->flags = IOSQE_IO_HARDLINK;
+        queueEntry(io->ring, IORING_OP_CLOSE, slots[i].fd, ((unsigned long) i << 1) | CLOSE_FLAG);
+        slots[i].closeQueued = TRUE;
+    }
+    if (io->backend == IO_BACKEND_URING && io->ring->queued > 0)
+        submitAndWait(io, slots);
+
+    for (i = 0; i < count; i++) {
+        if (slots[i].fd < 0)
+            continue;
+        /* the number of a file the ring may have closed could already belong to another file */
+        if (slots[i].closeQueued == FALSE)
+            closeCounted(io, slots[i].fd);
+        if (files[i].data != NULL && slots[i].result >= 0 && slots[i].result < IO_READ_SIZE) {
+            files[i].length = (size_t) slots[i].result;
+            files[i].data[files[i].length] = '\0';
+            files[i].done = TRUE;
+        } else {
+            free(files[i].data);
+            preadFile(io, &files[i]);
+        }
+    }
+}
+
+/**
+ * Writes the files of a batch through the ring: every file is created, and then the write and close of all of them
+ * are submitted together. The rest of a short write is written with pwrite.
+ * @param io The batched file I/O.
+ * @param files The files and their contents.
+ * @param count The number of files.
+ * @param slots Room for the results of every file.
+ */
+static void ringWriteFiles (io_batch *io, io_file files[], int count, io_slot slots[]) {
+    struct io_uring_sqe *entry;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        slots[i].fd = openCounted(io, files[i].path, O_WRONLY | O_CREAT | O_TRUNC);
+        slots[i].result = (files[i].length > 0) ? NOT_COMPLETED : 0;
+        slots[i].closeQueued = FALSE;
+        files[i].done = FALSE;
+        if (slots[i].fd < 0 || reservePair(io, slots) == FALSE)
+            continue;
+        if (files[i].length > 0) {
+            entry = queueEntry(io->ring, IORING_OP_WRITE, slots[i].fd, (unsigned long) i << 1);
+            entry->addr = (unsigned long) files[i].data;
+            entry->len = (unsigned) files[i].length;
+            entry->flags = IOSQE_IO_HARDLINK;
+        }
+        queueEntry(io->ring, IORING_OP_CLOSE, slots[i].fd, ((unsigned long) i << 1) | CLOSE_FLAG);
+        slots[i].closeQueued = TRUE;
+    }
+    if (io->backend == IO_BACKEND_URING && io->ring->queued > 0)
+        submitAndWait(io, slots);
+
+    for (i = 0; i < count; i++) {
+        if (slots[i].fd < 0)
+            continue;
+        if (slots[i].closeQueued == FALSE)
+            closeCounted(io, slots[i].fd);
+        if (slots[i].result == (long) files[i].length)
+            files[i].done = TRUE;
+        else
+            pwriteFile(io, &files[i], slots[i].result > 0 ? (size_t) slots[i].result : 0);
+    }
+}
+#endif
+
+/**
+ * Starts the batched file I/O.
+ * @param io The state to start.
+ * @param backend IO_BACKEND_PREAD or IO_BACKEND_URING.
+ * @return TRUE if the requested backend is used, FALSE if it fell back to pread and pwrite.
+ */
+boolean initBatchIO (io_batch *io, io_backend_t backend) {
+    io->backend = IO_BACKEND_PREAD;
+    io->ring = NULL;
+    io->syscalls = 0;
+    io->files = 0;
+#ifdef __linux__
+    if (backend == IO_BACKEND_URING) {
+        io->ring = setupRing(io);
+        if (io->ring != NULL)
+            io->backend = IO_BACKEND_URING;
+    }
+#endif
+    return (io->backend == backend);
+}
+
+/**
+ * Reads whole files, the reads of all the files submitted together.
+ * @param io The batched file I/O.
+ * @param files The files, whose data and length receive the contents.
+ * @param count The number of files.
+ */
+void readFilesBatch (io_batch *io, io_file files[], int count) {
+#ifdef __linux__
+    io_slot *slots;
+#endif
+    int i;
+
+    io->files += count;
+#ifdef __linux__
+    slots = (io->backend == IO_BACKEND_URING) ? malloc(count * sizeof(io_slot)) : NULL;
+    if (slots != NULL) {
+        ringReadFiles(io, files, count, slots);
+        free(slots);
+        return;
+    }
+#endif
+    for (i = 0; i < count; i++)
+        preadFile(io, &files[i]);
+}
+
+/**
+ * Creates (or truncates) files and writes them in full, the writes of all the files submitted together.
+ * @param io The batched file I/O.
+ * @param files The files and their contents.
+ * @param count The number of files.
+ */
+void writeFilesBatch (io_batch *io, io_file files[], int count) {
+#ifdef __linux__
+    io_slot *slots;
+#endif
+    int i;
+
+    io->files += count;
+#ifdef __linux__
+    slots = (io->backend == IO_BACKEND_URING) ? malloc(count * sizeof(io_slot)) : NULL;
+    if (slots != NULL) {
+        ringWriteFiles(io, files, count, slots);
+        free(slots);
+        return;
+    }
+#endif
+    for (i = 0; i < count; i++)
+        pwriteFile(io, &files[i], 0);
+}
+
+/**
+ * Prints the number of system calls made per file.
+ * @param io The batched file I/O.
+ * @param sources The number of source files assembled.
+ */
+void printBatchIOReport (io_batch *io, int sources) {
+    printMessage("I/O (%s): %d source files, %ld files read and written, %ld system calls, %.1f per source file\n",
+                 io->backend == IO_BACKEND_URING ? "io_uring" : "pread", sources, io->files, io->syscalls,
+                 sources > 0 ? (double) io->syscalls / sources : 0.0);
+}
+
+/**
+ * Stops the batched file I/O.
+ * @param io The batched file I/O.
+ */
+void closeBatchIO (io_batch *io) {
+#ifdef __linux__
+    if (io->ring != NULL)
+        teardownRing(io, io->ring);
+#endif
+    io->ring = NULL;
+}
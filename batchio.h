@@ -0,0 +1,74 @@
+#ifndef BATCHIO_H
+#define BATCHIO_H
+
+#include <stddef.h>
+
+#include "utils.h"
+
+#define IO_BATCH_FILES 64 /* source files read, assembled and written together */
+#define IO_RING_ENTRIES 256
+#define IO_READ_SIZE 65536 /* the first read of a file, bigger files are read again in full */
+
+/* How the files of a batch are read and written */
+typedef enum io_backend_t {
+    IO_BACKEND_STDIO = 0, /* one file at a time through stdio, the default */
+    IO_BACKEND_PREAD, /* whole files with pread and pwrite */
+    IO_BACKEND_URING /* the reads (or writes) of a batch submitted at once to io_uring, Linux only */
+} io_backend_t;
+
+/* A file read or written by a batch */
+typedef struct io_file {
+    char *path;
+    char *data; /* read: receives the NULL terminated contents (must be freed), or NULL; write: the contents */
+    size_t length;
+    boolean done; /* TRUE if the file was read or written in full */
+} io_file;
+
+typedef struct io_ring io_ring;
+
+/* The state of the batched file I/O */
+typedef struct io_batch {
+    io_backend_t backend; /* IO_BACKEND_URING falls back to IO_BACKEND_PREAD when io_uring cannot be set up */
+    io_ring *ring;
+    long syscalls; /* every system call made to read and write the files */
+    long files;
+} io_batch;
+
+/**
+ * Starts the batched file I/O.
+ * @param io The state to start.
+ * @param backend IO_BACKEND_PREAD or IO_BACKEND_URING.
+ * @return TRUE if the requested backend is used, FALSE if it fell back to pread and pwrite.
+ */
+boolean initBatchIO(io_batch *io, io_backend_t backend);
+
+/**
+ * Reads whole files, the reads of all the files submitted together.
+ * @param io The batched file I/O.
+ * @param files The files, whose data and length receive the contents.
+ * @param count The number of files.
+ */
+void readFilesBatch(io_batch *io, io_file files[], int count);
+
+/**
+ * Creates (or truncates) files and writes them in full, the writes of all the files submitted together.
+ * @param io The batched file I/O.
+ * @param files The files and their contents.
+ * @param count The number of files.
+ */
+void writeFilesBatch(io_batch *io, io_file files[], int count);
+
+/**
+ * Prints the number of system calls made per file.
+ * @param io The batched file I/O.
+ * @param sources The number of source files assembled.
+ */
+void printBatchIOReport(io_batch *io, int sources);
+
+/**
+ * Stops the batched file I/O.
+ * @param io The batched file I/O.
+ */
+void closeBatchIO(io_batch *io);
+
+#endif /* BATCHIO_H */
@@ -0,0 +1,206 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "utils.h"
+
+#define REPETITIONS 3
+#define MAX_PATH_LENGTH 1024
+#define CORPUS_DIRECTORY "bench_corpus"
+
+/* A corpus: a number of generated files, each with a number of lines */
+typedef struct corpus_size {
+    int files;
+    int lines;
+} corpus_size;
+
+/* The measurements of a single run of the assembler */
+typedef struct run_result {
+    double seconds;
+    long peakRssKb;
+} run_result;
+
+/* corpora of increasing size, by number of files and by lines per file */
+static corpus_size sizes[] = {
+    {1, 200},
+    {10, 200},
+    {100, 200},
+    {1000, 200},
+    {100, 2000},
+    {1000, 2000}
+};
+
+/**
+ * Reads the monotonic clock.
+ * @return The time in seconds since an arbitrary fixed point.
+ */
+static double now (void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Generates a corpus by running the generator.
+ * @param generator The path of the generator.
+ * @param size The size of the corpus.
+ * @param prefix The prefix of the generated files.
+ * @param filler Receives the number of lines the generator wrote as filler, once the words of a file ran out.
+ * @return The total number of lines generated, or -1 on failure.
+ */
+static long generateCorpus (char *generator, corpus_size *size, char *prefix, long *filler) {
+    char command[3 * MAX_PATH_LENGTH];
+    long files, lines = -1;
+    FILE *output;
+
+    sprintf(command, "%.1000s -f %d -n %d -l %d -m 8 -c 15 -e 10 -d 20 -o %.1000s", generator,
+            size->files, size->lines, size->lines / 10 < 200 ? size->lines / 10 : 200, prefix);
+    output = popen(command, "r");
+    if (output == NULL)
+        return -1;
+    if (fscanf(output, "%ld files, %ld lines, %ld filler lines", &files, &lines, filler) != 3)
+        lines = -1;
+    if (pclose(output) != 0)
+        return -1;
+    return lines;
+}
+
+/**
+ * Runs the assembler over a corpus and measures it.
+ * @param assembler The path of the assembler.
+ * @param size The size of the corpus.
+ * @param prefix The prefix of the generated files.
+ * @param result Receives the wall time and peak resident set size.
+ * @return TRUE if the assembler ran successfully, FALSE otherwise.
+ */
+static boolean runAssembler (char *assembler, corpus_size *size, char *prefix, run_result *result) {
+    char **args;
+    int i, status, devNull;
+    double start;
+    pid_t child;
+    struct rusage usage;
+    boolean success = FALSE;
+
+    args = calloc(size->files + 2, sizeof(char *));
+    if (args == NULL)
+        return FALSE;
+    args[0] = assembler;
+    for (i = 0; i < size->files; i++) {
+        args[i + 1] = malloc(strlen(prefix) + 16);
+        if (args[i + 1] != NULL)
+            sprintf(args[i + 1], "%s%d", prefix, i);
+    }
+
+    start = now();
+    child = fork();
+    if (child == 0) {
+        /* the assembler reports every file, which is not what is measured */
+        devNull = open("/dev/null", O_WRONLY);
+        if (devNull >= 0)
+            dup2(devNull, STDOUT_FILENO);
+        execv(assembler, args);
+        _exit(127);
+    }
+    if (child > 0 && wait4(child, &status, 0, &usage) == child) {
+        result->seconds = now() - start;
+        result->peakRssKb = usage.ru_maxrss;
+        success = (WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+
+    for (i = 0; i < size->files; i++)
+        free(args[i + 1]);
+    free(args);
+    return success;
+}
+
+/**
+ * Sums the number of machine words written to the '.obj' files of a corpus.
+ * @param size The size of the corpus.
+ * @param prefix The prefix of the generated files.
+ * @return The total number of words.
+ */
+static long countWords (corpus_size *size, char *prefix) {
+    char path[MAX_PATH_LENGTH + 32];
+    long IC, DC, words = 0;
+    int i;
+    FILE *file;
+
+    for (i = 0; i < size->files; i++) {
+        sprintf(path, "%.1000s%d.obj", prefix, i);
+        file = fopen(path, "r");
+        if (file == NULL)
+            continue;
+        if (fscanf(file, "%ld %ld", &IC, &DC) == 2)
+            words += IC + DC;
+        fclose(file);
+    }
+    return words;
+}
+
+int main (int argc, char *argv[]) {
+    char prefix[MAX_PATH_LENGTH];
+    run_result best, run;
+    long lines, filler, words;
+    int i, repetition;
+    boolean failed = FALSE;
+    FILE *results;
+
+    if (argc != 4) {
+        fprintf(stderr, "usage: benchmark <assembler> <generator> <results.csv>\n");
+        return 1;
+    }
+    results = fopen(argv[3], "w");
+    if (results == NULL) {
+        fprintf(stderr, "benchmark: cannot write '%s'\n", argv[3]);
+        return 1;
+    }
+    mkdir(CORPUS_DIRECTORY, 0777);
+
+    fprintf(results, "files,lines,filler_lines,words,seconds,lines_per_sec,words_per_sec,peak_rss_kb\n");
+    printf("%8s %10s %10s %10s %10s %14s %14s %12s\n", "files", "lines", "filler", "words", "seconds", "lines/sec",
+           "words/sec", "peak RSS kB");
+    for (i = 0; i < (int) (sizeof(sizes) / sizeof(sizes[0])); i++) {
+        sprintf(prefix, "%s/f%d_n%d_", CORPUS_DIRECTORY, sizes[i].files, sizes[i].lines);
+        lines = generateCorpus(argv[2], &sizes[i], prefix, &filler);
+        if (lines < 0) {
+            fprintf(stderr, "benchmark: generating %d files of %d lines failed\n", sizes[i].files, sizes[i].lines);
+            failed = TRUE;
+            continue;
+        }
+
+        /* keep the fastest of a few runs, the peak memory does not change between them */
+        best.seconds = -1;
+        best.peakRssKb = 0;
+        for (repetition = 0; repetition < REPETITIONS; repetition++) {
+            if (runAssembler(argv[1], &sizes[i], prefix, &run) == FALSE) {
+                fprintf(stderr, "benchmark: running '%s' failed\n", argv[1]);
+                failed = TRUE;
+                break;
+            }
+            if (best.seconds < 0 || run.seconds < best.seconds)
+                best.seconds = run.seconds;
+            if (run.peakRssKb > best.peakRssKb)
+                best.peakRssKb = run.peakRssKb;
+        }
+        if (best.seconds <= 0)
+            continue;
+
+        words = countWords(&sizes[i], prefix);
+        fprintf(results, "%d,%ld,%ld,%ld,%.6f,%.0f,%.0f,%ld\n", sizes[i].files, lines, filler, words, best.seconds,
+                lines / best.seconds, words / best.seconds, best.peakRssKb);
+        printf("%8d %10ld %10ld %10ld %10.4f %14.0f %14.0f %12ld\n", sizes[i].files, lines, filler, words,
+               best.seconds, lines / best.seconds, words / best.seconds, best.peakRssKb);
+    }
+    fclose(results);
+    return failed ? 1 : 0;
+}
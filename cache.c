@@ -0,0 +1,330 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "cache.h"
+#include "frame.h"
+#include "generateOutput.h"
+#include "hash.h"
+#include "utils.h"
+#include "print.h"
+#include "preprocessor.h"
+
+#define CACHE_VERSION_TAG "version"
+#define MAX_INCLUDE_DEPTH 16
+
+/* a single file found in the cache directory while evicting */
+typedef struct cache_file {
+    char *path;
+    long size;
+    time_t lastUsed;
+} cache_file;
+
+/**
+ * Builds the path of a file inside the cache directory.
+ * @param cache The build cache.
+ * @param name The name of the file inside the directory.
+ * @return A newly allocated path (must be freed), or NULL if out of memory.
+ */
+static char *cachePath (cache_t *cache, const char *name) {
+    char *path = malloc(strlen(cache->directory) + strlen(name) + 2);
+    if (path == NULL) {
+        printErrorGeneral("Not enough memory for a cache path\n");
+        return NULL;
+    }
+    sprintf(path, "%s/%s", cache->directory, name);
+    return path;
+}
+
+/**
+ * Compares two cache files by the time they were last used, for sorting.
+ * @param a The first cache file.
+ * @param b The second cache file.
+ * @return Negative if a was used before b, positive if after, 0 otherwise.
+ */
+static int compareLastUsed (const void *a, const void *b) {
+    time_t first = ((const cache_file *) a)->lastUsed;
+    time_t second = ((const cache_file *) b)->lastUsed;
+    return (first > second) - (first < second);
+}
+
+/**
+ * Initializes the build cache and creates its directory if needed.
+ * @param cache The cache to initialize.
+ * @param directory The directory that holds the entries.
+ * @param maxSize The maximum number of bytes the cache may hold.
+ * @return TRUE if the cache is usable, FALSE otherwise.
+ */
+boolean initCache (cache_t *cache, char *directory, long maxSize) {
+    cache->directory = directory;
+    cache->maxSize = maxSize;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->stores = 0;
+    cache->evictions = 0;
+
+    if (mkdir(directory, 0777) != 0 && errno != EEXIST) {
+        printErrorGeneral("Could not create cache directory ");
+        printMessage("'%s'.\n", directory);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * Adds the paths and bytes of the files included by a source to a digest, and those of the files they include.
+ * @param digest The digest to update.
+ * @param contents The bytes of the source (NULL terminated).
+ * @param includer The path of the source, whose directory the included files are relative to.
+ * @param depth How deep the source is included, to stop at include cycles.
+ */
+static void digestIncludes (digest_t *digest, char *contents, const char *includer, int depth) {
+    char line[MAX_LINE_LENGTH+1], name[MAX_LINE_LENGTH+1], path[MAX_INCLUDE_PATH_LENGTH+1];
+    char *start, *end, *included;
+    size_t length;
+    long includedLength;
+    FILE *file;
+
+    for (start = contents; *start != '\0' && depth < MAX_INCLUDE_DEPTH; start = (*end != '\0') ? end + 1 : end) {
+        end = strchr(start, '\n');
+        if (end == NULL)
+            end = start + strlen(start);
+        length = (end - start < MAX_LINE_LENGTH) ? (size_t) (end - start) : MAX_LINE_LENGTH;
+        memcpy(line, start, length);
+        line[length] = '\0';
+        if (parseInclude(line, name) == FALSE || name[0] == '\0' || resolveIncludePath(includer, name, path) == FALSE)
+            continue;
+
+        /* a missing file still changes the key, so that adding it later is noticed */
+        digestUpdate(digest, path, strlen(path) + 1);
+        file = fopen(path, "rb");
+        if (file == NULL)
+            continue;
+        included = readFileContents(file, &includedLength);
+        fclose(file);
+        if (included == NULL)
+            continue;
+        digestUpdate(digest, included, includedLength);
+        digestIncludes(digest, included, path, depth + 1);
+        free(included);
+    }
+}
+
+/**
+ * Computes the cache key of a source file from its bytes, the bytes of the files it includes,
+ * the assembler version and the options. The file is rewound when done.
+ * @param fileAs Pointer to the source file.
+ * @param sourcePath The path (or base name) of the source file, whose directory the included files are relative to.
+ * @param optionsKey String describing the options that change the output.
+ * @param key Buffer of at least CACHE_KEY_LENGTH + 1 characters that receives the key.
+ * @return TRUE if the key was computed, FALSE otherwise.
+ */
+boolean computeCacheKey (FILE *fileAs, const char *sourcePath, const char *optionsKey, char *key) {
+    digest_t digest;
+    long length;
+    char *contents;
+
+    rewind(fileAs);
+    contents = readFileContents(fileAs, &length);
+    rewind(fileAs);
+    if (contents == NULL)
+        return FALSE;
+
+    /* the NULL endings separate the fields so that they cannot run into each other */
+    digestInit(&digest);
+    digestUpdate(&digest, ASSEMBLER_VERSION, strlen(ASSEMBLER_VERSION) + 1);
+    digestUpdate(&digest, optionsKey, strlen(optionsKey) + 1);
+    digestUpdate(&digest, contents, length);
+    digestIncludes(&digest, contents, sourcePath, 0);
+    digestToHex(&digest, key);
+
+    free(contents);
+    return TRUE;
+}
+
+/**
+ * Restores the outputs of a source file from the cache.
+ * @param cache The build cache.
+ * @param key The cache key of the source file.
+ * @param fileName The base name of the file.
+ * @return TRUE on a cache hit (all outputs were restored), FALSE on a miss.
+ */
+boolean restoreFromCache (cache_t *cache, const char *key, const char *fileName) {
+    char tag[MAX_FRAME_TAG_LENGTH + 1];
+    char *path, *data;
+    long length;
+    boolean restored = FALSE;
+    FILE *entry, *output;
+
+    path = cachePath(cache, key);
+    if (path == NULL)
+        return FALSE;
+    entry = fopen(path, "rb");
+    if (entry == NULL) {
+        free(path);
+        cache->misses++;
+        return FALSE;
+    }
+
+    /* the first frame holds the version that wrote the entry */
+    if (readFrame(entry, tag, &data, &length) == TRUE && strcmp(tag, CACHE_VERSION_TAG) == 0 &&
+        strcmp(data, ASSEMBLER_VERSION) == 0) {
+        restored = TRUE;
+        free(data);
+        /* every other frame holds one output file, tagged by its extension */
+        while (restored == TRUE && readFrame(entry, tag, &data, &length) == TRUE) {
+            output = openFile(fileName, tag, "w");
+            if (output == NULL || fwrite(data, 1, length, output) != (size_t) length)
+                restored = FALSE;
+            if (output != NULL)
+                fclose(output);
+            free(data);
+        }
+    } else {
+        free(data);
+    }
+    fclose(entry);
+
+    if (restored == TRUE) {
+        utime(path, NULL); /* mark the entry as recently used */
+        cache->hits++;
+    } else {
+        cache->misses++;
+    }
+    free(path);
+    return restored;
+}
+
+/**
+ * Stores the outputs of a successfully assembled source file in the cache.
+ * @param cache The build cache.
+ * @param key The cache key of the source file.
+ * @param fileName The base name of the file.
+ * @param extensions The extensions of the outputs that were written for this file.
+ * @param count The number of extensions.
+ * @return TRUE if the entry was stored, FALSE otherwise.
+ */
+boolean storeInCache (cache_t *cache, const char *key, const char *fileName, char *extensions[], int count) {
+    char tempName[CACHE_KEY_LENGTH + 32];
+    char *path, *tempPath, *data;
+    long length;
+    int i;
+    boolean stored = TRUE;
+    FILE *entry, *output;
+
+    /* write into a temporary name first, so that other processes never see half an entry */
+    sprintf(tempName, "%s.tmp.%ld", key, (long) getpid());
+    path = cachePath(cache, key);
+    tempPath = cachePath(cache, tempName);
+    if (path == NULL || tempPath == NULL) {
+        free(path);
+        free(tempPath);
+        return FALSE;
+    }
+
+    entry = fopen(tempPath, "wb");
+    if (entry == NULL) {
+        free(path);
+        free(tempPath);
+        return FALSE;
+    }
+    stored = writeFrame(entry, CACHE_VERSION_TAG, ASSEMBLER_VERSION, strlen(ASSEMBLER_VERSION));
+    for (i = 0; i < count && stored == TRUE; i++) {
+        output = openFile(fileName, extensions[i], "r");
+        if (output == NULL) {
+            stored = FALSE;
+            break;
+        }
+        data = readFileContents(output, &length);
+        fclose(output);
+        stored = (data != NULL && writeFrame(entry, extensions[i], data, length) == TRUE);
+        free(data);
+    }
+    if (fclose(entry) != 0)
+        stored = FALSE;
+
+    if (stored == TRUE && rename(tempPath, path) == 0) {
+        cache->stores++;
+    } else {
+        remove(tempPath);
+        stored = FALSE;
+    }
+    free(path);
+    free(tempPath);
+    return stored;
+}
+
+/**
+ * Evicts the least recently used entries until the cache fits in its maximum size.
+ * @param cache The build cache.
+ */
+void evictCache (cache_t *cache) {
+    DIR *directory;
+    struct dirent *dirEntry;
+    struct stat status;
+    cache_file *files = NULL, *bigger;
+    int count = 0, capacity = 0, i;
+    long totalSize = 0;
+    char *path;
+
+    directory = opendir(cache->directory);
+    if (directory == NULL)
+        return;
+
+    /* collect the size and last use time of every entry, leaving out the entries other processes are still writing */
+    while ((dirEntry = readdir(directory)) != NULL) {
+        if (dirEntry->d_name[0] == '.' || strstr(dirEntry->d_name, ".tmp.") != NULL)
+            continue;
+        path = cachePath(cache, dirEntry->d_name);
+        if (path == NULL)
+            break;
+        if (stat(path, &status) != 0 || !S_ISREG(status.st_mode)) {
+            free(path);
+            continue;
+        }
+        if (count == capacity) {
+            capacity = (capacity == 0) ? 64 : capacity * 2;
+            bigger = realloc(files, capacity * sizeof(cache_file));
+            if (bigger == NULL) {
+                free(path);
+                break;
+            }
+            files = bigger;
+        }
+        files[count].path = path;
+        files[count].size = status.st_size;
+        files[count].lastUsed = status.st_mtime;
+        totalSize += status.st_size;
+        count++;
+    }
+    closedir(directory);
+
+    /* remove the oldest entries first */
+    if (count > 0)
+        qsort(files, count, sizeof(cache_file), compareLastUsed);
+    for (i = 0; i < count; i++) {
+        if (totalSize > cache->maxSize && remove(files[i].path) == 0) {
+            totalSize -= files[i].size;
+            cache->evictions++;
+        }
+        free(files[i].path);
+    }
+    free(files);
+}
+
+/**
+ * Prints the hit, miss and eviction counters of the cache.
+ * @param cache The build cache.
+ */
+void printCacheStatistics (cache_t *cache) {
+    printMessage("Cache '%s': %d hits, %d misses, %d stored, %d evicted\n",
+           cache->directory, cache->hits, cache->misses, cache->stores, cache->evictions);
+}
@@ -0,0 +1,73 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdio.h>
+
+#include "utils.h"
+#include "hash.h"
+
+#define CACHE_KEY_LENGTH DIGEST_HEX_LENGTH
+
+/* Content addressed build cache - every entry holds all the outputs of one assembled '.as' file */
+typedef struct cache_t {
+    char *directory; /* directory that holds the entries */
+    long maxSize; /* entries are evicted (least recently used first) above this number of bytes */
+    int hits;
+    int misses;
+    int stores;
+    int evictions;
+} cache_t;
+
+/**
+ * Initializes the build cache and creates its directory if needed.
+ * @param cache The cache to initialize.
+ * @param directory The directory that holds the entries.
+ * @param maxSize The maximum number of bytes the cache may hold.
+ * @return TRUE if the cache is usable, FALSE otherwise.
+ */
+boolean initCache(cache_t *cache, char *directory, long maxSize);
+
+/**
+ * Computes the cache key of a source file from its bytes, the bytes of the files it includes,
+ * the assembler version and the options. The file is rewound when done.
+ * @param fileAs Pointer to the source file.
+ * @param sourcePath The path (or base name) of the source file, whose directory the included files are relative to.
+ * @param optionsKey String describing the options that change the output.
+ * @param key Buffer of at least CACHE_KEY_LENGTH + 1 characters that receives the key.
+ * @return TRUE if the key was computed, FALSE otherwise.
+ */
+boolean computeCacheKey(FILE *fileAs, const char *sourcePath, const char *optionsKey, char *key);
+
+/**
+ * Restores the outputs of a source file from the cache.
+ * @param cache The build cache.
+ * @param key The cache key of the source file.
+ * @param fileName The base name of the file.
+ * @return TRUE on a cache hit (all outputs were restored), FALSE on a miss.
+ */
+boolean restoreFromCache(cache_t *cache, const char *key, const char *fileName);
+
+/**
+ * Stores the outputs of a successfully assembled source file in the cache.
+ * @param cache The build cache.
+ * @param key The cache key of the source file.
+ * @param fileName The base name of the file.
+ * @param extensions The extensions of the outputs that were written for this file.
+ * @param count The number of extensions.
+ * @return TRUE if the entry was stored, FALSE otherwise.
+ */
+boolean storeInCache(cache_t *cache, const char *key, const char *fileName, char *extensions[], int count);
+
+/**
+ * Evicts the least recently used entries until the cache fits in its maximum size.
+ * @param cache The build cache.
+ */
+void evictCache(cache_t *cache);
+
+/**
+ * Prints the hit, miss and eviction counters of the cache.
+ * @param cache The build cache.
+ */
+void printCacheStatistics(cache_t *cache);
+
+#endif /* CACHE_H */
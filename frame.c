@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "frame.h"
+#include "utils.h"
+
+#define READ_CHUNK_SIZE 4096
+
+/**
+ * Writes a single frame into a stream.
+ * @param file The stream to write to.
+ * @param tag The tag of the frame (no spaces, at most MAX_FRAME_TAG_LENGTH characters).
+ * @param data The contents of the frame.
+ * @param length The number of bytes in data.
+ * @return TRUE if the frame was written, FALSE otherwise.
+ */
+boolean writeFrame (FILE *file, const char *tag, const char *data, long length) {
+    if (strlen(tag) > MAX_FRAME_TAG_LENGTH)
+        return FALSE;
+    if (fprintf(file, "%s %ld\n", tag, length) < 0)
+        return FALSE;
+    if (length > 0 && fwrite(data, 1, length, file) != (size_t) length)
+        return FALSE;
+    return TRUE;
+}
+
+/**
+ * Reads the next frame from a stream.
+ * @param file The stream to read from.
+ * @param tag Buffer of at least MAX_FRAME_TAG_LENGTH + 1 characters that receives the tag.
+ * @param data Receives a newly allocated buffer with the contents (NULL terminated, must be freed).
+ * @param length Receives the number of bytes in data.
+ * @return TRUE if a frame was read, FALSE at the end of the stream or on a malformed frame.
+ */
+boolean readFrame (FILE *file, char *tag, char **data, long *length) {
+    char header[MAX_FRAME_TAG_LENGTH + 32];
+
+    *data = NULL;
+    if (fgets(header, sizeof(header), file) == NULL)
+        return FALSE;
+    if (sscanf(header, "%15s %ld", tag, length) != 2 || *length < 0)
+        return FALSE;
+
+    *data = malloc(*length + 1);
+    if (*data == NULL)
+        return FALSE;
+    if (fread(*data, 1, *length, file) != (size_t) *length) {
+        free(*data);
+        *data = NULL;
+        return FALSE;
+    }
+    (*data)[*length] = '\0';
+    return TRUE;
+}
+
+/**
+ * Reads everything from the current position of a stream to its end.
+ * @param file The stream to read.
+ * @param length Receives the number of bytes read.
+ * @return A newly allocated NULL terminated buffer (must be freed), or NULL on failure.
+ */
+char *readFileContents (FILE *file, long *length) {
+    long capacity = READ_CHUNK_SIZE;
+    size_t count;
+    char *buffer = malloc(capacity + 1), *bigger;
+
+    *length = 0;
+    if (buffer == NULL)
+        return NULL;
+
+    while ((count = fread(buffer + *length, 1, capacity - *length, file)) > 0) {
+        *length += count;
+        if (*length == capacity) { /* buffer is full, grow it */
+            capacity *= 2;
+            bigger = realloc(buffer, capacity + 1);
+            if (bigger == NULL) {
+                free(buffer);
+                return NULL;
+            }
+            buffer = bigger;
+        }
+    }
+    buffer[*length] = '\0';
+    return buffer;
+}
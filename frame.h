@@ -0,0 +1,44 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <stdio.h>
+
+#include "utils.h"
+
+#define MAX_FRAME_TAG_LENGTH 15
+
+/*
+ * A frame is one tagged, length-prefixed section of a stream:
+ *     <tag> <length>\n<exactly length raw bytes>
+ * Several frames written one after the other form a container of outputs.
+ */
+
+/**
+ * Writes a single frame into a stream.
+ * @param file The stream to write to.
+ * @param tag The tag of the frame (no spaces, at most MAX_FRAME_TAG_LENGTH characters).
+ * @param data The contents of the frame.
+ * @param length The number of bytes in data.
+ * @return TRUE if the frame was written, FALSE otherwise.
+ */
+boolean writeFrame(FILE *file, const char *tag, const char *data, long length);
+
+/**
+ * Reads the next frame from a stream.
+ * @param file The stream to read from.
+ * @param tag Buffer of at least MAX_FRAME_TAG_LENGTH + 1 characters that receives the tag.
+ * @param data Receives a newly allocated buffer with the contents (NULL terminated, must be freed).
+ * @param length Receives the number of bytes in data.
+ * @return TRUE if a frame was read, FALSE at the end of the stream or on a malformed frame.
+ */
+boolean readFrame(FILE *file, char *tag, char **data, long *length);
+
+/**
+ * Reads everything from the current position of a stream to its end.
+ * @param file The stream to read.
+ * @param length Receives the number of bytes read.
+ * @return A newly allocated NULL terminated buffer (must be freed), or NULL on failure.
+ */
+char *readFileContents(FILE *file, long *length);
+
+#endif /* FRAME_H */
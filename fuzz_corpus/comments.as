@@ -0,0 +1,1501 @@
+
+; comment line number 1 with some words in it
+; comment line number 2 with some words in it
+
+; comment line number 4 with some words in it
+; comment line number 5 with some words in it
+
+; comment line number 7 with some words in it
+; comment line number 8 with some words in it
+
+; comment line number 10 with some words in it
+; comment line number 11 with some words in it
+
+; comment line number 13 with some words in it
+; comment line number 14 with some words in it
+
+; comment line number 16 with some words in it
+; comment line number 17 with some words in it
+
+; comment line number 19 with some words in it
+; comment line number 20 with some words in it
+
+; comment line number 22 with some words in it
+; comment line number 23 with some words in it
+
+; comment line number 25 with some words in it
+; comment line number 26 with some words in it
+
+; comment line number 28 with some words in it
+; comment line number 29 with some words in it
+
+; comment line number 31 with some words in it
+; comment line number 32 with some words in it
+
+; comment line number 34 with some words in it
+; comment line number 35 with some words in it
+
+; comment line number 37 with some words in it
+; comment line number 38 with some words in it
+
+; comment line number 40 with some words in it
+; comment line number 41 with some words in it
+
+; comment line number 43 with some words in it
+; comment line number 44 with some words in it
+
+; comment line number 46 with some words in it
+; comment line number 47 with some words in it
+
+; comment line number 49 with some words in it
+; comment line number 50 with some words in it
+
+; comment line number 52 with some words in it
+; comment line number 53 with some words in it
+
+; comment line number 55 with some words in it
+; comment line number 56 with some words in it
+
+; comment line number 58 with some words in it
+; comment line number 59 with some words in it
+
+; comment line number 61 with some words in it
+; comment line number 62 with some words in it
+
+; comment line number 64 with some words in it
+; comment line number 65 with some words in it
+
+; comment line number 67 with some words in it
+; comment line number 68 with some words in it
+
+; comment line number 70 with some words in it
+; comment line number 71 with some words in it
+
+; comment line number 73 with some words in it
+; comment line number 74 with some words in it
+
+; comment line number 76 with some words in it
+; comment line number 77 with some words in it
+
+; comment line number 79 with some words in it
+; comment line number 80 with some words in it
+
+; comment line number 82 with some words in it
+; comment line number 83 with some words in it
+
+; comment line number 85 with some words in it
+; comment line number 86 with some words in it
+
+; comment line number 88 with some words in it
+; comment line number 89 with some words in it
+
+; comment line number 91 with some words in it
+; comment line number 92 with some words in it
+
+; comment line number 94 with some words in it
+; comment line number 95 with some words in it
+
+; comment line number 97 with some words in it
+; comment line number 98 with some words in it
+
+; comment line number 100 with some words in it
+; comment line number 101 with some words in it
+
+; comment line number 103 with some words in it
+; comment line number 104 with some words in it
+
+; comment line number 106 with some words in it
+; comment line number 107 with some words in it
+
+; comment line number 109 with some words in it
+; comment line number 110 with some words in it
+
+; comment line number 112 with some words in it
+; comment line number 113 with some words in it
+
+; comment line number 115 with some words in it
+; comment line number 116 with some words in it
+
+; comment line number 118 with some words in it
+; comment line number 119 with some words in it
+
+; comment line number 121 with some words in it
+; comment line number 122 with some words in it
+
+; comment line number 124 with some words in it
+; comment line number 125 with some words in it
+
+; comment line number 127 with some words in it
+; comment line number 128 with some words in it
+
+; comment line number 130 with some words in it
+; comment line number 131 with some words in it
+
+; comment line number 133 with some words in it
+; comment line number 134 with some words in it
+
+; comment line number 136 with some words in it
+; comment line number 137 with some words in it
+
+; comment line number 139 with some words in it
+; comment line number 140 with some words in it
+
+; comment line number 142 with some words in it
+; comment line number 143 with some words in it
+
+; comment line number 145 with some words in it
+; comment line number 146 with some words in it
+
+; comment line number 148 with some words in it
+; comment line number 149 with some words in it
+
+; comment line number 151 with some words in it
+; comment line number 152 with some words in it
+
+; comment line number 154 with some words in it
+; comment line number 155 with some words in it
+
+; comment line number 157 with some words in it
+; comment line number 158 with some words in it
+
+; comment line number 160 with some words in it
+; comment line number 161 with some words in it
+
+; comment line number 163 with some words in it
+; comment line number 164 with some words in it
+
+; comment line number 166 with some words in it
+; comment line number 167 with some words in it
+
+; comment line number 169 with some words in it
+; comment line number 170 with some words in it
+
+; comment line number 172 with some words in it
+; comment line number 173 with some words in it
+
+; comment line number 175 with some words in it
+; comment line number 176 with some words in it
+
+; comment line number 178 with some words in it
+; comment line number 179 with some words in it
+
+; comment line number 181 with some words in it
+; comment line number 182 with some words in it
+
+; comment line number 184 with some words in it
+; comment line number 185 with some words in it
+
+; comment line number 187 with some words in it
+; comment line number 188 with some words in it
+
+; comment line number 190 with some words in it
+; comment line number 191 with some words in it
+
+; comment line number 193 with some words in it
+; comment line number 194 with some words in it
+
+; comment line number 196 with some words in it
+; comment line number 197 with some words in it
+
+; comment line number 199 with some words in it
+; comment line number 200 with some words in it
+
+; comment line number 202 with some words in it
+; comment line number 203 with some words in it
+
+; comment line number 205 with some words in it
+; comment line number 206 with some words in it
+
+; comment line number 208 with some words in it
+; comment line number 209 with some words in it
+
+; comment line number 211 with some words in it
+; comment line number 212 with some words in it
+
+; comment line number 214 with some words in it
+; comment line number 215 with some words in it
+
+; comment line number 217 with some words in it
+; comment line number 218 with some words in it
+
+; comment line number 220 with some words in it
+; comment line number 221 with some words in it
+
+; comment line number 223 with some words in it
+; comment line number 224 with some words in it
+
+; comment line number 226 with some words in it
+; comment line number 227 with some words in it
+
+; comment line number 229 with some words in it
+; comment line number 230 with some words in it
+
+; comment line number 232 with some words in it
+; comment line number 233 with some words in it
+
+; comment line number 235 with some words in it
+; comment line number 236 with some words in it
+
+; comment line number 238 with some words in it
+; comment line number 239 with some words in it
+
+; comment line number 241 with some words in it
+; comment line number 242 with some words in it
+
+; comment line number 244 with some words in it
+; comment line number 245 with some words in it
+
+; comment line number 247 with some words in it
+; comment line number 248 with some words in it
+
+; comment line number 250 with some words in it
+; comment line number 251 with some words in it
+
+; comment line number 253 with some words in it
+; comment line number 254 with some words in it
+
+; comment line number 256 with some words in it
+; comment line number 257 with some words in it
+
+; comment line number 259 with some words in it
+; comment line number 260 with some words in it
+
+; comment line number 262 with some words in it
+; comment line number 263 with some words in it
+
+; comment line number 265 with some words in it
+; comment line number 266 with some words in it
+
+; comment line number 268 with some words in it
+; comment line number 269 with some words in it
+
+; comment line number 271 with some words in it
+; comment line number 272 with some words in it
+
+; comment line number 274 with some words in it
+; comment line number 275 with some words in it
+
+; comment line number 277 with some words in it
+; comment line number 278 with some words in it
+
+; comment line number 280 with some words in it
+; comment line number 281 with some words in it
+
+; comment line number 283 with some words in it
+; comment line number 284 with some words in it
+
+; comment line number 286 with some words in it
+; comment line number 287 with some words in it
+
+; comment line number 289 with some words in it
+; comment line number 290 with some words in it
+
+; comment line number 292 with some words in it
+; comment line number 293 with some words in it
+
+; comment line number 295 with some words in it
+; comment line number 296 with some words in it
+
+; comment line number 298 with some words in it
+; comment line number 299 with some words in it
+
+; comment line number 301 with some words in it
+; comment line number 302 with some words in it
+
+; comment line number 304 with some words in it
+; comment line number 305 with some words in it
+
+; comment line number 307 with some words in it
+; comment line number 308 with some words in it
+
+; comment line number 310 with some words in it
+; comment line number 311 with some words in it
+
+; comment line number 313 with some words in it
+; comment line number 314 with some words in it
+
+; comment line number 316 with some words in it
+; comment line number 317 with some words in it
+
+; comment line number 319 with some words in it
+; comment line number 320 with some words in it
+
+; comment line number 322 with some words in it
+; comment line number 323 with some words in it
+
+; comment line number 325 with some words in it
+; comment line number 326 with some words in it
+
+; comment line number 328 with some words in it
+; comment line number 329 with some words in it
+
+; comment line number 331 with some words in it
+; comment line number 332 with some words in it
+
+; comment line number 334 with some words in it
+; comment line number 335 with some words in it
+
+; comment line number 337 with some words in it
+; comment line number 338 with some words in it
+
+; comment line number 340 with some words in it
+; comment line number 341 with some words in it
+
+; comment line number 343 with some words in it
+; comment line number 344 with some words in it
+
+; comment line number 346 with some words in it
+; comment line number 347 with some words in it
+
+; comment line number 349 with some words in it
+; comment line number 350 with some words in it
+
+; comment line number 352 with some words in it
+; comment line number 353 with some words in it
+
+; comment line number 355 with some words in it
+; comment line number 356 with some words in it
+
+; comment line number 358 with some words in it
+; comment line number 359 with some words in it
+
+; comment line number 361 with some words in it
+; comment line number 362 with some words in it
+
+; comment line number 364 with some words in it
+; comment line number 365 with some words in it
+
+; comment line number 367 with some words in it
+; comment line number 368 with some words in it
+
+; comment line number 370 with some words in it
+; comment line number 371 with some words in it
+
+; comment line number 373 with some words in it
+; comment line number 374 with some words in it
+
+; comment line number 376 with some words in it
+; comment line number 377 with some words in it
+
+; comment line number 379 with some words in it
+; comment line number 380 with some words in it
+
+; comment line number 382 with some words in it
+; comment line number 383 with some words in it
+
+; comment line number 385 with some words in it
+; comment line number 386 with some words in it
+
+; comment line number 388 with some words in it
+; comment line number 389 with some words in it
+
+; comment line number 391 with some words in it
+; comment line number 392 with some words in it
+
+; comment line number 394 with some words in it
+; comment line number 395 with some words in it
+
+; comment line number 397 with some words in it
+; comment line number 398 with some words in it
+
+; comment line number 400 with some words in it
+; comment line number 401 with some words in it
+
+; comment line number 403 with some words in it
+; comment line number 404 with some words in it
+
+; comment line number 406 with some words in it
+; comment line number 407 with some words in it
+
+; comment line number 409 with some words in it
+; comment line number 410 with some words in it
+
+; comment line number 412 with some words in it
+; comment line number 413 with some words in it
+
+; comment line number 415 with some words in it
+; comment line number 416 with some words in it
+
+; comment line number 418 with some words in it
+; comment line number 419 with some words in it
+
+; comment line number 421 with some words in it
+; comment line number 422 with some words in it
+
+; comment line number 424 with some words in it
+; comment line number 425 with some words in it
+
+; comment line number 427 with some words in it
+; comment line number 428 with some words in it
+
+; comment line number 430 with some words in it
+; comment line number 431 with some words in it
+
+; comment line number 433 with some words in it
+; comment line number 434 with some words in it
+
+; comment line number 436 with some words in it
+; comment line number 437 with some words in it
+
+; comment line number 439 with some words in it
+; comment line number 440 with some words in it
+
+; comment line number 442 with some words in it
+; comment line number 443 with some words in it
+
+; comment line number 445 with some words in it
+; comment line number 446 with some words in it
+
+; comment line number 448 with some words in it
+; comment line number 449 with some words in it
+
+; comment line number 451 with some words in it
+; comment line number 452 with some words in it
+
+; comment line number 454 with some words in it
+; comment line number 455 with some words in it
+
+; comment line number 457 with some words in it
+; comment line number 458 with some words in it
+
+; comment line number 460 with some words in it
+; comment line number 461 with some words in it
+
+; comment line number 463 with some words in it
+; comment line number 464 with some words in it
+
+; comment line number 466 with some words in it
+; comment line number 467 with some words in it
+
+; comment line number 469 with some words in it
+; comment line number 470 with some words in it
+
+; comment line number 472 with some words in it
+; comment line number 473 with some words in it
+
+; comment line number 475 with some words in it
+; comment line number 476 with some words in it
+
+; comment line number 478 with some words in it
+; comment line number 479 with some words in it
+
+; comment line number 481 with some words in it
+; comment line number 482 with some words in it
+
+; comment line number 484 with some words in it
+; comment line number 485 with some words in it
+
+; comment line number 487 with some words in it
+; comment line number 488 with some words in it
+
+; comment line number 490 with some words in it
+; comment line number 491 with some words in it
+
+; comment line number 493 with some words in it
+; comment line number 494 with some words in it
+
+; comment line number 496 with some words in it
+; comment line number 497 with some words in it
+
+; comment line number 499 with some words in it
+; comment line number 500 with some words in it
+
+; comment line number 502 with some words in it
+; comment line number 503 with some words in it
+
+; comment line number 505 with some words in it
+; comment line number 506 with some words in it
+
+; comment line number 508 with some words in it
+; comment line number 509 with some words in it
+
+; comment line number 511 with some words in it
+; comment line number 512 with some words in it
+
+; comment line number 514 with some words in it
+; comment line number 515 with some words in it
+
+; comment line number 517 with some words in it
+; comment line number 518 with some words in it
+
+; comment line number 520 with some words in it
+; comment line number 521 with some words in it
+
+; comment line number 523 with some words in it
+; comment line number 524 with some words in it
+
+; comment line number 526 with some words in it
+; comment line number 527 with some words in it
+
+; comment line number 529 with some words in it
+; comment line number 530 with some words in it
+
+; comment line number 532 with some words in it
+; comment line number 533 with some words in it
+
+; comment line number 535 with some words in it
+; comment line number 536 with some words in it
+
+; comment line number 538 with some words in it
+; comment line number 539 with some words in it
+
+; comment line number 541 with some words in it
+; comment line number 542 with some words in it
+
+; comment line number 544 with some words in it
+; comment line number 545 with some words in it
+
+; comment line number 547 with some words in it
+; comment line number 548 with some words in it
+
+; comment line number 550 with some words in it
+; comment line number 551 with some words in it
+
+; comment line number 553 with some words in it
+; comment line number 554 with some words in it
+
+; comment line number 556 with some words in it
+; comment line number 557 with some words in it
+
+; comment line number 559 with some words in it
+; comment line number 560 with some words in it
+
+; comment line number 562 with some words in it
+; comment line number 563 with some words in it
+
+; comment line number 565 with some words in it
+; comment line number 566 with some words in it
+
+; comment line number 568 with some words in it
+; comment line number 569 with some words in it
+
+; comment line number 571 with some words in it
+; comment line number 572 with some words in it
+
+; comment line number 574 with some words in it
+; comment line number 575 with some words in it
+
+; comment line number 577 with some words in it
+; comment line number 578 with some words in it
+
+; comment line number 580 with some words in it
+; comment line number 581 with some words in it
+
+; comment line number 583 with some words in it
+; comment line number 584 with some words in it
+
+; comment line number 586 with some words in it
+; comment line number 587 with some words in it
+
+; comment line number 589 with some words in it
+; comment line number 590 with some words in it
+
+; comment line number 592 with some words in it
+; comment line number 593 with some words in it
+
+; comment line number 595 with some words in it
+; comment line number 596 with some words in it
+
+; comment line number 598 with some words in it
+; comment line number 599 with some words in it
+
+; comment line number 601 with some words in it
+; comment line number 602 with some words in it
+
+; comment line number 604 with some words in it
+; comment line number 605 with some words in it
+
+; comment line number 607 with some words in it
+; comment line number 608 with some words in it
+
+; comment line number 610 with some words in it
+; comment line number 611 with some words in it
+
+; comment line number 613 with some words in it
+; comment line number 614 with some words in it
+
+; comment line number 616 with some words in it
+; comment line number 617 with some words in it
+
+; comment line number 619 with some words in it
+; comment line number 620 with some words in it
+
+; comment line number 622 with some words in it
+; comment line number 623 with some words in it
+
+; comment line number 625 with some words in it
+; comment line number 626 with some words in it
+
+; comment line number 628 with some words in it
+; comment line number 629 with some words in it
+
+; comment line number 631 with some words in it
+; comment line number 632 with some words in it
+
+; comment line number 634 with some words in it
+; comment line number 635 with some words in it
+
+; comment line number 637 with some words in it
+; comment line number 638 with some words in it
+
+; comment line number 640 with some words in it
+; comment line number 641 with some words in it
+
+; comment line number 643 with some words in it
+; comment line number 644 with some words in it
+
+; comment line number 646 with some words in it
+; comment line number 647 with some words in it
+
+; comment line number 649 with some words in it
+; comment line number 650 with some words in it
+
+; comment line number 652 with some words in it
+; comment line number 653 with some words in it
+
+; comment line number 655 with some words in it
+; comment line number 656 with some words in it
+
+; comment line number 658 with some words in it
+; comment line number 659 with some words in it
+
+; comment line number 661 with some words in it
+; comment line number 662 with some words in it
+
+; comment line number 664 with some words in it
+; comment line number 665 with some words in it
+
+; comment line number 667 with some words in it
+; comment line number 668 with some words in it
+
+; comment line number 670 with some words in it
+; comment line number 671 with some words in it
+
+; comment line number 673 with some words in it
+; comment line number 674 with some words in it
+
+; comment line number 676 with some words in it
+; comment line number 677 with some words in it
+
+; comment line number 679 with some words in it
+; comment line number 680 with some words in it
+
+; comment line number 682 with some words in it
+; comment line number 683 with some words in it
+
+; comment line number 685 with some words in it
+; comment line number 686 with some words in it
+
+; comment line number 688 with some words in it
+; comment line number 689 with some words in it
+
+; comment line number 691 with some words in it
+; comment line number 692 with some words in it
+
+; comment line number 694 with some words in it
+; comment line number 695 with some words in it
+
+; comment line number 697 with some words in it
+; comment line number 698 with some words in it
+
+; comment line number 700 with some words in it
+; comment line number 701 with some words in it
+
+; comment line number 703 with some words in it
+; comment line number 704 with some words in it
+
+; comment line number 706 with some words in it
+; comment line number 707 with some words in it
+
+; comment line number 709 with some words in it
+; comment line number 710 with some words in it
+
+; comment line number 712 with some words in it
+; comment line number 713 with some words in it
+
+; comment line number 715 with some words in it
+; comment line number 716 with some words in it
+
+; comment line number 718 with some words in it
+; comment line number 719 with some words in it
+
+; comment line number 721 with some words in it
+; comment line number 722 with some words in it
+
+; comment line number 724 with some words in it
+; comment line number 725 with some words in it
+
+; comment line number 727 with some words in it
+; comment line number 728 with some words in it
+
+; comment line number 730 with some words in it
+; comment line number 731 with some words in it
+
+; comment line number 733 with some words in it
+; comment line number 734 with some words in it
+
+; comment line number 736 with some words in it
+; comment line number 737 with some words in it
+
+; comment line number 739 with some words in it
+; comment line number 740 with some words in it
+
+; comment line number 742 with some words in it
+; comment line number 743 with some words in it
+
+; comment line number 745 with some words in it
+; comment line number 746 with some words in it
+
+; comment line number 748 with some words in it
+; comment line number 749 with some words in it
+
+; comment line number 751 with some words in it
+; comment line number 752 with some words in it
+
+; comment line number 754 with some words in it
+; comment line number 755 with some words in it
+
+; comment line number 757 with some words in it
+; comment line number 758 with some words in it
+
+; comment line number 760 with some words in it
+; comment line number 761 with some words in it
+
+; comment line number 763 with some words in it
+; comment line number 764 with some words in it
+
+; comment line number 766 with some words in it
+; comment line number 767 with some words in it
+
+; comment line number 769 with some words in it
+; comment line number 770 with some words in it
+
+; comment line number 772 with some words in it
+; comment line number 773 with some words in it
+
+; comment line number 775 with some words in it
+; comment line number 776 with some words in it
+
+; comment line number 778 with some words in it
+; comment line number 779 with some words in it
+
+; comment line number 781 with some words in it
+; comment line number 782 with some words in it
+
+; comment line number 784 with some words in it
+; comment line number 785 with some words in it
+
+; comment line number 787 with some words in it
+; comment line number 788 with some words in it
+
+; comment line number 790 with some words in it
+; comment line number 791 with some words in it
+
+; comment line number 793 with some words in it
+; comment line number 794 with some words in it
+
+; comment line number 796 with some words in it
+; comment line number 797 with some words in it
+
+; comment line number 799 with some words in it
+; comment line number 800 with some words in it
+
+; comment line number 802 with some words in it
+; comment line number 803 with some words in it
+
+; comment line number 805 with some words in it
+; comment line number 806 with some words in it
+
+; comment line number 808 with some words in it
+; comment line number 809 with some words in it
+
+; comment line number 811 with some words in it
+; comment line number 812 with some words in it
+
+; comment line number 814 with some words in it
+; comment line number 815 with some words in it
+
+; comment line number 817 with some words in it
+; comment line number 818 with some words in it
+
+; comment line number 820 with some words in it
+; comment line number 821 with some words in it
+
+; comment line number 823 with some words in it
+; comment line number 824 with some words in it
+
+; comment line number 826 with some words in it
+; comment line number 827 with some words in it
+
+; comment line number 829 with some words in it
+; comment line number 830 with some words in it
+
+; comment line number 832 with some words in it
+; comment line number 833 with some words in it
+
+; comment line number 835 with some words in it
+; comment line number 836 with some words in it
+
+; comment line number 838 with some words in it
+; comment line number 839 with some words in it
+
+; comment line number 841 with some words in it
+; comment line number 842 with some words in it
+
+; comment line number 844 with some words in it
+; comment line number 845 with some words in it
+
+; comment line number 847 with some words in it
+; comment line number 848 with some words in it
+
+; comment line number 850 with some words in it
+; comment line number 851 with some words in it
+
+; comment line number 853 with some words in it
+; comment line number 854 with some words in it
+
+; comment line number 856 with some words in it
+; comment line number 857 with some words in it
+
+; comment line number 859 with some words in it
+; comment line number 860 with some words in it
+
+; comment line number 862 with some words in it
+; comment line number 863 with some words in it
+
+; comment line number 865 with some words in it
+; comment line number 866 with some words in it
+
+; comment line number 868 with some words in it
+; comment line number 869 with some words in it
+
+; comment line number 871 with some words in it
+; comment line number 872 with some words in it
+
+; comment line number 874 with some words in it
+; comment line number 875 with some words in it
+
+; comment line number 877 with some words in it
+; comment line number 878 with some words in it
+
+; comment line number 880 with some words in it
+; comment line number 881 with some words in it
+
+; comment line number 883 with some words in it
+; comment line number 884 with some words in it
+
+; comment line number 886 with some words in it
+; comment line number 887 with some words in it
+
+; comment line number 889 with some words in it
+; comment line number 890 with some words in it
+
+; comment line number 892 with some words in it
+; comment line number 893 with some words in it
+
+; comment line number 895 with some words in it
+; comment line number 896 with some words in it
+
+; comment line number 898 with some words in it
+; comment line number 899 with some words in it
+
+; comment line number 901 with some words in it
+; comment line number 902 with some words in it
+
+; comment line number 904 with some words in it
+; comment line number 905 with some words in it
+
+; comment line number 907 with some words in it
+; comment line number 908 with some words in it
+
+; comment line number 910 with some words in it
+; comment line number 911 with some words in it
+
+; comment line number 913 with some words in it
+; comment line number 914 with some words in it
+
+; comment line number 916 with some words in it
+; comment line number 917 with some words in it
+
+; comment line number 919 with some words in it
+; comment line number 920 with some words in it
+
+; comment line number 922 with some words in it
+; comment line number 923 with some words in it
+
+; comment line number 925 with some words in it
+; comment line number 926 with some words in it
+
+; comment line number 928 with some words in it
+; comment line number 929 with some words in it
+
+; comment line number 931 with some words in it
+; comment line number 932 with some words in it
+
+; comment line number 934 with some words in it
+; comment line number 935 with some words in it
+
+; comment line number 937 with some words in it
+; comment line number 938 with some words in it
+
+; comment line number 940 with some words in it
+; comment line number 941 with some words in it
+
+; comment line number 943 with some words in it
+; comment line number 944 with some words in it
+
+; comment line number 946 with some words in it
+; comment line number 947 with some words in it
+
+; comment line number 949 with some words in it
+; comment line number 950 with some words in it
+
+; comment line number 952 with some words in it
+; comment line number 953 with some words in it
+
+; comment line number 955 with some words in it
+; comment line number 956 with some words in it
+
+; comment line number 958 with some words in it
+; comment line number 959 with some words in it
+
+; comment line number 961 with some words in it
+; comment line number 962 with some words in it
+
+; comment line number 964 with some words in it
+; comment line number 965 with some words in it
+
+; comment line number 967 with some words in it
+; comment line number 968 with some words in it
+
+; comment line number 970 with some words in it
+; comment line number 971 with some words in it
+
+; comment line number 973 with some words in it
+; comment line number 974 with some words in it
+
+; comment line number 976 with some words in it
+; comment line number 977 with some words in it
+
+; comment line number 979 with some words in it
+; comment line number 980 with some words in it
+
+; comment line number 982 with some words in it
+; comment line number 983 with some words in it
+
+; comment line number 985 with some words in it
+; comment line number 986 with some words in it
+
+; comment line number 988 with some words in it
+; comment line number 989 with some words in it
+
+; comment line number 991 with some words in it
+; comment line number 992 with some words in it
+
+; comment line number 994 with some words in it
+; comment line number 995 with some words in it
+
+; comment line number 997 with some words in it
+; comment line number 998 with some words in it
+
+; comment line number 1000 with some words in it
+; comment line number 1001 with some words in it
+
+; comment line number 1003 with some words in it
+; comment line number 1004 with some words in it
+
+; comment line number 1006 with some words in it
+; comment line number 1007 with some words in it
+
+; comment line number 1009 with some words in it
+; comment line number 1010 with some words in it
+
+; comment line number 1012 with some words in it
+; comment line number 1013 with some words in it
+
+; comment line number 1015 with some words in it
+; comment line number 1016 with some words in it
+
+; comment line number 1018 with some words in it
+; comment line number 1019 with some words in it
+
+; comment line number 1021 with some words in it
+; comment line number 1022 with some words in it
+
+; comment line number 1024 with some words in it
+; comment line number 1025 with some words in it
+
+; comment line number 1027 with some words in it
+; comment line number 1028 with some words in it
+
+; comment line number 1030 with some words in it
+; comment line number 1031 with some words in it
+
+; comment line number 1033 with some words in it
+; comment line number 1034 with some words in it
+
+; comment line number 1036 with some words in it
+; comment line number 1037 with some words in it
+
+; comment line number 1039 with some words in it
+; comment line number 1040 with some words in it
+
+; comment line number 1042 with some words in it
+; comment line number 1043 with some words in it
+
+; comment line number 1045 with some words in it
+; comment line number 1046 with some words in it
+
+; comment line number 1048 with some words in it
+; comment line number 1049 with some words in it
+
+; comment line number 1051 with some words in it
+; comment line number 1052 with some words in it
+
+; comment line number 1054 with some words in it
+; comment line number 1055 with some words in it
+
+; comment line number 1057 with some words in it
+; comment line number 1058 with some words in it
+
+; comment line number 1060 with some words in it
+; comment line number 1061 with some words in it
+
+; comment line number 1063 with some words in it
+; comment line number 1064 with some words in it
+
+; comment line number 1066 with some words in it
+; comment line number 1067 with some words in it
+
+; comment line number 1069 with some words in it
+; comment line number 1070 with some words in it
+
+; comment line number 1072 with some words in it
+; comment line number 1073 with some words in it
+
+; comment line number 1075 with some words in it
+; comment line number 1076 with some words in it
+
+; comment line number 1078 with some words in it
+; comment line number 1079 with some words in it
+
+; comment line number 1081 with some words in it
+; comment line number 1082 with some words in it
+
+; comment line number 1084 with some words in it
+; comment line number 1085 with some words in it
+
+; comment line number 1087 with some words in it
+; comment line number 1088 with some words in it
+
+; comment line number 1090 with some words in it
+; comment line number 1091 with some words in it
+
+; comment line number 1093 with some words in it
+; comment line number 1094 with some words in it
+
+; comment line number 1096 with some words in it
+; comment line number 1097 with some words in it
+
+; comment line number 1099 with some words in it
+; comment line number 1100 with some words in it
+
+; comment line number 1102 with some words in it
+; comment line number 1103 with some words in it
+
+; comment line number 1105 with some words in it
+; comment line number 1106 with some words in it
+
+; comment line number 1108 with some words in it
+; comment line number 1109 with some words in it
+
+; comment line number 1111 with some words in it
+; comment line number 1112 with some words in it
+
+; comment line number 1114 with some words in it
+; comment line number 1115 with some words in it
+
+; comment line number 1117 with some words in it
+; comment line number 1118 with some words in it
+
+; comment line number 1120 with some words in it
+; comment line number 1121 with some words in it
+
+; comment line number 1123 with some words in it
+; comment line number 1124 with some words in it
+
+; comment line number 1126 with some words in it
+; comment line number 1127 with some words in it
+
+; comment line number 1129 with some words in it
+; comment line number 1130 with some words in it
+
+; comment line number 1132 with some words in it
+; comment line number 1133 with some words in it
+
+; comment line number 1135 with some words in it
+; comment line number 1136 with some words in it
+
+; comment line number 1138 with some words in it
+; comment line number 1139 with some words in it
+
+; comment line number 1141 with some words in it
+; comment line number 1142 with some words in it
+
+; comment line number 1144 with some words in it
+; comment line number 1145 with some words in it
+
+; comment line number 1147 with some words in it
+; comment line number 1148 with some words in it
+
+; comment line number 1150 with some words in it
+; comment line number 1151 with some words in it
+
+; comment line number 1153 with some words in it
+; comment line number 1154 with some words in it
+
+; comment line number 1156 with some words in it
+; comment line number 1157 with some words in it
+
+; comment line number 1159 with some words in it
+; comment line number 1160 with some words in it
+
+; comment line number 1162 with some words in it
+; comment line number 1163 with some words in it
+
+; comment line number 1165 with some words in it
+; comment line number 1166 with some words in it
+
+; comment line number 1168 with some words in it
+; comment line number 1169 with some words in it
+
+; comment line number 1171 with some words in it
+; comment line number 1172 with some words in it
+
+; comment line number 1174 with some words in it
+; comment line number 1175 with some words in it
+
+; comment line number 1177 with some words in it
+; comment line number 1178 with some words in it
+
+; comment line number 1180 with some words in it
+; comment line number 1181 with some words in it
+
+; comment line number 1183 with some words in it
+; comment line number 1184 with some words in it
+
+; comment line number 1186 with some words in it
+; comment line number 1187 with some words in it
+
+; comment line number 1189 with some words in it
+; comment line number 1190 with some words in it
+
+; comment line number 1192 with some words in it
+; comment line number 1193 with some words in it
+
+; comment line number 1195 with some words in it
+; comment line number 1196 with some words in it
+
+; comment line number 1198 with some words in it
+; comment line number 1199 with some words in it
+
+; comment line number 1201 with some words in it
+; comment line number 1202 with some words in it
+
+; comment line number 1204 with some words in it
+; comment line number 1205 with some words in it
+
+; comment line number 1207 with some words in it
+; comment line number 1208 with some words in it
+
+; comment line number 1210 with some words in it
+; comment line number 1211 with some words in it
+
+; comment line number 1213 with some words in it
+; comment line number 1214 with some words in it
+
+; comment line number 1216 with some words in it
+; comment line number 1217 with some words in it
+
+; comment line number 1219 with some words in it
+; comment line number 1220 with some words in it
+
+; comment line number 1222 with some words in it
+; comment line number 1223 with some words in it
+
+; comment line number 1225 with some words in it
+; comment line number 1226 with some words in it
+
+; comment line number 1228 with some words in it
+; comment line number 1229 with some words in it
+
+; comment line number 1231 with some words in it
+; comment line number 1232 with some words in it
+
+; comment line number 1234 with some words in it
+; comment line number 1235 with some words in it
+
+; comment line number 1237 with some words in it
+; comment line number 1238 with some words in it
+
+; comment line number 1240 with some words in it
+; comment line number 1241 with some words in it
+
+; comment line number 1243 with some words in it
+; comment line number 1244 with some words in it
+
+; comment line number 1246 with some words in it
+; comment line number 1247 with some words in it
+
+; comment line number 1249 with some words in it
+; comment line number 1250 with some words in it
+
+; comment line number 1252 with some words in it
+; comment line number 1253 with some words in it
+
+; comment line number 1255 with some words in it
+; comment line number 1256 with some words in it
+
+; comment line number 1258 with some words in it
+; comment line number 1259 with some words in it
+
+; comment line number 1261 with some words in it
+; comment line number 1262 with some words in it
+
+; comment line number 1264 with some words in it
+; comment line number 1265 with some words in it
+
+; comment line number 1267 with some words in it
+; comment line number 1268 with some words in it
+
+; comment line number 1270 with some words in it
+; comment line number 1271 with some words in it
+
+; comment line number 1273 with some words in it
+; comment line number 1274 with some words in it
+
+; comment line number 1276 with some words in it
+; comment line number 1277 with some words in it
+
+; comment line number 1279 with some words in it
+; comment line number 1280 with some words in it
+
+; comment line number 1282 with some words in it
+; comment line number 1283 with some words in it
+
+; comment line number 1285 with some words in it
+; comment line number 1286 with some words in it
+
+; comment line number 1288 with some words in it
+; comment line number 1289 with some words in it
+
+; comment line number 1291 with some words in it
+; comment line number 1292 with some words in it
+
+; comment line number 1294 with some words in it
+; comment line number 1295 with some words in it
+
+; comment line number 1297 with some words in it
+; comment line number 1298 with some words in it
+
+; comment line number 1300 with some words in it
+; comment line number 1301 with some words in it
+
+; comment line number 1303 with some words in it
+; comment line number 1304 with some words in it
+
+; comment line number 1306 with some words in it
+; comment line number 1307 with some words in it
+
+; comment line number 1309 with some words in it
+; comment line number 1310 with some words in it
+
+; comment line number 1312 with some words in it
+; comment line number 1313 with some words in it
+
+; comment line number 1315 with some words in it
+; comment line number 1316 with some words in it
+
+; comment line number 1318 with some words in it
+; comment line number 1319 with some words in it
+
+; comment line number 1321 with some words in it
+; comment line number 1322 with some words in it
+
+; comment line number 1324 with some words in it
+; comment line number 1325 with some words in it
+
+; comment line number 1327 with some words in it
+; comment line number 1328 with some words in it
+
+; comment line number 1330 with some words in it
+; comment line number 1331 with some words in it
+
+; comment line number 1333 with some words in it
+; comment line number 1334 with some words in it
+
+; comment line number 1336 with some words in it
+; comment line number 1337 with some words in it
+
+; comment line number 1339 with some words in it
+; comment line number 1340 with some words in it
+
+; comment line number 1342 with some words in it
+; comment line number 1343 with some words in it
+
+; comment line number 1345 with some words in it
+; comment line number 1346 with some words in it
+
+; comment line number 1348 with some words in it
+; comment line number 1349 with some words in it
+
+; comment line number 1351 with some words in it
+; comment line number 1352 with some words in it
+
+; comment line number 1354 with some words in it
+; comment line number 1355 with some words in it
+
+; comment line number 1357 with some words in it
+; comment line number 1358 with some words in it
+
+; comment line number 1360 with some words in it
+; comment line number 1361 with some words in it
+
+; comment line number 1363 with some words in it
+; comment line number 1364 with some words in it
+
+; comment line number 1366 with some words in it
+; comment line number 1367 with some words in it
+
+; comment line number 1369 with some words in it
+; comment line number 1370 with some words in it
+
+; comment line number 1372 with some words in it
+; comment line number 1373 with some words in it
+
+; comment line number 1375 with some words in it
+; comment line number 1376 with some words in it
+
+; comment line number 1378 with some words in it
+; comment line number 1379 with some words in it
+
+; comment line number 1381 with some words in it
+; comment line number 1382 with some words in it
+
+; comment line number 1384 with some words in it
+; comment line number 1385 with some words in it
+
+; comment line number 1387 with some words in it
+; comment line number 1388 with some words in it
+
+; comment line number 1390 with some words in it
+; comment line number 1391 with some words in it
+
+; comment line number 1393 with some words in it
+; comment line number 1394 with some words in it
+
+; comment line number 1396 with some words in it
+; comment line number 1397 with some words in it
+
+; comment line number 1399 with some words in it
+; comment line number 1400 with some words in it
+
+; comment line number 1402 with some words in it
+; comment line number 1403 with some words in it
+
+; comment line number 1405 with some words in it
+; comment line number 1406 with some words in it
+
+; comment line number 1408 with some words in it
+; comment line number 1409 with some words in it
+
+; comment line number 1411 with some words in it
+; comment line number 1412 with some words in it
+
+; comment line number 1414 with some words in it
+; comment line number 1415 with some words in it
+
+; comment line number 1417 with some words in it
+; comment line number 1418 with some words in it
+
+; comment line number 1420 with some words in it
+; comment line number 1421 with some words in it
+
+; comment line number 1423 with some words in it
+; comment line number 1424 with some words in it
+
+; comment line number 1426 with some words in it
+; comment line number 1427 with some words in it
+
+; comment line number 1429 with some words in it
+; comment line number 1430 with some words in it
+
+; comment line number 1432 with some words in it
+; comment line number 1433 with some words in it
+
+; comment line number 1435 with some words in it
+; comment line number 1436 with some words in it
+
+; comment line number 1438 with some words in it
+; comment line number 1439 with some words in it
+
+; comment line number 1441 with some words in it
+; comment line number 1442 with some words in it
+
+; comment line number 1444 with some words in it
+; comment line number 1445 with some words in it
+
+; comment line number 1447 with some words in it
+; comment line number 1448 with some words in it
+
+; comment line number 1450 with some words in it
+; comment line number 1451 with some words in it
+
+; comment line number 1453 with some words in it
+; comment line number 1454 with some words in it
+
+; comment line number 1456 with some words in it
+; comment line number 1457 with some words in it
+
+; comment line number 1459 with some words in it
+; comment line number 1460 with some words in it
+
+; comment line number 1462 with some words in it
+; comment line number 1463 with some words in it
+
+; comment line number 1465 with some words in it
+; comment line number 1466 with some words in it
+
+; comment line number 1468 with some words in it
+; comment line number 1469 with some words in it
+
+; comment line number 1471 with some words in it
+; comment line number 1472 with some words in it
+
+; comment line number 1474 with some words in it
+; comment line number 1475 with some words in it
+
+; comment line number 1477 with some words in it
+; comment line number 1478 with some words in it
+
+; comment line number 1480 with some words in it
+; comment line number 1481 with some words in it
+
+; comment line number 1483 with some words in it
+; comment line number 1484 with some words in it
+
+; comment line number 1486 with some words in it
+; comment line number 1487 with some words in it
+
+; comment line number 1489 with some words in it
+; comment line number 1490 with some words in it
+
+; comment line number 1492 with some words in it
+; comment line number 1493 with some words in it
+
+; comment line number 1495 with some words in it
+; comment line number 1496 with some words in it
+
+; comment line number 1498 with some words in it
+; comment line number 1499 with some words in it
+MAIN: stop
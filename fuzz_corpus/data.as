@@ -0,0 +1,73 @@
+MAIN: stop
+D0: .data -1000, -1000, -1000, -1000, -1000, -1000, -1000, -1000
+D1: .data -1000, -999, -998, -997, -996, -995, -994, -993
+D2: .data -1000, -998, -996, -994, -992, -990, -988, -986
+D3: .data -1000, -997, -994, -991, -988, -985, -982, -979
+D4: .data -1000, -996, -992, -988, -984, -980, -976, -972
+D5: .data -1000, -995, -990, -985, -980, -975, -970, -965
+D6: .data -1000, -994, -988, -982, -976, -970, -964, -958
+D7: .data -1000, -993, -986, -979, -972, -965, -958, -951
+D8: .data -1000, -992, -984, -976, -968, -960, -952, -944
+D9: .data -1000, -991, -982, -973, -964, -955, -946, -937
+D10: .data -1000, -990, -980, -970, -960, -950, -940, -930
+D11: .data -1000, -989, -978, -967, -956, -945, -934, -923
+D12: .data -1000, -988, -976, -964, -952, -940, -928, -916
+D13: .data -1000, -987, -974, -961, -948, -935, -922, -909
+D14: .data -1000, -986, -972, -958, -944, -930, -916, -902
+D15: .data -1000, -985, -970, -955, -940, -925, -910, -895
+D16: .data -1000, -984, -968, -952, -936, -920, -904, -888
+D17: .data -1000, -983, -966, -949, -932, -915, -898, -881
+D18: .data -1000, -982, -964, -946, -928, -910, -892, -874
+D19: .data -1000, -981, -962, -943, -924, -905, -886, -867
+D20: .data -1000, -980, -960, -940, -920, -900, -880, -860
+D21: .data -1000, -979, -958, -937, -916, -895, -874, -853
+D22: .data -1000, -978, -956, -934, -912, -890, -868, -846
+D23: .data -1000, -977, -954, -931, -908, -885, -862, -839
+D24: .data -1000, -976, -952, -928, -904, -880, -856, -832
+D25: .data -1000, -975, -950, -925, -900, -875, -850, -825
+D26: .data -1000, -974, -948, -922, -896, -870, -844, -818
+D27: .data -1000, -973, -946, -919, -892, -865, -838, -811
+D28: .data -1000, -972, -944, -916, -888, -860, -832, -804
+D29: .data -1000, -971, -942, -913, -884, -855, -826, -797
+D30: .data -1000, -970, -940, -910, -880, -850, -820, -790
+D31: .data -1000, -969, -938, -907, -876, -845, -814, -783
+D32: .data -1000, -968, -936, -904, -872, -840, -808, -776
+D33: .data -1000, -967, -934, -901, -868, -835, -802, -769
+D34: .data -1000, -966, -932, -898, -864, -830, -796, -762
+D35: .data -1000, -965, -930, -895, -860, -825, -790, -755
+D36: .data -1000, -964, -928, -892, -856, -820, -784, -748
+D37: .data -1000, -963, -926, -889, -852, -815, -778, -741
+D38: .data -1000, -962, -924, -886, -848, -810, -772, -734
+D39: .data -1000, -961, -922, -883, -844, -805, -766, -727
+D40: .data -1000, -960, -920, -880, -840, -800, -760, -720
+D41: .data -1000, -959, -918, -877, -836, -795, -754, -713
+D42: .data -1000, -958, -916, -874, -832, -790, -748, -706
+D43: .data -1000, -957, -914, -871, -828, -785, -742, -699
+D44: .data -1000, -956, -912, -868, -824, -780, -736, -692
+D45: .data -1000, -955, -910, -865, -820, -775, -730, -685
+D46: .data -1000, -954, -908, -862, -816, -770, -724, -678
+D47: .data -1000, -953, -906, -859, -812, -765, -718, -671
+D48: .data -1000, -952, -904, -856, -808, -760, -712, -664
+D49: .data -1000, -951, -902, -853, -804, -755, -706, -657
+D50: .data -1000, -950, -900, -850, -800, -750, -700, -650
+D51: .data -1000, -949, -898, -847, -796, -745, -694, -643
+D52: .data -1000, -948, -896, -844, -792, -740, -688, -636
+D53: .data -1000, -947, -894, -841, -788, -735, -682, -629
+D54: .data -1000, -946, -892, -838, -784, -730, -676, -622
+D55: .data -1000, -945, -890, -835, -780, -725, -670, -615
+D56: .data -1000, -944, -888, -832, -776, -720, -664, -608
+D57: .data -1000, -943, -886, -829, -772, -715, -658, -601
+D58: .data -1000, -942, -884, -826, -768, -710, -652, -594
+D59: .data -1000, -941, -882, -823, -764, -705, -646, -587
+S0: .string "abcdefghijabcdefghij"
+S1: .string "abcdefghijabcdefghij"
+S2: .string "abcdefghijabcdefghij"
+S3: .string "abcdefghijabcdefghij"
+S4: .string "abcdefghijabcdefghij"
+S5: .string "abcdefghijabcdefghij"
+S6: .string "abcdefghijabcdefghij"
+S7: .string "abcdefghijabcdefghij"
+S8: .string "abcdefghijabcdefghij"
+S9: .string "abcdefghijabcdefghij"
+ .space 20
+ .fill 30, 7
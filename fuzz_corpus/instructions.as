@@ -0,0 +1,1319 @@
+MAIN: mov @r1, @r2
+ mov @r0, @r1
+; instruction 0 takes 2 words of the code image
+;
+ inc @r1
+; instruction 1 takes 2 words of the code image
+;
+ rts
+; instruction 2 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 3 takes 3 words of the code image
+;
+ prn -4
+; instruction 4 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 5 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 6 takes 2 words of the code image
+;
+ inc @r7
+; instruction 7 takes 2 words of the code image
+;
+ rts
+; instruction 8 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 9 takes 3 words of the code image
+;
+ prn -2
+; instruction 10 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 11 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 12 takes 2 words of the code image
+;
+ inc @r5
+; instruction 13 takes 2 words of the code image
+;
+ rts
+; instruction 14 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 15 takes 3 words of the code image
+;
+ prn -0
+; instruction 16 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 17 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 18 takes 2 words of the code image
+;
+ inc @r3
+; instruction 19 takes 2 words of the code image
+;
+ rts
+; instruction 20 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 21 takes 3 words of the code image
+;
+ prn -6
+; instruction 22 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 23 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 24 takes 2 words of the code image
+;
+ inc @r1
+; instruction 25 takes 2 words of the code image
+;
+ rts
+; instruction 26 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 27 takes 3 words of the code image
+;
+ prn -4
+; instruction 28 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 29 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 30 takes 2 words of the code image
+;
+ inc @r7
+; instruction 31 takes 2 words of the code image
+;
+ rts
+; instruction 32 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 33 takes 3 words of the code image
+;
+ prn -2
+; instruction 34 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 35 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 36 takes 2 words of the code image
+;
+ inc @r5
+; instruction 37 takes 2 words of the code image
+;
+ rts
+; instruction 38 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 39 takes 3 words of the code image
+;
+ prn -0
+; instruction 40 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 41 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 42 takes 2 words of the code image
+;
+ inc @r3
+; instruction 43 takes 2 words of the code image
+;
+ rts
+; instruction 44 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 45 takes 3 words of the code image
+;
+ prn -6
+; instruction 46 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 47 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 48 takes 2 words of the code image
+;
+ inc @r1
+; instruction 49 takes 2 words of the code image
+;
+ rts
+; instruction 50 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 51 takes 3 words of the code image
+;
+ prn -4
+; instruction 52 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 53 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 54 takes 2 words of the code image
+;
+ inc @r7
+; instruction 55 takes 2 words of the code image
+;
+ rts
+; instruction 56 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 57 takes 3 words of the code image
+;
+ prn -2
+; instruction 58 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 59 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 60 takes 2 words of the code image
+;
+ inc @r5
+; instruction 61 takes 2 words of the code image
+;
+ rts
+; instruction 62 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 63 takes 3 words of the code image
+;
+ prn -0
+; instruction 64 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 65 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 66 takes 2 words of the code image
+;
+ inc @r3
+; instruction 67 takes 2 words of the code image
+;
+ rts
+; instruction 68 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 69 takes 3 words of the code image
+;
+ prn -6
+; instruction 70 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 71 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 72 takes 2 words of the code image
+;
+ inc @r1
+; instruction 73 takes 2 words of the code image
+;
+ rts
+; instruction 74 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 75 takes 3 words of the code image
+;
+ prn -4
+; instruction 76 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 77 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 78 takes 2 words of the code image
+;
+ inc @r7
+; instruction 79 takes 2 words of the code image
+;
+ rts
+; instruction 80 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 81 takes 3 words of the code image
+;
+ prn -2
+; instruction 82 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 83 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 84 takes 2 words of the code image
+;
+ inc @r5
+; instruction 85 takes 2 words of the code image
+;
+ rts
+; instruction 86 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 87 takes 3 words of the code image
+;
+ prn -0
+; instruction 88 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 89 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 90 takes 2 words of the code image
+;
+ inc @r3
+; instruction 91 takes 2 words of the code image
+;
+ rts
+; instruction 92 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 93 takes 3 words of the code image
+;
+ prn -6
+; instruction 94 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 95 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 96 takes 2 words of the code image
+;
+ inc @r1
+; instruction 97 takes 2 words of the code image
+;
+ rts
+; instruction 98 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 99 takes 3 words of the code image
+;
+ prn -4
+; instruction 100 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 101 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 102 takes 2 words of the code image
+;
+ inc @r7
+; instruction 103 takes 2 words of the code image
+;
+ rts
+; instruction 104 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 105 takes 3 words of the code image
+;
+ prn -2
+; instruction 106 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 107 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 108 takes 2 words of the code image
+;
+ inc @r5
+; instruction 109 takes 2 words of the code image
+;
+ rts
+; instruction 110 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 111 takes 3 words of the code image
+;
+ prn -0
+; instruction 112 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 113 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 114 takes 2 words of the code image
+;
+ inc @r3
+; instruction 115 takes 2 words of the code image
+;
+ rts
+; instruction 116 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 117 takes 3 words of the code image
+;
+ prn -6
+; instruction 118 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 119 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 120 takes 2 words of the code image
+;
+ inc @r1
+; instruction 121 takes 2 words of the code image
+;
+ rts
+; instruction 122 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 123 takes 3 words of the code image
+;
+ prn -4
+; instruction 124 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 125 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 126 takes 2 words of the code image
+;
+ inc @r7
+; instruction 127 takes 2 words of the code image
+;
+ rts
+; instruction 128 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 129 takes 3 words of the code image
+;
+ prn -2
+; instruction 130 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 131 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 132 takes 2 words of the code image
+;
+ inc @r5
+; instruction 133 takes 2 words of the code image
+;
+ rts
+; instruction 134 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 135 takes 3 words of the code image
+;
+ prn -0
+; instruction 136 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 137 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 138 takes 2 words of the code image
+;
+ inc @r3
+; instruction 139 takes 2 words of the code image
+;
+ rts
+; instruction 140 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 141 takes 3 words of the code image
+;
+ prn -6
+; instruction 142 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 143 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 144 takes 2 words of the code image
+;
+ inc @r1
+; instruction 145 takes 2 words of the code image
+;
+ rts
+; instruction 146 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 147 takes 3 words of the code image
+;
+ prn -4
+; instruction 148 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 149 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 150 takes 2 words of the code image
+;
+ inc @r7
+; instruction 151 takes 2 words of the code image
+;
+ rts
+; instruction 152 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 153 takes 3 words of the code image
+;
+ prn -2
+; instruction 154 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 155 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 156 takes 2 words of the code image
+;
+ inc @r5
+; instruction 157 takes 2 words of the code image
+;
+ rts
+; instruction 158 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 159 takes 3 words of the code image
+;
+ prn -0
+; instruction 160 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 161 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 162 takes 2 words of the code image
+;
+ inc @r3
+; instruction 163 takes 2 words of the code image
+;
+ rts
+; instruction 164 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 165 takes 3 words of the code image
+;
+ prn -6
+; instruction 166 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 167 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 168 takes 2 words of the code image
+;
+ inc @r1
+; instruction 169 takes 2 words of the code image
+;
+ rts
+; instruction 170 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 171 takes 3 words of the code image
+;
+ prn -4
+; instruction 172 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 173 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 174 takes 2 words of the code image
+;
+ inc @r7
+; instruction 175 takes 2 words of the code image
+;
+ rts
+; instruction 176 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 177 takes 3 words of the code image
+;
+ prn -2
+; instruction 178 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 179 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 180 takes 2 words of the code image
+;
+ inc @r5
+; instruction 181 takes 2 words of the code image
+;
+ rts
+; instruction 182 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 183 takes 3 words of the code image
+;
+ prn -0
+; instruction 184 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 185 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 186 takes 2 words of the code image
+;
+ inc @r3
+; instruction 187 takes 2 words of the code image
+;
+ rts
+; instruction 188 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 189 takes 3 words of the code image
+;
+ prn -6
+; instruction 190 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 191 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 192 takes 2 words of the code image
+;
+ inc @r1
+; instruction 193 takes 2 words of the code image
+;
+ rts
+; instruction 194 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 195 takes 3 words of the code image
+;
+ prn -4
+; instruction 196 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 197 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 198 takes 2 words of the code image
+;
+ inc @r7
+; instruction 199 takes 2 words of the code image
+;
+ rts
+; instruction 200 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 201 takes 3 words of the code image
+;
+ prn -2
+; instruction 202 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 203 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 204 takes 2 words of the code image
+;
+ inc @r5
+; instruction 205 takes 2 words of the code image
+;
+ rts
+; instruction 206 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 207 takes 3 words of the code image
+;
+ prn -0
+; instruction 208 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 209 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 210 takes 2 words of the code image
+;
+ inc @r3
+; instruction 211 takes 2 words of the code image
+;
+ rts
+; instruction 212 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 213 takes 3 words of the code image
+;
+ prn -6
+; instruction 214 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 215 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 216 takes 2 words of the code image
+;
+ inc @r1
+; instruction 217 takes 2 words of the code image
+;
+ rts
+; instruction 218 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 219 takes 3 words of the code image
+;
+ prn -4
+; instruction 220 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 221 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 222 takes 2 words of the code image
+;
+ inc @r7
+; instruction 223 takes 2 words of the code image
+;
+ rts
+; instruction 224 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 225 takes 3 words of the code image
+;
+ prn -2
+; instruction 226 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 227 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 228 takes 2 words of the code image
+;
+ inc @r5
+; instruction 229 takes 2 words of the code image
+;
+ rts
+; instruction 230 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 231 takes 3 words of the code image
+;
+ prn -0
+; instruction 232 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 233 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 234 takes 2 words of the code image
+;
+ inc @r3
+; instruction 235 takes 2 words of the code image
+;
+ rts
+; instruction 236 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 237 takes 3 words of the code image
+;
+ prn -6
+; instruction 238 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 239 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 240 takes 2 words of the code image
+;
+ inc @r1
+; instruction 241 takes 2 words of the code image
+;
+ rts
+; instruction 242 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 243 takes 3 words of the code image
+;
+ prn -4
+; instruction 244 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 245 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 246 takes 2 words of the code image
+;
+ inc @r7
+; instruction 247 takes 2 words of the code image
+;
+ rts
+; instruction 248 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 249 takes 3 words of the code image
+;
+ prn -2
+; instruction 250 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 251 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 252 takes 2 words of the code image
+;
+ inc @r5
+; instruction 253 takes 2 words of the code image
+;
+ rts
+; instruction 254 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 255 takes 3 words of the code image
+;
+ prn -0
+; instruction 256 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 257 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 258 takes 2 words of the code image
+;
+ inc @r3
+; instruction 259 takes 2 words of the code image
+;
+ rts
+; instruction 260 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 261 takes 3 words of the code image
+;
+ prn -6
+; instruction 262 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 263 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 264 takes 2 words of the code image
+;
+ inc @r1
+; instruction 265 takes 2 words of the code image
+;
+ rts
+; instruction 266 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 267 takes 3 words of the code image
+;
+ prn -4
+; instruction 268 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 269 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 270 takes 2 words of the code image
+;
+ inc @r7
+; instruction 271 takes 2 words of the code image
+;
+ rts
+; instruction 272 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 273 takes 3 words of the code image
+;
+ prn -2
+; instruction 274 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 275 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 276 takes 2 words of the code image
+;
+ inc @r5
+; instruction 277 takes 2 words of the code image
+;
+ rts
+; instruction 278 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 279 takes 3 words of the code image
+;
+ prn -0
+; instruction 280 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 281 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 282 takes 2 words of the code image
+;
+ inc @r3
+; instruction 283 takes 2 words of the code image
+;
+ rts
+; instruction 284 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 285 takes 3 words of the code image
+;
+ prn -6
+; instruction 286 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 287 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 288 takes 2 words of the code image
+;
+ inc @r1
+; instruction 289 takes 2 words of the code image
+;
+ rts
+; instruction 290 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 291 takes 3 words of the code image
+;
+ prn -4
+; instruction 292 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 293 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 294 takes 2 words of the code image
+;
+ inc @r7
+; instruction 295 takes 2 words of the code image
+;
+ rts
+; instruction 296 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 297 takes 3 words of the code image
+;
+ prn -2
+; instruction 298 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 299 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 300 takes 2 words of the code image
+;
+ inc @r5
+; instruction 301 takes 2 words of the code image
+;
+ rts
+; instruction 302 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 303 takes 3 words of the code image
+;
+ prn -0
+; instruction 304 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 305 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 306 takes 2 words of the code image
+;
+ inc @r3
+; instruction 307 takes 2 words of the code image
+;
+ rts
+; instruction 308 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 309 takes 3 words of the code image
+;
+ prn -6
+; instruction 310 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 311 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 312 takes 2 words of the code image
+;
+ inc @r1
+; instruction 313 takes 2 words of the code image
+;
+ rts
+; instruction 314 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 315 takes 3 words of the code image
+;
+ prn -4
+; instruction 316 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 317 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 318 takes 2 words of the code image
+;
+ inc @r7
+; instruction 319 takes 2 words of the code image
+;
+ rts
+; instruction 320 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 321 takes 3 words of the code image
+;
+ prn -2
+; instruction 322 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 323 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 324 takes 2 words of the code image
+;
+ inc @r5
+; instruction 325 takes 2 words of the code image
+;
+ rts
+; instruction 326 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 327 takes 3 words of the code image
+;
+ prn -0
+; instruction 328 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 329 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 330 takes 2 words of the code image
+;
+ inc @r3
+; instruction 331 takes 2 words of the code image
+;
+ rts
+; instruction 332 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 333 takes 3 words of the code image
+;
+ prn -6
+; instruction 334 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 335 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 336 takes 2 words of the code image
+;
+ inc @r1
+; instruction 337 takes 2 words of the code image
+;
+ rts
+; instruction 338 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 339 takes 3 words of the code image
+;
+ prn -4
+; instruction 340 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 341 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 342 takes 2 words of the code image
+;
+ inc @r7
+; instruction 343 takes 2 words of the code image
+;
+ rts
+; instruction 344 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 345 takes 3 words of the code image
+;
+ prn -2
+; instruction 346 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 347 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 348 takes 2 words of the code image
+;
+ inc @r5
+; instruction 349 takes 2 words of the code image
+;
+ rts
+; instruction 350 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 351 takes 3 words of the code image
+;
+ prn -0
+; instruction 352 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 353 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 354 takes 2 words of the code image
+;
+ inc @r3
+; instruction 355 takes 2 words of the code image
+;
+ rts
+; instruction 356 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 357 takes 3 words of the code image
+;
+ prn -6
+; instruction 358 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 359 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 360 takes 2 words of the code image
+;
+ inc @r1
+; instruction 361 takes 2 words of the code image
+;
+ rts
+; instruction 362 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 363 takes 3 words of the code image
+;
+ prn -4
+; instruction 364 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 365 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 366 takes 2 words of the code image
+;
+ inc @r7
+; instruction 367 takes 2 words of the code image
+;
+ rts
+; instruction 368 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 369 takes 3 words of the code image
+;
+ prn -2
+; instruction 370 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 371 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 372 takes 2 words of the code image
+;
+ inc @r5
+; instruction 373 takes 2 words of the code image
+;
+ rts
+; instruction 374 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 375 takes 3 words of the code image
+;
+ prn -0
+; instruction 376 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 377 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 378 takes 2 words of the code image
+;
+ inc @r3
+; instruction 379 takes 2 words of the code image
+;
+ rts
+; instruction 380 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 381 takes 3 words of the code image
+;
+ prn -6
+; instruction 382 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 383 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 384 takes 2 words of the code image
+;
+ inc @r1
+; instruction 385 takes 2 words of the code image
+;
+ rts
+; instruction 386 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 387 takes 3 words of the code image
+;
+ prn -4
+; instruction 388 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 389 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 390 takes 2 words of the code image
+;
+ inc @r7
+; instruction 391 takes 2 words of the code image
+;
+ rts
+; instruction 392 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 393 takes 3 words of the code image
+;
+ prn -2
+; instruction 394 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 395 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 396 takes 2 words of the code image
+;
+ inc @r5
+; instruction 397 takes 2 words of the code image
+;
+ rts
+; instruction 398 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 399 takes 3 words of the code image
+;
+ prn -0
+; instruction 400 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 401 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 402 takes 2 words of the code image
+;
+ inc @r3
+; instruction 403 takes 2 words of the code image
+;
+ rts
+; instruction 404 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 405 takes 3 words of the code image
+;
+ prn -6
+; instruction 406 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 407 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 408 takes 2 words of the code image
+;
+ inc @r1
+; instruction 409 takes 2 words of the code image
+;
+ rts
+; instruction 410 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 411 takes 3 words of the code image
+;
+ prn -4
+; instruction 412 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 413 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 414 takes 2 words of the code image
+;
+ inc @r7
+; instruction 415 takes 2 words of the code image
+;
+ rts
+; instruction 416 takes 1 words of the code image
+;
+ cmp 1, @r2
+; instruction 417 takes 3 words of the code image
+;
+ prn -2
+; instruction 418 takes 2 words of the code image
+;
+ sub @r3, @r4
+; instruction 419 takes 2 words of the code image
+;
+ mov @r4, @r5
+; instruction 420 takes 2 words of the code image
+;
+ inc @r5
+; instruction 421 takes 2 words of the code image
+;
+ rts
+; instruction 422 takes 1 words of the code image
+;
+ cmp 7, @r0
+; instruction 423 takes 3 words of the code image
+;
+ prn -0
+; instruction 424 takes 2 words of the code image
+;
+ sub @r1, @r2
+; instruction 425 takes 2 words of the code image
+;
+ mov @r2, @r3
+; instruction 426 takes 2 words of the code image
+;
+ inc @r3
+; instruction 427 takes 2 words of the code image
+;
+ rts
+; instruction 428 takes 1 words of the code image
+;
+ cmp 5, @r6
+; instruction 429 takes 3 words of the code image
+;
+ prn -6
+; instruction 430 takes 2 words of the code image
+;
+ sub @r7, @r0
+; instruction 431 takes 2 words of the code image
+;
+ mov @r0, @r1
+; instruction 432 takes 2 words of the code image
+;
+ inc @r1
+; instruction 433 takes 2 words of the code image
+;
+ rts
+; instruction 434 takes 1 words of the code image
+;
+ cmp 3, @r4
+; instruction 435 takes 3 words of the code image
+;
+ prn -4
+; instruction 436 takes 2 words of the code image
+;
+ sub @r5, @r6
+; instruction 437 takes 2 words of the code image
+;
+ mov @r6, @r7
+; instruction 438 takes 2 words of the code image
+;
+ stop
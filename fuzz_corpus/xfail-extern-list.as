@@ -0,0 +1,1001 @@
+.extern E0
+.extern E1
+.extern E2
+.extern E3
+.extern E4
+.extern E5
+.extern E6
+.extern E7
+.extern E8
+.extern E9
+.extern E10
+.extern E11
+.extern E12
+.extern E13
+.extern E14
+.extern E15
+.extern E16
+.extern E17
+.extern E18
+.extern E19
+.extern E20
+.extern E21
+.extern E22
+.extern E23
+.extern E24
+.extern E25
+.extern E26
+.extern E27
+.extern E28
+.extern E29
+.extern E30
+.extern E31
+.extern E32
+.extern E33
+.extern E34
+.extern E35
+.extern E36
+.extern E37
+.extern E38
+.extern E39
+.extern E40
+.extern E41
+.extern E42
+.extern E43
+.extern E44
+.extern E45
+.extern E46
+.extern E47
+.extern E48
+.extern E49
+.extern E50
+.extern E51
+.extern E52
+.extern E53
+.extern E54
+.extern E55
+.extern E56
+.extern E57
+.extern E58
+.extern E59
+.extern E60
+.extern E61
+.extern E62
+.extern E63
+.extern E64
+.extern E65
+.extern E66
+.extern E67
+.extern E68
+.extern E69
+.extern E70
+.extern E71
+.extern E72
+.extern E73
+.extern E74
+.extern E75
+.extern E76
+.extern E77
+.extern E78
+.extern E79
+.extern E80
+.extern E81
+.extern E82
+.extern E83
+.extern E84
+.extern E85
+.extern E86
+.extern E87
+.extern E88
+.extern E89
+.extern E90
+.extern E91
+.extern E92
+.extern E93
+.extern E94
+.extern E95
+.extern E96
+.extern E97
+.extern E98
+.extern E99
+.extern E100
+.extern E101
+.extern E102
+.extern E103
+.extern E104
+.extern E105
+.extern E106
+.extern E107
+.extern E108
+.extern E109
+.extern E110
+.extern E111
+.extern E112
+.extern E113
+.extern E114
+.extern E115
+.extern E116
+.extern E117
+.extern E118
+.extern E119
+.extern E120
+.extern E121
+.extern E122
+.extern E123
+.extern E124
+.extern E125
+.extern E126
+.extern E127
+.extern E128
+.extern E129
+.extern E130
+.extern E131
+.extern E132
+.extern E133
+.extern E134
+.extern E135
+.extern E136
+.extern E137
+.extern E138
+.extern E139
+.extern E140
+.extern E141
+.extern E142
+.extern E143
+.extern E144
+.extern E145
+.extern E146
+.extern E147
+.extern E148
+.extern E149
+.extern E150
+.extern E151
+.extern E152
+.extern E153
+.extern E154
+.extern E155
+.extern E156
+.extern E157
+.extern E158
+.extern E159
+.extern E160
+.extern E161
+.extern E162
+.extern E163
+.extern E164
+.extern E165
+.extern E166
+.extern E167
+.extern E168
+.extern E169
+.extern E170
+.extern E171
+.extern E172
+.extern E173
+.extern E174
+.extern E175
+.extern E176
+.extern E177
+.extern E178
+.extern E179
+.extern E180
+.extern E181
+.extern E182
+.extern E183
+.extern E184
+.extern E185
+.extern E186
+.extern E187
+.extern E188
+.extern E189
+.extern E190
+.extern E191
+.extern E192
+.extern E193
+.extern E194
+.extern E195
+.extern E196
+.extern E197
+.extern E198
+.extern E199
+.extern E200
+.extern E201
+.extern E202
+.extern E203
+.extern E204
+.extern E205
+.extern E206
+.extern E207
+.extern E208
+.extern E209
+.extern E210
+.extern E211
+.extern E212
+.extern E213
+.extern E214
+.extern E215
+.extern E216
+.extern E217
+.extern E218
+.extern E219
+.extern E220
+.extern E221
+.extern E222
+.extern E223
+.extern E224
+.extern E225
+.extern E226
+.extern E227
+.extern E228
+.extern E229
+.extern E230
+.extern E231
+.extern E232
+.extern E233
+.extern E234
+.extern E235
+.extern E236
+.extern E237
+.extern E238
+.extern E239
+.extern E240
+.extern E241
+.extern E242
+.extern E243
+.extern E244
+.extern E245
+.extern E246
+.extern E247
+.extern E248
+.extern E249
+.extern E250
+.extern E251
+.extern E252
+.extern E253
+.extern E254
+.extern E255
+.extern E256
+.extern E257
+.extern E258
+.extern E259
+.extern E260
+.extern E261
+.extern E262
+.extern E263
+.extern E264
+.extern E265
+.extern E266
+.extern E267
+.extern E268
+.extern E269
+.extern E270
+.extern E271
+.extern E272
+.extern E273
+.extern E274
+.extern E275
+.extern E276
+.extern E277
+.extern E278
+.extern E279
+.extern E280
+.extern E281
+.extern E282
+.extern E283
+.extern E284
+.extern E285
+.extern E286
+.extern E287
+.extern E288
+.extern E289
+.extern E290
+.extern E291
+.extern E292
+.extern E293
+.extern E294
+.extern E295
+.extern E296
+.extern E297
+.extern E298
+.extern E299
+.extern E300
+.extern E301
+.extern E302
+.extern E303
+.extern E304
+.extern E305
+.extern E306
+.extern E307
+.extern E308
+.extern E309
+.extern E310
+.extern E311
+.extern E312
+.extern E313
+.extern E314
+.extern E315
+.extern E316
+.extern E317
+.extern E318
+.extern E319
+.extern E320
+.extern E321
+.extern E322
+.extern E323
+.extern E324
+.extern E325
+.extern E326
+.extern E327
+.extern E328
+.extern E329
+.extern E330
+.extern E331
+.extern E332
+.extern E333
+.extern E334
+.extern E335
+.extern E336
+.extern E337
+.extern E338
+.extern E339
+.extern E340
+.extern E341
+.extern E342
+.extern E343
+.extern E344
+.extern E345
+.extern E346
+.extern E347
+.extern E348
+.extern E349
+.extern E350
+.extern E351
+.extern E352
+.extern E353
+.extern E354
+.extern E355
+.extern E356
+.extern E357
+.extern E358
+.extern E359
+.extern E360
+.extern E361
+.extern E362
+.extern E363
+.extern E364
+.extern E365
+.extern E366
+.extern E367
+.extern E368
+.extern E369
+.extern E370
+.extern E371
+.extern E372
+.extern E373
+.extern E374
+.extern E375
+.extern E376
+.extern E377
+.extern E378
+.extern E379
+.extern E380
+.extern E381
+.extern E382
+.extern E383
+.extern E384
+.extern E385
+.extern E386
+.extern E387
+.extern E388
+.extern E389
+.extern E390
+.extern E391
+.extern E392
+.extern E393
+.extern E394
+.extern E395
+.extern E396
+.extern E397
+.extern E398
+.extern E399
+.extern E400
+.extern E401
+.extern E402
+.extern E403
+.extern E404
+.extern E405
+.extern E406
+.extern E407
+.extern E408
+.extern E409
+.extern E410
+.extern E411
+.extern E412
+.extern E413
+.extern E414
+.extern E415
+.extern E416
+.extern E417
+.extern E418
+.extern E419
+.extern E420
+.extern E421
+.extern E422
+.extern E423
+.extern E424
+.extern E425
+.extern E426
+.extern E427
+.extern E428
+.extern E429
+.extern E430
+.extern E431
+.extern E432
+.extern E433
+.extern E434
+.extern E435
+.extern E436
+.extern E437
+.extern E438
+.extern E439
+.extern E440
+.extern E441
+.extern E442
+.extern E443
+.extern E444
+.extern E445
+.extern E446
+.extern E447
+.extern E448
+.extern E449
+.extern E450
+.extern E451
+.extern E452
+.extern E453
+.extern E454
+.extern E455
+.extern E456
+.extern E457
+.extern E458
+.extern E459
+.extern E460
+.extern E461
+.extern E462
+.extern E463
+.extern E464
+.extern E465
+.extern E466
+.extern E467
+.extern E468
+.extern E469
+.extern E470
+.extern E471
+.extern E472
+.extern E473
+.extern E474
+.extern E475
+.extern E476
+.extern E477
+.extern E478
+.extern E479
+.extern E480
+.extern E481
+.extern E482
+.extern E483
+.extern E484
+.extern E485
+.extern E486
+.extern E487
+.extern E488
+.extern E489
+.extern E490
+.extern E491
+.extern E492
+.extern E493
+.extern E494
+.extern E495
+.extern E496
+.extern E497
+.extern E498
+.extern E499
+.extern E500
+.extern E501
+.extern E502
+.extern E503
+.extern E504
+.extern E505
+.extern E506
+.extern E507
+.extern E508
+.extern E509
+.extern E510
+.extern E511
+.extern E512
+.extern E513
+.extern E514
+.extern E515
+.extern E516
+.extern E517
+.extern E518
+.extern E519
+.extern E520
+.extern E521
+.extern E522
+.extern E523
+.extern E524
+.extern E525
+.extern E526
+.extern E527
+.extern E528
+.extern E529
+.extern E530
+.extern E531
+.extern E532
+.extern E533
+.extern E534
+.extern E535
+.extern E536
+.extern E537
+.extern E538
+.extern E539
+.extern E540
+.extern E541
+.extern E542
+.extern E543
+.extern E544
+.extern E545
+.extern E546
+.extern E547
+.extern E548
+.extern E549
+.extern E550
+.extern E551
+.extern E552
+.extern E553
+.extern E554
+.extern E555
+.extern E556
+.extern E557
+.extern E558
+.extern E559
+.extern E560
+.extern E561
+.extern E562
+.extern E563
+.extern E564
+.extern E565
+.extern E566
+.extern E567
+.extern E568
+.extern E569
+.extern E570
+.extern E571
+.extern E572
+.extern E573
+.extern E574
+.extern E575
+.extern E576
+.extern E577
+.extern E578
+.extern E579
+.extern E580
+.extern E581
+.extern E582
+.extern E583
+.extern E584
+.extern E585
+.extern E586
+.extern E587
+.extern E588
+.extern E589
+.extern E590
+.extern E591
+.extern E592
+.extern E593
+.extern E594
+.extern E595
+.extern E596
+.extern E597
+.extern E598
+.extern E599
+.extern E600
+.extern E601
+.extern E602
+.extern E603
+.extern E604
+.extern E605
+.extern E606
+.extern E607
+.extern E608
+.extern E609
+.extern E610
+.extern E611
+.extern E612
+.extern E613
+.extern E614
+.extern E615
+.extern E616
+.extern E617
+.extern E618
+.extern E619
+.extern E620
+.extern E621
+.extern E622
+.extern E623
+.extern E624
+.extern E625
+.extern E626
+.extern E627
+.extern E628
+.extern E629
+.extern E630
+.extern E631
+.extern E632
+.extern E633
+.extern E634
+.extern E635
+.extern E636
+.extern E637
+.extern E638
+.extern E639
+.extern E640
+.extern E641
+.extern E642
+.extern E643
+.extern E644
+.extern E645
+.extern E646
+.extern E647
+.extern E648
+.extern E649
+.extern E650
+.extern E651
+.extern E652
+.extern E653
+.extern E654
+.extern E655
+.extern E656
+.extern E657
+.extern E658
+.extern E659
+.extern E660
+.extern E661
+.extern E662
+.extern E663
+.extern E664
+.extern E665
+.extern E666
+.extern E667
+.extern E668
+.extern E669
+.extern E670
+.extern E671
+.extern E672
+.extern E673
+.extern E674
+.extern E675
+.extern E676
+.extern E677
+.extern E678
+.extern E679
+.extern E680
+.extern E681
+.extern E682
+.extern E683
+.extern E684
+.extern E685
+.extern E686
+.extern E687
+.extern E688
+.extern E689
+.extern E690
+.extern E691
+.extern E692
+.extern E693
+.extern E694
+.extern E695
+.extern E696
+.extern E697
+.extern E698
+.extern E699
+.extern E700
+.extern E701
+.extern E702
+.extern E703
+.extern E704
+.extern E705
+.extern E706
+.extern E707
+.extern E708
+.extern E709
+.extern E710
+.extern E711
+.extern E712
+.extern E713
+.extern E714
+.extern E715
+.extern E716
+.extern E717
+.extern E718
+.extern E719
+.extern E720
+.extern E721
+.extern E722
+.extern E723
+.extern E724
+.extern E725
+.extern E726
+.extern E727
+.extern E728
+.extern E729
+.extern E730
+.extern E731
+.extern E732
+.extern E733
+.extern E734
+.extern E735
+.extern E736
+.extern E737
+.extern E738
+.extern E739
+.extern E740
+.extern E741
+.extern E742
+.extern E743
+.extern E744
+.extern E745
+.extern E746
+.extern E747
+.extern E748
+.extern E749
+.extern E750
+.extern E751
+.extern E752
+.extern E753
+.extern E754
+.extern E755
+.extern E756
+.extern E757
+.extern E758
+.extern E759
+.extern E760
+.extern E761
+.extern E762
+.extern E763
+.extern E764
+.extern E765
+.extern E766
+.extern E767
+.extern E768
+.extern E769
+.extern E770
+.extern E771
+.extern E772
+.extern E773
+.extern E774
+.extern E775
+.extern E776
+.extern E777
+.extern E778
+.extern E779
+.extern E780
+.extern E781
+.extern E782
+.extern E783
+.extern E784
+.extern E785
+.extern E786
+.extern E787
+.extern E788
+.extern E789
+.extern E790
+.extern E791
+.extern E792
+.extern E793
+.extern E794
+.extern E795
+.extern E796
+.extern E797
+.extern E798
+.extern E799
+.extern E800
+.extern E801
+.extern E802
+.extern E803
+.extern E804
+.extern E805
+.extern E806
+.extern E807
+.extern E808
+.extern E809
+.extern E810
+.extern E811
+.extern E812
+.extern E813
+.extern E814
+.extern E815
+.extern E816
+.extern E817
+.extern E818
+.extern E819
+.extern E820
+.extern E821
+.extern E822
+.extern E823
+.extern E824
+.extern E825
+.extern E826
+.extern E827
+.extern E828
+.extern E829
+.extern E830
+.extern E831
+.extern E832
+.extern E833
+.extern E834
+.extern E835
+.extern E836
+.extern E837
+.extern E838
+.extern E839
+.extern E840
+.extern E841
+.extern E842
+.extern E843
+.extern E844
+.extern E845
+.extern E846
+.extern E847
+.extern E848
+.extern E849
+.extern E850
+.extern E851
+.extern E852
+.extern E853
+.extern E854
+.extern E855
+.extern E856
+.extern E857
+.extern E858
+.extern E859
+.extern E860
+.extern E861
+.extern E862
+.extern E863
+.extern E864
+.extern E865
+.extern E866
+.extern E867
+.extern E868
+.extern E869
+.extern E870
+.extern E871
+.extern E872
+.extern E873
+.extern E874
+.extern E875
+.extern E876
+.extern E877
+.extern E878
+.extern E879
+.extern E880
+.extern E881
+.extern E882
+.extern E883
+.extern E884
+.extern E885
+.extern E886
+.extern E887
+.extern E888
+.extern E889
+.extern E890
+.extern E891
+.extern E892
+.extern E893
+.extern E894
+.extern E895
+.extern E896
+.extern E897
+.extern E898
+.extern E899
+.extern E900
+.extern E901
+.extern E902
+.extern E903
+.extern E904
+.extern E905
+.extern E906
+.extern E907
+.extern E908
+.extern E909
+.extern E910
+.extern E911
+.extern E912
+.extern E913
+.extern E914
+.extern E915
+.extern E916
+.extern E917
+.extern E918
+.extern E919
+.extern E920
+.extern E921
+.extern E922
+.extern E923
+.extern E924
+.extern E925
+.extern E926
+.extern E927
+.extern E928
+.extern E929
+.extern E930
+.extern E931
+.extern E932
+.extern E933
+.extern E934
+.extern E935
+.extern E936
+.extern E937
+.extern E938
+.extern E939
+.extern E940
+.extern E941
+.extern E942
+.extern E943
+.extern E944
+.extern E945
+.extern E946
+.extern E947
+.extern E948
+.extern E949
+.extern E950
+.extern E951
+.extern E952
+.extern E953
+.extern E954
+.extern E955
+.extern E956
+.extern E957
+.extern E958
+.extern E959
+.extern E960
+.extern E961
+.extern E962
+.extern E963
+.extern E964
+.extern E965
+.extern E966
+.extern E967
+.extern E968
+.extern E969
+.extern E970
+.extern E971
+.extern E972
+.extern E973
+.extern E974
+.extern E975
+.extern E976
+.extern E977
+.extern E978
+.extern E979
+.extern E980
+.extern E981
+.extern E982
+.extern E983
+.extern E984
+.extern E985
+.extern E986
+.extern E987
+.extern E988
+.extern E989
+.extern E990
+.extern E991
+.extern E992
+.extern E993
+.extern E994
+.extern E995
+.extern E996
+.extern E997
+.extern E998
+.extern E999
+ stop
@@ -0,0 +1,451 @@
+.extern E0
+.extern E1
+.extern E2
+.extern E3
+.extern E4
+.extern E5
+.extern E6
+.extern E7
+.extern E8
+.extern E9
+.extern E10
+.extern E11
+.extern E12
+.extern E13
+.extern E14
+.extern E15
+.extern E16
+.extern E17
+.extern E18
+.extern E19
+.extern E20
+.extern E21
+.extern E22
+.extern E23
+.extern E24
+.extern E25
+.extern E26
+.extern E27
+.extern E28
+.extern E29
+.extern E30
+.extern E31
+.extern E32
+.extern E33
+.extern E34
+.extern E35
+.extern E36
+.extern E37
+.extern E38
+.extern E39
+.extern E40
+.extern E41
+.extern E42
+.extern E43
+.extern E44
+.extern E45
+.extern E46
+.extern E47
+.extern E48
+.extern E49
+.extern E50
+.extern E51
+.extern E52
+.extern E53
+.extern E54
+.extern E55
+.extern E56
+.extern E57
+.extern E58
+.extern E59
+.extern E60
+.extern E61
+.extern E62
+.extern E63
+.extern E64
+.extern E65
+.extern E66
+.extern E67
+.extern E68
+.extern E69
+.extern E70
+.extern E71
+.extern E72
+.extern E73
+.extern E74
+.extern E75
+.extern E76
+.extern E77
+.extern E78
+.extern E79
+.extern E80
+.extern E81
+.extern E82
+.extern E83
+.extern E84
+.extern E85
+.extern E86
+.extern E87
+.extern E88
+.extern E89
+.extern E90
+.extern E91
+.extern E92
+.extern E93
+.extern E94
+.extern E95
+.extern E96
+.extern E97
+.extern E98
+.extern E99
+.extern E100
+.extern E101
+.extern E102
+.extern E103
+.extern E104
+.extern E105
+.extern E106
+.extern E107
+.extern E108
+.extern E109
+.extern E110
+.extern E111
+.extern E112
+.extern E113
+.extern E114
+.extern E115
+.extern E116
+.extern E117
+.extern E118
+.extern E119
+.extern E120
+.extern E121
+.extern E122
+.extern E123
+.extern E124
+.extern E125
+.extern E126
+.extern E127
+.extern E128
+.extern E129
+.extern E130
+.extern E131
+.extern E132
+.extern E133
+.extern E134
+.extern E135
+.extern E136
+.extern E137
+.extern E138
+.extern E139
+.extern E140
+.extern E141
+.extern E142
+.extern E143
+.extern E144
+.extern E145
+.extern E146
+.extern E147
+.extern E148
+.extern E149
+.extern E150
+.extern E151
+.extern E152
+.extern E153
+.extern E154
+.extern E155
+.extern E156
+.extern E157
+.extern E158
+.extern E159
+.extern E160
+.extern E161
+.extern E162
+.extern E163
+.extern E164
+.extern E165
+.extern E166
+.extern E167
+.extern E168
+.extern E169
+.extern E170
+.extern E171
+.extern E172
+.extern E173
+.extern E174
+.extern E175
+.extern E176
+.extern E177
+.extern E178
+.extern E179
+.extern E180
+.extern E181
+.extern E182
+.extern E183
+.extern E184
+.extern E185
+.extern E186
+.extern E187
+.extern E188
+.extern E189
+.extern E190
+.extern E191
+.extern E192
+.extern E193
+.extern E194
+.extern E195
+.extern E196
+.extern E197
+.extern E198
+.extern E199
+.extern E200
+.extern E201
+.extern E202
+.extern E203
+.extern E204
+.extern E205
+.extern E206
+.extern E207
+.extern E208
+.extern E209
+.extern E210
+.extern E211
+.extern E212
+.extern E213
+.extern E214
+.extern E215
+.extern E216
+.extern E217
+.extern E218
+.extern E219
+.extern E220
+.extern E221
+.extern E222
+.extern E223
+.extern E224
+.extern E225
+.extern E226
+.extern E227
+.extern E228
+.extern E229
+.extern E230
+.extern E231
+.extern E232
+.extern E233
+.extern E234
+.extern E235
+.extern E236
+.extern E237
+.extern E238
+.extern E239
+.extern E240
+.extern E241
+.extern E242
+.extern E243
+.extern E244
+.extern E245
+.extern E246
+.extern E247
+.extern E248
+.extern E249
+.extern E250
+.extern E251
+.extern E252
+.extern E253
+.extern E254
+.extern E255
+.extern E256
+.extern E257
+.extern E258
+.extern E259
+.extern E260
+.extern E261
+.extern E262
+.extern E263
+.extern E264
+.extern E265
+.extern E266
+.extern E267
+.extern E268
+.extern E269
+.extern E270
+.extern E271
+.extern E272
+.extern E273
+.extern E274
+.extern E275
+.extern E276
+.extern E277
+.extern E278
+.extern E279
+.extern E280
+.extern E281
+.extern E282
+.extern E283
+.extern E284
+.extern E285
+.extern E286
+.extern E287
+.extern E288
+.extern E289
+.extern E290
+.extern E291
+.extern E292
+.extern E293
+.extern E294
+.extern E295
+.extern E296
+.extern E297
+.extern E298
+.extern E299
+MAIN: prn E0
+ prn E2
+ prn E4
+ prn E6
+ prn E8
+ prn E10
+ prn E12
+ prn E14
+ prn E16
+ prn E18
+ prn E20
+ prn E22
+ prn E24
+ prn E26
+ prn E28
+ prn E30
+ prn E32
+ prn E34
+ prn E36
+ prn E38
+ prn E40
+ prn E42
+ prn E44
+ prn E46
+ prn E48
+ prn E50
+ prn E52
+ prn E54
+ prn E56
+ prn E58
+ prn E60
+ prn E62
+ prn E64
+ prn E66
+ prn E68
+ prn E70
+ prn E72
+ prn E74
+ prn E76
+ prn E78
+ prn E80
+ prn E82
+ prn E84
+ prn E86
+ prn E88
+ prn E90
+ prn E92
+ prn E94
+ prn E96
+ prn E98
+ prn E100
+ prn E102
+ prn E104
+ prn E106
+ prn E108
+ prn E110
+ prn E112
+ prn E114
+ prn E116
+ prn E118
+ prn E120
+ prn E122
+ prn E124
+ prn E126
+ prn E128
+ prn E130
+ prn E132
+ prn E134
+ prn E136
+ prn E138
+ prn E140
+ prn E142
+ prn E144
+ prn E146
+ prn E148
+ prn E150
+ prn E152
+ prn E154
+ prn E156
+ prn E158
+ prn E160
+ prn E162
+ prn E164
+ prn E166
+ prn E168
+ prn E170
+ prn E172
+ prn E174
+ prn E176
+ prn E178
+ prn E180
+ prn E182
+ prn E184
+ prn E186
+ prn E188
+ prn E190
+ prn E192
+ prn E194
+ prn E196
+ prn E198
+ prn E200
+ prn E202
+ prn E204
+ prn E206
+ prn E208
+ prn E210
+ prn E212
+ prn E214
+ prn E216
+ prn E218
+ prn E220
+ prn E222
+ prn E224
+ prn E226
+ prn E228
+ prn E230
+ prn E232
+ prn E234
+ prn E236
+ prn E238
+ prn E240
+ prn E242
+ prn E244
+ prn E246
+ prn E248
+ prn E250
+ prn E252
+ prn E254
+ prn E256
+ prn E258
+ prn E260
+ prn E262
+ prn E264
+ prn E266
+ prn E268
+ prn E270
+ prn E272
+ prn E274
+ prn E276
+ prn E278
+ prn E280
+ prn E282
+ prn E284
+ prn E286
+ prn E288
+ prn E290
+ prn E292
+ prn E294
+ prn E296
+ prn E298
+ stop
@@ -0,0 +1,526 @@
+ .entry L0
+ .entry L2
+ .entry L4
+ .entry L6
+ .entry L8
+ .entry L10
+ .entry L12
+ .entry L14
+ .entry L16
+ .entry L18
+ .entry L20
+ .entry L22
+ .entry L24
+ .entry L26
+ .entry L28
+ .entry L30
+ .entry L32
+ .entry L34
+ .entry L36
+ .entry L38
+ .entry L40
+ .entry L42
+ .entry L44
+ .entry L46
+ .entry L48
+ .entry L50
+ .entry L52
+ .entry L54
+ .entry L56
+ .entry L58
+ .entry L60
+ .entry L62
+ .entry L64
+ .entry L66
+ .entry L68
+ .entry L70
+ .entry L72
+ .entry L74
+ .entry L76
+ .entry L78
+ .entry L80
+ .entry L82
+ .entry L84
+ .entry L86
+ .entry L88
+ .entry L90
+ .entry L92
+ .entry L94
+ .entry L96
+ .entry L98
+ .entry L100
+ .entry L102
+ .entry L104
+ .entry L106
+ .entry L108
+ .entry L110
+ .entry L112
+ .entry L114
+ .entry L116
+ .entry L118
+ .entry L120
+ .entry L122
+ .entry L124
+ .entry L126
+ .entry L128
+ .entry L130
+ .entry L132
+ .entry L134
+ .entry L136
+ .entry L138
+ .entry L140
+ .entry L142
+ .entry L144
+ .entry L146
+ .entry L148
+ .entry L150
+ .entry L152
+ .entry L154
+ .entry L156
+ .entry L158
+ .entry L160
+ .entry L162
+ .entry L164
+ .entry L166
+ .entry L168
+ .entry L170
+ .entry L172
+ .entry L174
+ .entry L176
+ .entry L178
+ .entry L180
+ .entry L182
+ .entry L184
+ .entry L186
+ .entry L188
+ .entry L190
+ .entry L192
+ .entry L194
+ .entry L196
+ .entry L198
+ .entry L200
+ .entry L202
+ .entry L204
+ .entry L206
+ .entry L208
+ .entry L210
+ .entry L212
+ .entry L214
+ .entry L216
+ .entry L218
+ .entry L220
+ .entry L222
+ .entry L224
+ .entry L226
+ .entry L228
+ .entry L230
+ .entry L232
+ .entry L234
+ .entry L236
+ .entry L238
+ .entry L240
+ .entry L242
+ .entry L244
+ .entry L246
+ .entry L248
+ .entry L250
+ .entry L252
+ .entry L254
+ .entry L256
+ .entry L258
+ .entry L260
+ .entry L262
+ .entry L264
+ .entry L266
+ .entry L268
+ .entry L270
+ .entry L272
+ .entry L274
+ .entry L276
+ .entry L278
+ .entry L280
+ .entry L282
+ .entry L284
+ .entry L286
+ .entry L288
+ .entry L290
+ .entry L292
+ .entry L294
+ .entry L296
+ .entry L298
+L0: inc @r0
+L1: inc @r1
+L2: inc @r2
+L3: inc @r3
+L4: inc @r4
+L5: inc @r5
+L6: inc @r6
+L7: inc @r7
+L8: inc @r0
+L9: inc @r1
+L10: inc @r2
+L11: inc @r3
+L12: inc @r4
+L13: inc @r5
+L14: inc @r6
+L15: inc @r7
+L16: inc @r0
+L17: inc @r1
+L18: inc @r2
+L19: inc @r3
+L20: inc @r4
+L21: inc @r5
+L22: inc @r6
+L23: inc @r7
+L24: inc @r0
+L25: inc @r1
+L26: inc @r2
+L27: inc @r3
+L28: inc @r4
+L29: inc @r5
+L30: inc @r6
+L31: inc @r7
+L32: inc @r0
+L33: inc @r1
+L34: inc @r2
+L35: inc @r3
+L36: inc @r4
+L37: inc @r5
+L38: inc @r6
+L39: inc @r7
+L40: inc @r0
+L41: inc @r1
+L42: inc @r2
+L43: inc @r3
+L44: inc @r4
+L45: inc @r5
+L46: inc @r6
+L47: inc @r7
+L48: inc @r0
+L49: inc @r1
+L50: inc @r2
+L51: inc @r3
+L52: inc @r4
+L53: inc @r5
+L54: inc @r6
+L55: inc @r7
+L56: inc @r0
+L57: inc @r1
+L58: inc @r2
+L59: inc @r3
+L60: inc @r4
+L61: inc @r5
+L62: inc @r6
+L63: inc @r7
+L64: inc @r0
+L65: inc @r1
+L66: inc @r2
+L67: inc @r3
+L68: inc @r4
+L69: inc @r5
+L70: inc @r6
+L71: inc @r7
+L72: inc @r0
+L73: inc @r1
+L74: inc @r2
+L75: inc @r3
+L76: inc @r4
+L77: inc @r5
+L78: inc @r6
+L79: inc @r7
+L80: inc @r0
+L81: inc @r1
+L82: inc @r2
+L83: inc @r3
+L84: inc @r4
+L85: inc @r5
+L86: inc @r6
+L87: inc @r7
+L88: inc @r0
+L89: inc @r1
+L90: inc @r2
+L91: inc @r3
+L92: inc @r4
+L93: inc @r5
+L94: inc @r6
+L95: inc @r7
+L96: inc @r0
+L97: inc @r1
+L98: inc @r2
+L99: inc @r3
+L100: inc @r4
+L101: inc @r5
+L102: inc @r6
+L103: inc @r7
+L104: inc @r0
+L105: inc @r1
+L106: inc @r2
+L107: inc @r3
+L108: inc @r4
+L109: inc @r5
+L110: inc @r6
+L111: inc @r7
+L112: inc @r0
+L113: inc @r1
+L114: inc @r2
+L115: inc @r3
+L116: inc @r4
+L117: inc @r5
+L118: inc @r6
+L119: inc @r7
+L120: inc @r0
+L121: inc @r1
+L122: inc @r2
+L123: inc @r3
+L124: inc @r4
+L125: inc @r5
+L126: inc @r6
+L127: inc @r7
+L128: inc @r0
+L129: inc @r1
+L130: inc @r2
+L131: inc @r3
+L132: inc @r4
+L133: inc @r5
+L134: inc @r6
+L135: inc @r7
+L136: inc @r0
+L137: inc @r1
+L138: inc @r2
+L139: inc @r3
+L140: inc @r4
+L141: inc @r5
+L142: inc @r6
+L143: inc @r7
+L144: inc @r0
+L145: inc @r1
+L146: inc @r2
+L147: inc @r3
+L148: inc @r4
+L149: inc @r5
+L150: inc @r6
+L151: inc @r7
+L152: inc @r0
+L153: inc @r1
+L154: inc @r2
+L155: inc @r3
+L156: inc @r4
+L157: inc @r5
+L158: inc @r6
+L159: inc @r7
+L160: inc @r0
+L161: inc @r1
+L162: inc @r2
+L163: inc @r3
+L164: inc @r4
+L165: inc @r5
+L166: inc @r6
+L167: inc @r7
+L168: inc @r0
+L169: inc @r1
+L170: inc @r2
+L171: inc @r3
+L172: inc @r4
+L173: inc @r5
+L174: inc @r6
+L175: inc @r7
+L176: inc @r0
+L177: inc @r1
+L178: inc @r2
+L179: inc @r3
+L180: inc @r4
+L181: inc @r5
+L182: inc @r6
+L183: inc @r7
+L184: inc @r0
+L185: inc @r1
+L186: inc @r2
+L187: inc @r3
+L188: inc @r4
+L189: inc @r5
+L190: inc @r6
+L191: inc @r7
+L192: inc @r0
+L193: inc @r1
+L194: inc @r2
+L195: inc @r3
+L196: inc @r4
+L197: inc @r5
+L198: inc @r6
+L199: inc @r7
+L200: inc @r0
+L201: inc @r1
+L202: inc @r2
+L203: inc @r3
+L204: inc @r4
+L205: inc @r5
+L206: inc @r6
+L207: inc @r7
+L208: inc @r0
+L209: inc @r1
+L210: inc @r2
+L211: inc @r3
+L212: inc @r4
+L213: inc @r5
+L214: inc @r6
+L215: inc @r7
+L216: inc @r0
+L217: inc @r1
+L218: inc @r2
+L219: inc @r3
+L220: inc @r4
+L221: inc @r5
+L222: inc @r6
+L223: inc @r7
+L224: inc @r0
+L225: inc @r1
+L226: inc @r2
+L227: inc @r3
+L228: inc @r4
+L229: inc @r5
+L230: inc @r6
+L231: inc @r7
+L232: inc @r0
+L233: inc @r1
+L234: inc @r2
+L235: inc @r3
+L236: inc @r4
+L237: inc @r5
+L238: inc @r6
+L239: inc @r7
+L240: inc @r0
+L241: inc @r1
+L242: inc @r2
+L243: inc @r3
+L244: inc @r4
+L245: inc @r5
+L246: inc @r6
+L247: inc @r7
+L248: inc @r0
+L249: inc @r1
+L250: inc @r2
+L251: inc @r3
+L252: inc @r4
+L253: inc @r5
+L254: inc @r6
+L255: inc @r7
+L256: inc @r0
+L257: inc @r1
+L258: inc @r2
+L259: inc @r3
+L260: inc @r4
+L261: inc @r5
+L262: inc @r6
+L263: inc @r7
+L264: inc @r0
+L265: inc @r1
+L266: inc @r2
+L267: inc @r3
+L268: inc @r4
+L269: inc @r5
+L270: inc @r6
+L271: inc @r7
+L272: inc @r0
+L273: inc @r1
+L274: inc @r2
+L275: inc @r3
+L276: inc @r4
+L277: inc @r5
+L278: inc @r6
+L279: inc @r7
+L280: inc @r0
+L281: inc @r1
+L282: inc @r2
+L283: inc @r3
+L284: inc @r4
+L285: inc @r5
+L286: inc @r6
+L287: inc @r7
+L288: inc @r0
+L289: inc @r1
+L290: inc @r2
+L291: inc @r3
+L292: inc @r4
+L293: inc @r5
+L294: inc @r6
+L295: inc @r7
+L296: inc @r0
+L297: inc @r1
+L298: inc @r2
+L299: inc @r3
+ jmp L0
+ jmp L4
+ jmp L8
+ jmp L12
+ jmp L16
+ jmp L20
+ jmp L24
+ jmp L28
+ jmp L32
+ jmp L36
+ jmp L40
+ jmp L44
+ jmp L48
+ jmp L52
+ jmp L56
+ jmp L60
+ jmp L64
+ jmp L68
+ jmp L72
+ jmp L76
+ jmp L80
+ jmp L84
+ jmp L88
+ jmp L92
+ jmp L96
+ jmp L100
+ jmp L104
+ jmp L108
+ jmp L112
+ jmp L116
+ jmp L120
+ jmp L124
+ jmp L128
+ jmp L132
+ jmp L136
+ jmp L140
+ jmp L144
+ jmp L148
+ jmp L152
+ jmp L156
+ jmp L160
+ jmp L164
+ jmp L168
+ jmp L172
+ jmp L176
+ jmp L180
+ jmp L184
+ jmp L188
+ jmp L192
+ jmp L196
+ jmp L200
+ jmp L204
+ jmp L208
+ jmp L212
+ jmp L216
+ jmp L220
+ jmp L224
+ jmp L228
+ jmp L232
+ jmp L236
+ jmp L240
+ jmp L244
+ jmp L248
+ jmp L252
+ jmp L256
+ jmp L260
+ jmp L264
+ jmp L268
+ jmp L272
+ jmp L276
+ jmp L280
+ jmp L284
+ jmp L288
+ jmp L292
+ jmp L296
+ stop
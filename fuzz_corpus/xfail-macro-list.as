@@ -0,0 +1,3001 @@
+mcro M0
+ inc @r2
+endmcro
+mcro M1
+ inc @r2
+endmcro
+mcro M2
+ inc @r2
+endmcro
+mcro M3
+ inc @r2
+endmcro
+mcro M4
+ inc @r2
+endmcro
+mcro M5
+ inc @r2
+endmcro
+mcro M6
+ inc @r2
+endmcro
+mcro M7
+ inc @r2
+endmcro
+mcro M8
+ inc @r2
+endmcro
+mcro M9
+ inc @r2
+endmcro
+mcro M10
+ inc @r2
+endmcro
+mcro M11
+ inc @r2
+endmcro
+mcro M12
+ inc @r2
+endmcro
+mcro M13
+ inc @r2
+endmcro
+mcro M14
+ inc @r2
+endmcro
+mcro M15
+ inc @r2
+endmcro
+mcro M16
+ inc @r2
+endmcro
+mcro M17
+ inc @r2
+endmcro
+mcro M18
+ inc @r2
+endmcro
+mcro M19
+ inc @r2
+endmcro
+mcro M20
+ inc @r2
+endmcro
+mcro M21
+ inc @r2
+endmcro
+mcro M22
+ inc @r2
+endmcro
+mcro M23
+ inc @r2
+endmcro
+mcro M24
+ inc @r2
+endmcro
+mcro M25
+ inc @r2
+endmcro
+mcro M26
+ inc @r2
+endmcro
+mcro M27
+ inc @r2
+endmcro
+mcro M28
+ inc @r2
+endmcro
+mcro M29
+ inc @r2
+endmcro
+mcro M30
+ inc @r2
+endmcro
+mcro M31
+ inc @r2
+endmcro
+mcro M32
+ inc @r2
+endmcro
+mcro M33
+ inc @r2
+endmcro
+mcro M34
+ inc @r2
+endmcro
+mcro M35
+ inc @r2
+endmcro
+mcro M36
+ inc @r2
+endmcro
+mcro M37
+ inc @r2
+endmcro
+mcro M38
+ inc @r2
+endmcro
+mcro M39
+ inc @r2
+endmcro
+mcro M40
+ inc @r2
+endmcro
+mcro M41
+ inc @r2
+endmcro
+mcro M42
+ inc @r2
+endmcro
+mcro M43
+ inc @r2
+endmcro
+mcro M44
+ inc @r2
+endmcro
+mcro M45
+ inc @r2
+endmcro
+mcro M46
+ inc @r2
+endmcro
+mcro M47
+ inc @r2
+endmcro
+mcro M48
+ inc @r2
+endmcro
+mcro M49
+ inc @r2
+endmcro
+mcro M50
+ inc @r2
+endmcro
+mcro M51
+ inc @r2
+endmcro
+mcro M52
+ inc @r2
+endmcro
+mcro M53
+ inc @r2
+endmcro
+mcro M54
+ inc @r2
+endmcro
+mcro M55
+ inc @r2
+endmcro
+mcro M56
+ inc @r2
+endmcro
+mcro M57
+ inc @r2
+endmcro
+mcro M58
+ inc @r2
+endmcro
+mcro M59
+ inc @r2
+endmcro
+mcro M60
+ inc @r2
+endmcro
+mcro M61
+ inc @r2
+endmcro
+mcro M62
+ inc @r2
+endmcro
+mcro M63
+ inc @r2
+endmcro
+mcro M64
+ inc @r2
+endmcro
+mcro M65
+ inc @r2
+endmcro
+mcro M66
+ inc @r2
+endmcro
+mcro M67
+ inc @r2
+endmcro
+mcro M68
+ inc @r2
+endmcro
+mcro M69
+ inc @r2
+endmcro
+mcro M70
+ inc @r2
+endmcro
+mcro M71
+ inc @r2
+endmcro
+mcro M72
+ inc @r2
+endmcro
+mcro M73
+ inc @r2
+endmcro
+mcro M74
+ inc @r2
+endmcro
+mcro M75
+ inc @r2
+endmcro
+mcro M76
+ inc @r2
+endmcro
+mcro M77
+ inc @r2
+endmcro
+mcro M78
+ inc @r2
+endmcro
+mcro M79
+ inc @r2
+endmcro
+mcro M80
+ inc @r2
+endmcro
+mcro M81
+ inc @r2
+endmcro
+mcro M82
+ inc @r2
+endmcro
+mcro M83
+ inc @r2
+endmcro
+mcro M84
+ inc @r2
+endmcro
+mcro M85
+ inc @r2
+endmcro
+mcro M86
+ inc @r2
+endmcro
+mcro M87
+ inc @r2
+endmcro
+mcro M88
+ inc @r2
+endmcro
+mcro M89
+ inc @r2
+endmcro
+mcro M90
+ inc @r2
+endmcro
+mcro M91
+ inc @r2
+endmcro
+mcro M92
+ inc @r2
+endmcro
+mcro M93
+ inc @r2
+endmcro
+mcro M94
+ inc @r2
+endmcro
+mcro M95
+ inc @r2
+endmcro
+mcro M96
+ inc @r2
+endmcro
+mcro M97
+ inc @r2
+endmcro
+mcro M98
+ inc @r2
+endmcro
+mcro M99
+ inc @r2
+endmcro
+mcro M100
+ inc @r2
+endmcro
+mcro M101
+ inc @r2
+endmcro
+mcro M102
+ inc @r2
+endmcro
+mcro M103
+ inc @r2
+endmcro
+mcro M104
+ inc @r2
+endmcro
+mcro M105
+ inc @r2
+endmcro
+mcro M106
+ inc @r2
+endmcro
+mcro M107
+ inc @r2
+endmcro
+mcro M108
+ inc @r2
+endmcro
+mcro M109
+ inc @r2
+endmcro
+mcro M110
+ inc @r2
+endmcro
+mcro M111
+ inc @r2
+endmcro
+mcro M112
+ inc @r2
+endmcro
+mcro M113
+ inc @r2
+endmcro
+mcro M114
+ inc @r2
+endmcro
+mcro M115
+ inc @r2
+endmcro
+mcro M116
+ inc @r2
+endmcro
+mcro M117
+ inc @r2
+endmcro
+mcro M118
+ inc @r2
+endmcro
+mcro M119
+ inc @r2
+endmcro
+mcro M120
+ inc @r2
+endmcro
+mcro M121
+ inc @r2
+endmcro
+mcro M122
+ inc @r2
+endmcro
+mcro M123
+ inc @r2
+endmcro
+mcro M124
+ inc @r2
+endmcro
+mcro M125
+ inc @r2
+endmcro
+mcro M126
+ inc @r2
+endmcro
+mcro M127
+ inc @r2
+endmcro
+mcro M128
+ inc @r2
+endmcro
+mcro M129
+ inc @r2
+endmcro
+mcro M130
+ inc @r2
+endmcro
+mcro M131
+ inc @r2
+endmcro
+mcro M132
+ inc @r2
+endmcro
+mcro M133
+ inc @r2
+endmcro
+mcro M134
+ inc @r2
+endmcro
+mcro M135
+ inc @r2
+endmcro
+mcro M136
+ inc @r2
+endmcro
+mcro M137
+ inc @r2
+endmcro
+mcro M138
+ inc @r2
+endmcro
+mcro M139
+ inc @r2
+endmcro
+mcro M140
+ inc @r2
+endmcro
+mcro M141
+ inc @r2
+endmcro
+mcro M142
+ inc @r2
+endmcro
+mcro M143
+ inc @r2
+endmcro
+mcro M144
+ inc @r2
+endmcro
+mcro M145
+ inc @r2
+endmcro
+mcro M146
+ inc @r2
+endmcro
+mcro M147
+ inc @r2
+endmcro
+mcro M148
+ inc @r2
+endmcro
+mcro M149
+ inc @r2
+endmcro
+mcro M150
+ inc @r2
+endmcro
+mcro M151
+ inc @r2
+endmcro
+mcro M152
+ inc @r2
+endmcro
+mcro M153
+ inc @r2
+endmcro
+mcro M154
+ inc @r2
+endmcro
+mcro M155
+ inc @r2
+endmcro
+mcro M156
+ inc @r2
+endmcro
+mcro M157
+ inc @r2
+endmcro
+mcro M158
+ inc @r2
+endmcro
+mcro M159
+ inc @r2
+endmcro
+mcro M160
+ inc @r2
+endmcro
+mcro M161
+ inc @r2
+endmcro
+mcro M162
+ inc @r2
+endmcro
+mcro M163
+ inc @r2
+endmcro
+mcro M164
+ inc @r2
+endmcro
+mcro M165
+ inc @r2
+endmcro
+mcro M166
+ inc @r2
+endmcro
+mcro M167
+ inc @r2
+endmcro
+mcro M168
+ inc @r2
+endmcro
+mcro M169
+ inc @r2
+endmcro
+mcro M170
+ inc @r2
+endmcro
+mcro M171
+ inc @r2
+endmcro
+mcro M172
+ inc @r2
+endmcro
+mcro M173
+ inc @r2
+endmcro
+mcro M174
+ inc @r2
+endmcro
+mcro M175
+ inc @r2
+endmcro
+mcro M176
+ inc @r2
+endmcro
+mcro M177
+ inc @r2
+endmcro
+mcro M178
+ inc @r2
+endmcro
+mcro M179
+ inc @r2
+endmcro
+mcro M180
+ inc @r2
+endmcro
+mcro M181
+ inc @r2
+endmcro
+mcro M182
+ inc @r2
+endmcro
+mcro M183
+ inc @r2
+endmcro
+mcro M184
+ inc @r2
+endmcro
+mcro M185
+ inc @r2
+endmcro
+mcro M186
+ inc @r2
+endmcro
+mcro M187
+ inc @r2
+endmcro
+mcro M188
+ inc @r2
+endmcro
+mcro M189
+ inc @r2
+endmcro
+mcro M190
+ inc @r2
+endmcro
+mcro M191
+ inc @r2
+endmcro
+mcro M192
+ inc @r2
+endmcro
+mcro M193
+ inc @r2
+endmcro
+mcro M194
+ inc @r2
+endmcro
+mcro M195
+ inc @r2
+endmcro
+mcro M196
+ inc @r2
+endmcro
+mcro M197
+ inc @r2
+endmcro
+mcro M198
+ inc @r2
+endmcro
+mcro M199
+ inc @r2
+endmcro
+mcro M200
+ inc @r2
+endmcro
+mcro M201
+ inc @r2
+endmcro
+mcro M202
+ inc @r2
+endmcro
+mcro M203
+ inc @r2
+endmcro
+mcro M204
+ inc @r2
+endmcro
+mcro M205
+ inc @r2
+endmcro
+mcro M206
+ inc @r2
+endmcro
+mcro M207
+ inc @r2
+endmcro
+mcro M208
+ inc @r2
+endmcro
+mcro M209
+ inc @r2
+endmcro
+mcro M210
+ inc @r2
+endmcro
+mcro M211
+ inc @r2
+endmcro
+mcro M212
+ inc @r2
+endmcro
+mcro M213
+ inc @r2
+endmcro
+mcro M214
+ inc @r2
+endmcro
+mcro M215
+ inc @r2
+endmcro
+mcro M216
+ inc @r2
+endmcro
+mcro M217
+ inc @r2
+endmcro
+mcro M218
+ inc @r2
+endmcro
+mcro M219
+ inc @r2
+endmcro
+mcro M220
+ inc @r2
+endmcro
+mcro M221
+ inc @r2
+endmcro
+mcro M222
+ inc @r2
+endmcro
+mcro M223
+ inc @r2
+endmcro
+mcro M224
+ inc @r2
+endmcro
+mcro M225
+ inc @r2
+endmcro
+mcro M226
+ inc @r2
+endmcro
+mcro M227
+ inc @r2
+endmcro
+mcro M228
+ inc @r2
+endmcro
+mcro M229
+ inc @r2
+endmcro
+mcro M230
+ inc @r2
+endmcro
+mcro M231
+ inc @r2
+endmcro
+mcro M232
+ inc @r2
+endmcro
+mcro M233
+ inc @r2
+endmcro
+mcro M234
+ inc @r2
+endmcro
+mcro M235
+ inc @r2
+endmcro
+mcro M236
+ inc @r2
+endmcro
+mcro M237
+ inc @r2
+endmcro
+mcro M238
+ inc @r2
+endmcro
+mcro M239
+ inc @r2
+endmcro
+mcro M240
+ inc @r2
+endmcro
+mcro M241
+ inc @r2
+endmcro
+mcro M242
+ inc @r2
+endmcro
+mcro M243
+ inc @r2
+endmcro
+mcro M244
+ inc @r2
+endmcro
+mcro M245
+ inc @r2
+endmcro
+mcro M246
+ inc @r2
+endmcro
+mcro M247
+ inc @r2
+endmcro
+mcro M248
+ inc @r2
+endmcro
+mcro M249
+ inc @r2
+endmcro
+mcro M250
+ inc @r2
+endmcro
+mcro M251
+ inc @r2
+endmcro
+mcro M252
+ inc @r2
+endmcro
+mcro M253
+ inc @r2
+endmcro
+mcro M254
+ inc @r2
+endmcro
+mcro M255
+ inc @r2
+endmcro
+mcro M256
+ inc @r2
+endmcro
+mcro M257
+ inc @r2
+endmcro
+mcro M258
+ inc @r2
+endmcro
+mcro M259
+ inc @r2
+endmcro
+mcro M260
+ inc @r2
+endmcro
+mcro M261
+ inc @r2
+endmcro
+mcro M262
+ inc @r2
+endmcro
+mcro M263
+ inc @r2
+endmcro
+mcro M264
+ inc @r2
+endmcro
+mcro M265
+ inc @r2
+endmcro
+mcro M266
+ inc @r2
+endmcro
+mcro M267
+ inc @r2
+endmcro
+mcro M268
+ inc @r2
+endmcro
+mcro M269
+ inc @r2
+endmcro
+mcro M270
+ inc @r2
+endmcro
+mcro M271
+ inc @r2
+endmcro
+mcro M272
+ inc @r2
+endmcro
+mcro M273
+ inc @r2
+endmcro
+mcro M274
+ inc @r2
+endmcro
+mcro M275
+ inc @r2
+endmcro
+mcro M276
+ inc @r2
+endmcro
+mcro M277
+ inc @r2
+endmcro
+mcro M278
+ inc @r2
+endmcro
+mcro M279
+ inc @r2
+endmcro
+mcro M280
+ inc @r2
+endmcro
+mcro M281
+ inc @r2
+endmcro
+mcro M282
+ inc @r2
+endmcro
+mcro M283
+ inc @r2
+endmcro
+mcro M284
+ inc @r2
+endmcro
+mcro M285
+ inc @r2
+endmcro
+mcro M286
+ inc @r2
+endmcro
+mcro M287
+ inc @r2
+endmcro
+mcro M288
+ inc @r2
+endmcro
+mcro M289
+ inc @r2
+endmcro
+mcro M290
+ inc @r2
+endmcro
+mcro M291
+ inc @r2
+endmcro
+mcro M292
+ inc @r2
+endmcro
+mcro M293
+ inc @r2
+endmcro
+mcro M294
+ inc @r2
+endmcro
+mcro M295
+ inc @r2
+endmcro
+mcro M296
+ inc @r2
+endmcro
+mcro M297
+ inc @r2
+endmcro
+mcro M298
+ inc @r2
+endmcro
+mcro M299
+ inc @r2
+endmcro
+mcro M300
+ inc @r2
+endmcro
+mcro M301
+ inc @r2
+endmcro
+mcro M302
+ inc @r2
+endmcro
+mcro M303
+ inc @r2
+endmcro
+mcro M304
+ inc @r2
+endmcro
+mcro M305
+ inc @r2
+endmcro
+mcro M306
+ inc @r2
+endmcro
+mcro M307
+ inc @r2
+endmcro
+mcro M308
+ inc @r2
+endmcro
+mcro M309
+ inc @r2
+endmcro
+mcro M310
+ inc @r2
+endmcro
+mcro M311
+ inc @r2
+endmcro
+mcro M312
+ inc @r2
+endmcro
+mcro M313
+ inc @r2
+endmcro
+mcro M314
+ inc @r2
+endmcro
+mcro M315
+ inc @r2
+endmcro
+mcro M316
+ inc @r2
+endmcro
+mcro M317
+ inc @r2
+endmcro
+mcro M318
+ inc @r2
+endmcro
+mcro M319
+ inc @r2
+endmcro
+mcro M320
+ inc @r2
+endmcro
+mcro M321
+ inc @r2
+endmcro
+mcro M322
+ inc @r2
+endmcro
+mcro M323
+ inc @r2
+endmcro
+mcro M324
+ inc @r2
+endmcro
+mcro M325
+ inc @r2
+endmcro
+mcro M326
+ inc @r2
+endmcro
+mcro M327
+ inc @r2
+endmcro
+mcro M328
+ inc @r2
+endmcro
+mcro M329
+ inc @r2
+endmcro
+mcro M330
+ inc @r2
+endmcro
+mcro M331
+ inc @r2
+endmcro
+mcro M332
+ inc @r2
+endmcro
+mcro M333
+ inc @r2
+endmcro
+mcro M334
+ inc @r2
+endmcro
+mcro M335
+ inc @r2
+endmcro
+mcro M336
+ inc @r2
+endmcro
+mcro M337
+ inc @r2
+endmcro
+mcro M338
+ inc @r2
+endmcro
+mcro M339
+ inc @r2
+endmcro
+mcro M340
+ inc @r2
+endmcro
+mcro M341
+ inc @r2
+endmcro
+mcro M342
+ inc @r2
+endmcro
+mcro M343
+ inc @r2
+endmcro
+mcro M344
+ inc @r2
+endmcro
+mcro M345
+ inc @r2
+endmcro
+mcro M346
+ inc @r2
+endmcro
+mcro M347
+ inc @r2
+endmcro
+mcro M348
+ inc @r2
+endmcro
+mcro M349
+ inc @r2
+endmcro
+mcro M350
+ inc @r2
+endmcro
+mcro M351
+ inc @r2
+endmcro
+mcro M352
+ inc @r2
+endmcro
+mcro M353
+ inc @r2
+endmcro
+mcro M354
+ inc @r2
+endmcro
+mcro M355
+ inc @r2
+endmcro
+mcro M356
+ inc @r2
+endmcro
+mcro M357
+ inc @r2
+endmcro
+mcro M358
+ inc @r2
+endmcro
+mcro M359
+ inc @r2
+endmcro
+mcro M360
+ inc @r2
+endmcro
+mcro M361
+ inc @r2
+endmcro
+mcro M362
+ inc @r2
+endmcro
+mcro M363
+ inc @r2
+endmcro
+mcro M364
+ inc @r2
+endmcro
+mcro M365
+ inc @r2
+endmcro
+mcro M366
+ inc @r2
+endmcro
+mcro M367
+ inc @r2
+endmcro
+mcro M368
+ inc @r2
+endmcro
+mcro M369
+ inc @r2
+endmcro
+mcro M370
+ inc @r2
+endmcro
+mcro M371
+ inc @r2
+endmcro
+mcro M372
+ inc @r2
+endmcro
+mcro M373
+ inc @r2
+endmcro
+mcro M374
+ inc @r2
+endmcro
+mcro M375
+ inc @r2
+endmcro
+mcro M376
+ inc @r2
+endmcro
+mcro M377
+ inc @r2
+endmcro
+mcro M378
+ inc @r2
+endmcro
+mcro M379
+ inc @r2
+endmcro
+mcro M380
+ inc @r2
+endmcro
+mcro M381
+ inc @r2
+endmcro
+mcro M382
+ inc @r2
+endmcro
+mcro M383
+ inc @r2
+endmcro
+mcro M384
+ inc @r2
+endmcro
+mcro M385
+ inc @r2
+endmcro
+mcro M386
+ inc @r2
+endmcro
+mcro M387
+ inc @r2
+endmcro
+mcro M388
+ inc @r2
+endmcro
+mcro M389
+ inc @r2
+endmcro
+mcro M390
+ inc @r2
+endmcro
+mcro M391
+ inc @r2
+endmcro
+mcro M392
+ inc @r2
+endmcro
+mcro M393
+ inc @r2
+endmcro
+mcro M394
+ inc @r2
+endmcro
+mcro M395
+ inc @r2
+endmcro
+mcro M396
+ inc @r2
+endmcro
+mcro M397
+ inc @r2
+endmcro
+mcro M398
+ inc @r2
+endmcro
+mcro M399
+ inc @r2
+endmcro
+mcro M400
+ inc @r2
+endmcro
+mcro M401
+ inc @r2
+endmcro
+mcro M402
+ inc @r2
+endmcro
+mcro M403
+ inc @r2
+endmcro
+mcro M404
+ inc @r2
+endmcro
+mcro M405
+ inc @r2
+endmcro
+mcro M406
+ inc @r2
+endmcro
+mcro M407
+ inc @r2
+endmcro
+mcro M408
+ inc @r2
+endmcro
+mcro M409
+ inc @r2
+endmcro
+mcro M410
+ inc @r2
+endmcro
+mcro M411
+ inc @r2
+endmcro
+mcro M412
+ inc @r2
+endmcro
+mcro M413
+ inc @r2
+endmcro
+mcro M414
+ inc @r2
+endmcro
+mcro M415
+ inc @r2
+endmcro
+mcro M416
+ inc @r2
+endmcro
+mcro M417
+ inc @r2
+endmcro
+mcro M418
+ inc @r2
+endmcro
+mcro M419
+ inc @r2
+endmcro
+mcro M420
+ inc @r2
+endmcro
+mcro M421
+ inc @r2
+endmcro
+mcro M422
+ inc @r2
+endmcro
+mcro M423
+ inc @r2
+endmcro
+mcro M424
+ inc @r2
+endmcro
+mcro M425
+ inc @r2
+endmcro
+mcro M426
+ inc @r2
+endmcro
+mcro M427
+ inc @r2
+endmcro
+mcro M428
+ inc @r2
+endmcro
+mcro M429
+ inc @r2
+endmcro
+mcro M430
+ inc @r2
+endmcro
+mcro M431
+ inc @r2
+endmcro
+mcro M432
+ inc @r2
+endmcro
+mcro M433
+ inc @r2
+endmcro
+mcro M434
+ inc @r2
+endmcro
+mcro M435
+ inc @r2
+endmcro
+mcro M436
+ inc @r2
+endmcro
+mcro M437
+ inc @r2
+endmcro
+mcro M438
+ inc @r2
+endmcro
+mcro M439
+ inc @r2
+endmcro
+mcro M440
+ inc @r2
+endmcro
+mcro M441
+ inc @r2
+endmcro
+mcro M442
+ inc @r2
+endmcro
+mcro M443
+ inc @r2
+endmcro
+mcro M444
+ inc @r2
+endmcro
+mcro M445
+ inc @r2
+endmcro
+mcro M446
+ inc @r2
+endmcro
+mcro M447
+ inc @r2
+endmcro
+mcro M448
+ inc @r2
+endmcro
+mcro M449
+ inc @r2
+endmcro
+mcro M450
+ inc @r2
+endmcro
+mcro M451
+ inc @r2
+endmcro
+mcro M452
+ inc @r2
+endmcro
+mcro M453
+ inc @r2
+endmcro
+mcro M454
+ inc @r2
+endmcro
+mcro M455
+ inc @r2
+endmcro
+mcro M456
+ inc @r2
+endmcro
+mcro M457
+ inc @r2
+endmcro
+mcro M458
+ inc @r2
+endmcro
+mcro M459
+ inc @r2
+endmcro
+mcro M460
+ inc @r2
+endmcro
+mcro M461
+ inc @r2
+endmcro
+mcro M462
+ inc @r2
+endmcro
+mcro M463
+ inc @r2
+endmcro
+mcro M464
+ inc @r2
+endmcro
+mcro M465
+ inc @r2
+endmcro
+mcro M466
+ inc @r2
+endmcro
+mcro M467
+ inc @r2
+endmcro
+mcro M468
+ inc @r2
+endmcro
+mcro M469
+ inc @r2
+endmcro
+mcro M470
+ inc @r2
+endmcro
+mcro M471
+ inc @r2
+endmcro
+mcro M472
+ inc @r2
+endmcro
+mcro M473
+ inc @r2
+endmcro
+mcro M474
+ inc @r2
+endmcro
+mcro M475
+ inc @r2
+endmcro
+mcro M476
+ inc @r2
+endmcro
+mcro M477
+ inc @r2
+endmcro
+mcro M478
+ inc @r2
+endmcro
+mcro M479
+ inc @r2
+endmcro
+mcro M480
+ inc @r2
+endmcro
+mcro M481
+ inc @r2
+endmcro
+mcro M482
+ inc @r2
+endmcro
+mcro M483
+ inc @r2
+endmcro
+mcro M484
+ inc @r2
+endmcro
+mcro M485
+ inc @r2
+endmcro
+mcro M486
+ inc @r2
+endmcro
+mcro M487
+ inc @r2
+endmcro
+mcro M488
+ inc @r2
+endmcro
+mcro M489
+ inc @r2
+endmcro
+mcro M490
+ inc @r2
+endmcro
+mcro M491
+ inc @r2
+endmcro
+mcro M492
+ inc @r2
+endmcro
+mcro M493
+ inc @r2
+endmcro
+mcro M494
+ inc @r2
+endmcro
+mcro M495
+ inc @r2
+endmcro
+mcro M496
+ inc @r2
+endmcro
+mcro M497
+ inc @r2
+endmcro
+mcro M498
+ inc @r2
+endmcro
+mcro M499
+ inc @r2
+endmcro
+mcro M500
+ inc @r2
+endmcro
+mcro M501
+ inc @r2
+endmcro
+mcro M502
+ inc @r2
+endmcro
+mcro M503
+ inc @r2
+endmcro
+mcro M504
+ inc @r2
+endmcro
+mcro M505
+ inc @r2
+endmcro
+mcro M506
+ inc @r2
+endmcro
+mcro M507
+ inc @r2
+endmcro
+mcro M508
+ inc @r2
+endmcro
+mcro M509
+ inc @r2
+endmcro
+mcro M510
+ inc @r2
+endmcro
+mcro M511
+ inc @r2
+endmcro
+mcro M512
+ inc @r2
+endmcro
+mcro M513
+ inc @r2
+endmcro
+mcro M514
+ inc @r2
+endmcro
+mcro M515
+ inc @r2
+endmcro
+mcro M516
+ inc @r2
+endmcro
+mcro M517
+ inc @r2
+endmcro
+mcro M518
+ inc @r2
+endmcro
+mcro M519
+ inc @r2
+endmcro
+mcro M520
+ inc @r2
+endmcro
+mcro M521
+ inc @r2
+endmcro
+mcro M522
+ inc @r2
+endmcro
+mcro M523
+ inc @r2
+endmcro
+mcro M524
+ inc @r2
+endmcro
+mcro M525
+ inc @r2
+endmcro
+mcro M526
+ inc @r2
+endmcro
+mcro M527
+ inc @r2
+endmcro
+mcro M528
+ inc @r2
+endmcro
+mcro M529
+ inc @r2
+endmcro
+mcro M530
+ inc @r2
+endmcro
+mcro M531
+ inc @r2
+endmcro
+mcro M532
+ inc @r2
+endmcro
+mcro M533
+ inc @r2
+endmcro
+mcro M534
+ inc @r2
+endmcro
+mcro M535
+ inc @r2
+endmcro
+mcro M536
+ inc @r2
+endmcro
+mcro M537
+ inc @r2
+endmcro
+mcro M538
+ inc @r2
+endmcro
+mcro M539
+ inc @r2
+endmcro
+mcro M540
+ inc @r2
+endmcro
+mcro M541
+ inc @r2
+endmcro
+mcro M542
+ inc @r2
+endmcro
+mcro M543
+ inc @r2
+endmcro
+mcro M544
+ inc @r2
+endmcro
+mcro M545
+ inc @r2
+endmcro
+mcro M546
+ inc @r2
+endmcro
+mcro M547
+ inc @r2
+endmcro
+mcro M548
+ inc @r2
+endmcro
+mcro M549
+ inc @r2
+endmcro
+mcro M550
+ inc @r2
+endmcro
+mcro M551
+ inc @r2
+endmcro
+mcro M552
+ inc @r2
+endmcro
+mcro M553
+ inc @r2
+endmcro
+mcro M554
+ inc @r2
+endmcro
+mcro M555
+ inc @r2
+endmcro
+mcro M556
+ inc @r2
+endmcro
+mcro M557
+ inc @r2
+endmcro
+mcro M558
+ inc @r2
+endmcro
+mcro M559
+ inc @r2
+endmcro
+mcro M560
+ inc @r2
+endmcro
+mcro M561
+ inc @r2
+endmcro
+mcro M562
+ inc @r2
+endmcro
+mcro M563
+ inc @r2
+endmcro
+mcro M564
+ inc @r2
+endmcro
+mcro M565
+ inc @r2
+endmcro
+mcro M566
+ inc @r2
+endmcro
+mcro M567
+ inc @r2
+endmcro
+mcro M568
+ inc @r2
+endmcro
+mcro M569
+ inc @r2
+endmcro
+mcro M570
+ inc @r2
+endmcro
+mcro M571
+ inc @r2
+endmcro
+mcro M572
+ inc @r2
+endmcro
+mcro M573
+ inc @r2
+endmcro
+mcro M574
+ inc @r2
+endmcro
+mcro M575
+ inc @r2
+endmcro
+mcro M576
+ inc @r2
+endmcro
+mcro M577
+ inc @r2
+endmcro
+mcro M578
+ inc @r2
+endmcro
+mcro M579
+ inc @r2
+endmcro
+mcro M580
+ inc @r2
+endmcro
+mcro M581
+ inc @r2
+endmcro
+mcro M582
+ inc @r2
+endmcro
+mcro M583
+ inc @r2
+endmcro
+mcro M584
+ inc @r2
+endmcro
+mcro M585
+ inc @r2
+endmcro
+mcro M586
+ inc @r2
+endmcro
+mcro M587
+ inc @r2
+endmcro
+mcro M588
+ inc @r2
+endmcro
+mcro M589
+ inc @r2
+endmcro
+mcro M590
+ inc @r2
+endmcro
+mcro M591
+ inc @r2
+endmcro
+mcro M592
+ inc @r2
+endmcro
+mcro M593
+ inc @r2
+endmcro
+mcro M594
+ inc @r2
+endmcro
+mcro M595
+ inc @r2
+endmcro
+mcro M596
+ inc @r2
+endmcro
+mcro M597
+ inc @r2
+endmcro
+mcro M598
+ inc @r2
+endmcro
+mcro M599
+ inc @r2
+endmcro
+mcro M600
+ inc @r2
+endmcro
+mcro M601
+ inc @r2
+endmcro
+mcro M602
+ inc @r2
+endmcro
+mcro M603
+ inc @r2
+endmcro
+mcro M604
+ inc @r2
+endmcro
+mcro M605
+ inc @r2
+endmcro
+mcro M606
+ inc @r2
+endmcro
+mcro M607
+ inc @r2
+endmcro
+mcro M608
+ inc @r2
+endmcro
+mcro M609
+ inc @r2
+endmcro
+mcro M610
+ inc @r2
+endmcro
+mcro M611
+ inc @r2
+endmcro
+mcro M612
+ inc @r2
+endmcro
+mcro M613
+ inc @r2
+endmcro
+mcro M614
+ inc @r2
+endmcro
+mcro M615
+ inc @r2
+endmcro
+mcro M616
+ inc @r2
+endmcro
+mcro M617
+ inc @r2
+endmcro
+mcro M618
+ inc @r2
+endmcro
+mcro M619
+ inc @r2
+endmcro
+mcro M620
+ inc @r2
+endmcro
+mcro M621
+ inc @r2
+endmcro
+mcro M622
+ inc @r2
+endmcro
+mcro M623
+ inc @r2
+endmcro
+mcro M624
+ inc @r2
+endmcro
+mcro M625
+ inc @r2
+endmcro
+mcro M626
+ inc @r2
+endmcro
+mcro M627
+ inc @r2
+endmcro
+mcro M628
+ inc @r2
+endmcro
+mcro M629
+ inc @r2
+endmcro
+mcro M630
+ inc @r2
+endmcro
+mcro M631
+ inc @r2
+endmcro
+mcro M632
+ inc @r2
+endmcro
+mcro M633
+ inc @r2
+endmcro
+mcro M634
+ inc @r2
+endmcro
+mcro M635
+ inc @r2
+endmcro
+mcro M636
+ inc @r2
+endmcro
+mcro M637
+ inc @r2
+endmcro
+mcro M638
+ inc @r2
+endmcro
+mcro M639
+ inc @r2
+endmcro
+mcro M640
+ inc @r2
+endmcro
+mcro M641
+ inc @r2
+endmcro
+mcro M642
+ inc @r2
+endmcro
+mcro M643
+ inc @r2
+endmcro
+mcro M644
+ inc @r2
+endmcro
+mcro M645
+ inc @r2
+endmcro
+mcro M646
+ inc @r2
+endmcro
+mcro M647
+ inc @r2
+endmcro
+mcro M648
+ inc @r2
+endmcro
+mcro M649
+ inc @r2
+endmcro
+mcro M650
+ inc @r2
+endmcro
+mcro M651
+ inc @r2
+endmcro
+mcro M652
+ inc @r2
+endmcro
+mcro M653
+ inc @r2
+endmcro
+mcro M654
+ inc @r2
+endmcro
+mcro M655
+ inc @r2
+endmcro
+mcro M656
+ inc @r2
+endmcro
+mcro M657
+ inc @r2
+endmcro
+mcro M658
+ inc @r2
+endmcro
+mcro M659
+ inc @r2
+endmcro
+mcro M660
+ inc @r2
+endmcro
+mcro M661
+ inc @r2
+endmcro
+mcro M662
+ inc @r2
+endmcro
+mcro M663
+ inc @r2
+endmcro
+mcro M664
+ inc @r2
+endmcro
+mcro M665
+ inc @r2
+endmcro
+mcro M666
+ inc @r2
+endmcro
+mcro M667
+ inc @r2
+endmcro
+mcro M668
+ inc @r2
+endmcro
+mcro M669
+ inc @r2
+endmcro
+mcro M670
+ inc @r2
+endmcro
+mcro M671
+ inc @r2
+endmcro
+mcro M672
+ inc @r2
+endmcro
+mcro M673
+ inc @r2
+endmcro
+mcro M674
+ inc @r2
+endmcro
+mcro M675
+ inc @r2
+endmcro
+mcro M676
+ inc @r2
+endmcro
+mcro M677
+ inc @r2
+endmcro
+mcro M678
+ inc @r2
+endmcro
+mcro M679
+ inc @r2
+endmcro
+mcro M680
+ inc @r2
+endmcro
+mcro M681
+ inc @r2
+endmcro
+mcro M682
+ inc @r2
+endmcro
+mcro M683
+ inc @r2
+endmcro
+mcro M684
+ inc @r2
+endmcro
+mcro M685
+ inc @r2
+endmcro
+mcro M686
+ inc @r2
+endmcro
+mcro M687
+ inc @r2
+endmcro
+mcro M688
+ inc @r2
+endmcro
+mcro M689
+ inc @r2
+endmcro
+mcro M690
+ inc @r2
+endmcro
+mcro M691
+ inc @r2
+endmcro
+mcro M692
+ inc @r2
+endmcro
+mcro M693
+ inc @r2
+endmcro
+mcro M694
+ inc @r2
+endmcro
+mcro M695
+ inc @r2
+endmcro
+mcro M696
+ inc @r2
+endmcro
+mcro M697
+ inc @r2
+endmcro
+mcro M698
+ inc @r2
+endmcro
+mcro M699
+ inc @r2
+endmcro
+mcro M700
+ inc @r2
+endmcro
+mcro M701
+ inc @r2
+endmcro
+mcro M702
+ inc @r2
+endmcro
+mcro M703
+ inc @r2
+endmcro
+mcro M704
+ inc @r2
+endmcro
+mcro M705
+ inc @r2
+endmcro
+mcro M706
+ inc @r2
+endmcro
+mcro M707
+ inc @r2
+endmcro
+mcro M708
+ inc @r2
+endmcro
+mcro M709
+ inc @r2
+endmcro
+mcro M710
+ inc @r2
+endmcro
+mcro M711
+ inc @r2
+endmcro
+mcro M712
+ inc @r2
+endmcro
+mcro M713
+ inc @r2
+endmcro
+mcro M714
+ inc @r2
+endmcro
+mcro M715
+ inc @r2
+endmcro
+mcro M716
+ inc @r2
+endmcro
+mcro M717
+ inc @r2
+endmcro
+mcro M718
+ inc @r2
+endmcro
+mcro M719
+ inc @r2
+endmcro
+mcro M720
+ inc @r2
+endmcro
+mcro M721
+ inc @r2
+endmcro
+mcro M722
+ inc @r2
+endmcro
+mcro M723
+ inc @r2
+endmcro
+mcro M724
+ inc @r2
+endmcro
+mcro M725
+ inc @r2
+endmcro
+mcro M726
+ inc @r2
+endmcro
+mcro M727
+ inc @r2
+endmcro
+mcro M728
+ inc @r2
+endmcro
+mcro M729
+ inc @r2
+endmcro
+mcro M730
+ inc @r2
+endmcro
+mcro M731
+ inc @r2
+endmcro
+mcro M732
+ inc @r2
+endmcro
+mcro M733
+ inc @r2
+endmcro
+mcro M734
+ inc @r2
+endmcro
+mcro M735
+ inc @r2
+endmcro
+mcro M736
+ inc @r2
+endmcro
+mcro M737
+ inc @r2
+endmcro
+mcro M738
+ inc @r2
+endmcro
+mcro M739
+ inc @r2
+endmcro
+mcro M740
+ inc @r2
+endmcro
+mcro M741
+ inc @r2
+endmcro
+mcro M742
+ inc @r2
+endmcro
+mcro M743
+ inc @r2
+endmcro
+mcro M744
+ inc @r2
+endmcro
+mcro M745
+ inc @r2
+endmcro
+mcro M746
+ inc @r2
+endmcro
+mcro M747
+ inc @r2
+endmcro
+mcro M748
+ inc @r2
+endmcro
+mcro M749
+ inc @r2
+endmcro
+mcro M750
+ inc @r2
+endmcro
+mcro M751
+ inc @r2
+endmcro
+mcro M752
+ inc @r2
+endmcro
+mcro M753
+ inc @r2
+endmcro
+mcro M754
+ inc @r2
+endmcro
+mcro M755
+ inc @r2
+endmcro
+mcro M756
+ inc @r2
+endmcro
+mcro M757
+ inc @r2
+endmcro
+mcro M758
+ inc @r2
+endmcro
+mcro M759
+ inc @r2
+endmcro
+mcro M760
+ inc @r2
+endmcro
+mcro M761
+ inc @r2
+endmcro
+mcro M762
+ inc @r2
+endmcro
+mcro M763
+ inc @r2
+endmcro
+mcro M764
+ inc @r2
+endmcro
+mcro M765
+ inc @r2
+endmcro
+mcro M766
+ inc @r2
+endmcro
+mcro M767
+ inc @r2
+endmcro
+mcro M768
+ inc @r2
+endmcro
+mcro M769
+ inc @r2
+endmcro
+mcro M770
+ inc @r2
+endmcro
+mcro M771
+ inc @r2
+endmcro
+mcro M772
+ inc @r2
+endmcro
+mcro M773
+ inc @r2
+endmcro
+mcro M774
+ inc @r2
+endmcro
+mcro M775
+ inc @r2
+endmcro
+mcro M776
+ inc @r2
+endmcro
+mcro M777
+ inc @r2
+endmcro
+mcro M778
+ inc @r2
+endmcro
+mcro M779
+ inc @r2
+endmcro
+mcro M780
+ inc @r2
+endmcro
+mcro M781
+ inc @r2
+endmcro
+mcro M782
+ inc @r2
+endmcro
+mcro M783
+ inc @r2
+endmcro
+mcro M784
+ inc @r2
+endmcro
+mcro M785
+ inc @r2
+endmcro
+mcro M786
+ inc @r2
+endmcro
+mcro M787
+ inc @r2
+endmcro
+mcro M788
+ inc @r2
+endmcro
+mcro M789
+ inc @r2
+endmcro
+mcro M790
+ inc @r2
+endmcro
+mcro M791
+ inc @r2
+endmcro
+mcro M792
+ inc @r2
+endmcro
+mcro M793
+ inc @r2
+endmcro
+mcro M794
+ inc @r2
+endmcro
+mcro M795
+ inc @r2
+endmcro
+mcro M796
+ inc @r2
+endmcro
+mcro M797
+ inc @r2
+endmcro
+mcro M798
+ inc @r2
+endmcro
+mcro M799
+ inc @r2
+endmcro
+mcro M800
+ inc @r2
+endmcro
+mcro M801
+ inc @r2
+endmcro
+mcro M802
+ inc @r2
+endmcro
+mcro M803
+ inc @r2
+endmcro
+mcro M804
+ inc @r2
+endmcro
+mcro M805
+ inc @r2
+endmcro
+mcro M806
+ inc @r2
+endmcro
+mcro M807
+ inc @r2
+endmcro
+mcro M808
+ inc @r2
+endmcro
+mcro M809
+ inc @r2
+endmcro
+mcro M810
+ inc @r2
+endmcro
+mcro M811
+ inc @r2
+endmcro
+mcro M812
+ inc @r2
+endmcro
+mcro M813
+ inc @r2
+endmcro
+mcro M814
+ inc @r2
+endmcro
+mcro M815
+ inc @r2
+endmcro
+mcro M816
+ inc @r2
+endmcro
+mcro M817
+ inc @r2
+endmcro
+mcro M818
+ inc @r2
+endmcro
+mcro M819
+ inc @r2
+endmcro
+mcro M820
+ inc @r2
+endmcro
+mcro M821
+ inc @r2
+endmcro
+mcro M822
+ inc @r2
+endmcro
+mcro M823
+ inc @r2
+endmcro
+mcro M824
+ inc @r2
+endmcro
+mcro M825
+ inc @r2
+endmcro
+mcro M826
+ inc @r2
+endmcro
+mcro M827
+ inc @r2
+endmcro
+mcro M828
+ inc @r2
+endmcro
+mcro M829
+ inc @r2
+endmcro
+mcro M830
+ inc @r2
+endmcro
+mcro M831
+ inc @r2
+endmcro
+mcro M832
+ inc @r2
+endmcro
+mcro M833
+ inc @r2
+endmcro
+mcro M834
+ inc @r2
+endmcro
+mcro M835
+ inc @r2
+endmcro
+mcro M836
+ inc @r2
+endmcro
+mcro M837
+ inc @r2
+endmcro
+mcro M838
+ inc @r2
+endmcro
+mcro M839
+ inc @r2
+endmcro
+mcro M840
+ inc @r2
+endmcro
+mcro M841
+ inc @r2
+endmcro
+mcro M842
+ inc @r2
+endmcro
+mcro M843
+ inc @r2
+endmcro
+mcro M844
+ inc @r2
+endmcro
+mcro M845
+ inc @r2
+endmcro
+mcro M846
+ inc @r2
+endmcro
+mcro M847
+ inc @r2
+endmcro
+mcro M848
+ inc @r2
+endmcro
+mcro M849
+ inc @r2
+endmcro
+mcro M850
+ inc @r2
+endmcro
+mcro M851
+ inc @r2
+endmcro
+mcro M852
+ inc @r2
+endmcro
+mcro M853
+ inc @r2
+endmcro
+mcro M854
+ inc @r2
+endmcro
+mcro M855
+ inc @r2
+endmcro
+mcro M856
+ inc @r2
+endmcro
+mcro M857
+ inc @r2
+endmcro
+mcro M858
+ inc @r2
+endmcro
+mcro M859
+ inc @r2
+endmcro
+mcro M860
+ inc @r2
+endmcro
+mcro M861
+ inc @r2
+endmcro
+mcro M862
+ inc @r2
+endmcro
+mcro M863
+ inc @r2
+endmcro
+mcro M864
+ inc @r2
+endmcro
+mcro M865
+ inc @r2
+endmcro
+mcro M866
+ inc @r2
+endmcro
+mcro M867
+ inc @r2
+endmcro
+mcro M868
+ inc @r2
+endmcro
+mcro M869
+ inc @r2
+endmcro
+mcro M870
+ inc @r2
+endmcro
+mcro M871
+ inc @r2
+endmcro
+mcro M872
+ inc @r2
+endmcro
+mcro M873
+ inc @r2
+endmcro
+mcro M874
+ inc @r2
+endmcro
+mcro M875
+ inc @r2
+endmcro
+mcro M876
+ inc @r2
+endmcro
+mcro M877
+ inc @r2
+endmcro
+mcro M878
+ inc @r2
+endmcro
+mcro M879
+ inc @r2
+endmcro
+mcro M880
+ inc @r2
+endmcro
+mcro M881
+ inc @r2
+endmcro
+mcro M882
+ inc @r2
+endmcro
+mcro M883
+ inc @r2
+endmcro
+mcro M884
+ inc @r2
+endmcro
+mcro M885
+ inc @r2
+endmcro
+mcro M886
+ inc @r2
+endmcro
+mcro M887
+ inc @r2
+endmcro
+mcro M888
+ inc @r2
+endmcro
+mcro M889
+ inc @r2
+endmcro
+mcro M890
+ inc @r2
+endmcro
+mcro M891
+ inc @r2
+endmcro
+mcro M892
+ inc @r2
+endmcro
+mcro M893
+ inc @r2
+endmcro
+mcro M894
+ inc @r2
+endmcro
+mcro M895
+ inc @r2
+endmcro
+mcro M896
+ inc @r2
+endmcro
+mcro M897
+ inc @r2
+endmcro
+mcro M898
+ inc @r2
+endmcro
+mcro M899
+ inc @r2
+endmcro
+mcro M900
+ inc @r2
+endmcro
+mcro M901
+ inc @r2
+endmcro
+mcro M902
+ inc @r2
+endmcro
+mcro M903
+ inc @r2
+endmcro
+mcro M904
+ inc @r2
+endmcro
+mcro M905
+ inc @r2
+endmcro
+mcro M906
+ inc @r2
+endmcro
+mcro M907
+ inc @r2
+endmcro
+mcro M908
+ inc @r2
+endmcro
+mcro M909
+ inc @r2
+endmcro
+mcro M910
+ inc @r2
+endmcro
+mcro M911
+ inc @r2
+endmcro
+mcro M912
+ inc @r2
+endmcro
+mcro M913
+ inc @r2
+endmcro
+mcro M914
+ inc @r2
+endmcro
+mcro M915
+ inc @r2
+endmcro
+mcro M916
+ inc @r2
+endmcro
+mcro M917
+ inc @r2
+endmcro
+mcro M918
+ inc @r2
+endmcro
+mcro M919
+ inc @r2
+endmcro
+mcro M920
+ inc @r2
+endmcro
+mcro M921
+ inc @r2
+endmcro
+mcro M922
+ inc @r2
+endmcro
+mcro M923
+ inc @r2
+endmcro
+mcro M924
+ inc @r2
+endmcro
+mcro M925
+ inc @r2
+endmcro
+mcro M926
+ inc @r2
+endmcro
+mcro M927
+ inc @r2
+endmcro
+mcro M928
+ inc @r2
+endmcro
+mcro M929
+ inc @r2
+endmcro
+mcro M930
+ inc @r2
+endmcro
+mcro M931
+ inc @r2
+endmcro
+mcro M932
+ inc @r2
+endmcro
+mcro M933
+ inc @r2
+endmcro
+mcro M934
+ inc @r2
+endmcro
+mcro M935
+ inc @r2
+endmcro
+mcro M936
+ inc @r2
+endmcro
+mcro M937
+ inc @r2
+endmcro
+mcro M938
+ inc @r2
+endmcro
+mcro M939
+ inc @r2
+endmcro
+mcro M940
+ inc @r2
+endmcro
+mcro M941
+ inc @r2
+endmcro
+mcro M942
+ inc @r2
+endmcro
+mcro M943
+ inc @r2
+endmcro
+mcro M944
+ inc @r2
+endmcro
+mcro M945
+ inc @r2
+endmcro
+mcro M946
+ inc @r2
+endmcro
+mcro M947
+ inc @r2
+endmcro
+mcro M948
+ inc @r2
+endmcro
+mcro M949
+ inc @r2
+endmcro
+mcro M950
+ inc @r2
+endmcro
+mcro M951
+ inc @r2
+endmcro
+mcro M952
+ inc @r2
+endmcro
+mcro M953
+ inc @r2
+endmcro
+mcro M954
+ inc @r2
+endmcro
+mcro M955
+ inc @r2
+endmcro
+mcro M956
+ inc @r2
+endmcro
+mcro M957
+ inc @r2
+endmcro
+mcro M958
+ inc @r2
+endmcro
+mcro M959
+ inc @r2
+endmcro
+mcro M960
+ inc @r2
+endmcro
+mcro M961
+ inc @r2
+endmcro
+mcro M962
+ inc @r2
+endmcro
+mcro M963
+ inc @r2
+endmcro
+mcro M964
+ inc @r2
+endmcro
+mcro M965
+ inc @r2
+endmcro
+mcro M966
+ inc @r2
+endmcro
+mcro M967
+ inc @r2
+endmcro
+mcro M968
+ inc @r2
+endmcro
+mcro M969
+ inc @r2
+endmcro
+mcro M970
+ inc @r2
+endmcro
+mcro M971
+ inc @r2
+endmcro
+mcro M972
+ inc @r2
+endmcro
+mcro M973
+ inc @r2
+endmcro
+mcro M974
+ inc @r2
+endmcro
+mcro M975
+ inc @r2
+endmcro
+mcro M976
+ inc @r2
+endmcro
+mcro M977
+ inc @r2
+endmcro
+mcro M978
+ inc @r2
+endmcro
+mcro M979
+ inc @r2
+endmcro
+mcro M980
+ inc @r2
+endmcro
+mcro M981
+ inc @r2
+endmcro
+mcro M982
+ inc @r2
+endmcro
+mcro M983
+ inc @r2
+endmcro
+mcro M984
+ inc @r2
+endmcro
+mcro M985
+ inc @r2
+endmcro
+mcro M986
+ inc @r2
+endmcro
+mcro M987
+ inc @r2
+endmcro
+mcro M988
+ inc @r2
+endmcro
+mcro M989
+ inc @r2
+endmcro
+mcro M990
+ inc @r2
+endmcro
+mcro M991
+ inc @r2
+endmcro
+mcro M992
+ inc @r2
+endmcro
+mcro M993
+ inc @r2
+endmcro
+mcro M994
+ inc @r2
+endmcro
+mcro M995
+ inc @r2
+endmcro
+mcro M996
+ inc @r2
+endmcro
+mcro M997
+ inc @r2
+endmcro
+mcro M998
+ inc @r2
+endmcro
+mcro M999
+ inc @r2
+endmcro
+ stop
@@ -0,0 +1,1301 @@
+mcro M0
+ inc @r1
+ dec @r2
+endmcro
+mcro M1
+ inc @r1
+ dec @r2
+endmcro
+mcro M2
+ inc @r1
+ dec @r2
+endmcro
+mcro M3
+ inc @r1
+ dec @r2
+endmcro
+mcro M4
+ inc @r1
+ dec @r2
+endmcro
+mcro M5
+ inc @r1
+ dec @r2
+endmcro
+mcro M6
+ inc @r1
+ dec @r2
+endmcro
+mcro M7
+ inc @r1
+ dec @r2
+endmcro
+mcro M8
+ inc @r1
+ dec @r2
+endmcro
+mcro M9
+ inc @r1
+ dec @r2
+endmcro
+mcro M10
+ inc @r1
+ dec @r2
+endmcro
+mcro M11
+ inc @r1
+ dec @r2
+endmcro
+mcro M12
+ inc @r1
+ dec @r2
+endmcro
+mcro M13
+ inc @r1
+ dec @r2
+endmcro
+mcro M14
+ inc @r1
+ dec @r2
+endmcro
+mcro M15
+ inc @r1
+ dec @r2
+endmcro
+mcro M16
+ inc @r1
+ dec @r2
+endmcro
+mcro M17
+ inc @r1
+ dec @r2
+endmcro
+mcro M18
+ inc @r1
+ dec @r2
+endmcro
+mcro M19
+ inc @r1
+ dec @r2
+endmcro
+mcro M20
+ inc @r1
+ dec @r2
+endmcro
+mcro M21
+ inc @r1
+ dec @r2
+endmcro
+mcro M22
+ inc @r1
+ dec @r2
+endmcro
+mcro M23
+ inc @r1
+ dec @r2
+endmcro
+mcro M24
+ inc @r1
+ dec @r2
+endmcro
+mcro M25
+ inc @r1
+ dec @r2
+endmcro
+mcro M26
+ inc @r1
+ dec @r2
+endmcro
+mcro M27
+ inc @r1
+ dec @r2
+endmcro
+mcro M28
+ inc @r1
+ dec @r2
+endmcro
+mcro M29
+ inc @r1
+ dec @r2
+endmcro
+mcro M30
+ inc @r1
+ dec @r2
+endmcro
+mcro M31
+ inc @r1
+ dec @r2
+endmcro
+mcro M32
+ inc @r1
+ dec @r2
+endmcro
+mcro M33
+ inc @r1
+ dec @r2
+endmcro
+mcro M34
+ inc @r1
+ dec @r2
+endmcro
+mcro M35
+ inc @r1
+ dec @r2
+endmcro
+mcro M36
+ inc @r1
+ dec @r2
+endmcro
+mcro M37
+ inc @r1
+ dec @r2
+endmcro
+mcro M38
+ inc @r1
+ dec @r2
+endmcro
+mcro M39
+ inc @r1
+ dec @r2
+endmcro
+mcro M40
+ inc @r1
+ dec @r2
+endmcro
+mcro M41
+ inc @r1
+ dec @r2
+endmcro
+mcro M42
+ inc @r1
+ dec @r2
+endmcro
+mcro M43
+ inc @r1
+ dec @r2
+endmcro
+mcro M44
+ inc @r1
+ dec @r2
+endmcro
+mcro M45
+ inc @r1
+ dec @r2
+endmcro
+mcro M46
+ inc @r1
+ dec @r2
+endmcro
+mcro M47
+ inc @r1
+ dec @r2
+endmcro
+mcro M48
+ inc @r1
+ dec @r2
+endmcro
+mcro M49
+ inc @r1
+ dec @r2
+endmcro
+mcro M50
+ inc @r1
+ dec @r2
+endmcro
+mcro M51
+ inc @r1
+ dec @r2
+endmcro
+mcro M52
+ inc @r1
+ dec @r2
+endmcro
+mcro M53
+ inc @r1
+ dec @r2
+endmcro
+mcro M54
+ inc @r1
+ dec @r2
+endmcro
+mcro M55
+ inc @r1
+ dec @r2
+endmcro
+mcro M56
+ inc @r1
+ dec @r2
+endmcro
+mcro M57
+ inc @r1
+ dec @r2
+endmcro
+mcro M58
+ inc @r1
+ dec @r2
+endmcro
+mcro M59
+ inc @r1
+ dec @r2
+endmcro
+mcro M60
+ inc @r1
+ dec @r2
+endmcro
+mcro M61
+ inc @r1
+ dec @r2
+endmcro
+mcro M62
+ inc @r1
+ dec @r2
+endmcro
+mcro M63
+ inc @r1
+ dec @r2
+endmcro
+mcro M64
+ inc @r1
+ dec @r2
+endmcro
+mcro M65
+ inc @r1
+ dec @r2
+endmcro
+mcro M66
+ inc @r1
+ dec @r2
+endmcro
+mcro M67
+ inc @r1
+ dec @r2
+endmcro
+mcro M68
+ inc @r1
+ dec @r2
+endmcro
+mcro M69
+ inc @r1
+ dec @r2
+endmcro
+mcro M70
+ inc @r1
+ dec @r2
+endmcro
+mcro M71
+ inc @r1
+ dec @r2
+endmcro
+mcro M72
+ inc @r1
+ dec @r2
+endmcro
+mcro M73
+ inc @r1
+ dec @r2
+endmcro
+mcro M74
+ inc @r1
+ dec @r2
+endmcro
+mcro M75
+ inc @r1
+ dec @r2
+endmcro
+mcro M76
+ inc @r1
+ dec @r2
+endmcro
+mcro M77
+ inc @r1
+ dec @r2
+endmcro
+mcro M78
+ inc @r1
+ dec @r2
+endmcro
+mcro M79
+ inc @r1
+ dec @r2
+endmcro
+mcro M80
+ inc @r1
+ dec @r2
+endmcro
+mcro M81
+ inc @r1
+ dec @r2
+endmcro
+mcro M82
+ inc @r1
+ dec @r2
+endmcro
+mcro M83
+ inc @r1
+ dec @r2
+endmcro
+mcro M84
+ inc @r1
+ dec @r2
+endmcro
+mcro M85
+ inc @r1
+ dec @r2
+endmcro
+mcro M86
+ inc @r1
+ dec @r2
+endmcro
+mcro M87
+ inc @r1
+ dec @r2
+endmcro
+mcro M88
+ inc @r1
+ dec @r2
+endmcro
+mcro M89
+ inc @r1
+ dec @r2
+endmcro
+mcro M90
+ inc @r1
+ dec @r2
+endmcro
+mcro M91
+ inc @r1
+ dec @r2
+endmcro
+mcro M92
+ inc @r1
+ dec @r2
+endmcro
+mcro M93
+ inc @r1
+ dec @r2
+endmcro
+mcro M94
+ inc @r1
+ dec @r2
+endmcro
+mcro M95
+ inc @r1
+ dec @r2
+endmcro
+mcro M96
+ inc @r1
+ dec @r2
+endmcro
+mcro M97
+ inc @r1
+ dec @r2
+endmcro
+mcro M98
+ inc @r1
+ dec @r2
+endmcro
+mcro M99
+ inc @r1
+ dec @r2
+endmcro
+mcro M100
+ inc @r1
+ dec @r2
+endmcro
+mcro M101
+ inc @r1
+ dec @r2
+endmcro
+mcro M102
+ inc @r1
+ dec @r2
+endmcro
+mcro M103
+ inc @r1
+ dec @r2
+endmcro
+mcro M104
+ inc @r1
+ dec @r2
+endmcro
+mcro M105
+ inc @r1
+ dec @r2
+endmcro
+mcro M106
+ inc @r1
+ dec @r2
+endmcro
+mcro M107
+ inc @r1
+ dec @r2
+endmcro
+mcro M108
+ inc @r1
+ dec @r2
+endmcro
+mcro M109
+ inc @r1
+ dec @r2
+endmcro
+mcro M110
+ inc @r1
+ dec @r2
+endmcro
+mcro M111
+ inc @r1
+ dec @r2
+endmcro
+mcro M112
+ inc @r1
+ dec @r2
+endmcro
+mcro M113
+ inc @r1
+ dec @r2
+endmcro
+mcro M114
+ inc @r1
+ dec @r2
+endmcro
+mcro M115
+ inc @r1
+ dec @r2
+endmcro
+mcro M116
+ inc @r1
+ dec @r2
+endmcro
+mcro M117
+ inc @r1
+ dec @r2
+endmcro
+mcro M118
+ inc @r1
+ dec @r2
+endmcro
+mcro M119
+ inc @r1
+ dec @r2
+endmcro
+mcro M120
+ inc @r1
+ dec @r2
+endmcro
+mcro M121
+ inc @r1
+ dec @r2
+endmcro
+mcro M122
+ inc @r1
+ dec @r2
+endmcro
+mcro M123
+ inc @r1
+ dec @r2
+endmcro
+mcro M124
+ inc @r1
+ dec @r2
+endmcro
+mcro M125
+ inc @r1
+ dec @r2
+endmcro
+mcro M126
+ inc @r1
+ dec @r2
+endmcro
+mcro M127
+ inc @r1
+ dec @r2
+endmcro
+mcro M128
+ inc @r1
+ dec @r2
+endmcro
+mcro M129
+ inc @r1
+ dec @r2
+endmcro
+mcro M130
+ inc @r1
+ dec @r2
+endmcro
+mcro M131
+ inc @r1
+ dec @r2
+endmcro
+mcro M132
+ inc @r1
+ dec @r2
+endmcro
+mcro M133
+ inc @r1
+ dec @r2
+endmcro
+mcro M134
+ inc @r1
+ dec @r2
+endmcro
+mcro M135
+ inc @r1
+ dec @r2
+endmcro
+mcro M136
+ inc @r1
+ dec @r2
+endmcro
+mcro M137
+ inc @r1
+ dec @r2
+endmcro
+mcro M138
+ inc @r1
+ dec @r2
+endmcro
+mcro M139
+ inc @r1
+ dec @r2
+endmcro
+mcro M140
+ inc @r1
+ dec @r2
+endmcro
+mcro M141
+ inc @r1
+ dec @r2
+endmcro
+mcro M142
+ inc @r1
+ dec @r2
+endmcro
+mcro M143
+ inc @r1
+ dec @r2
+endmcro
+mcro M144
+ inc @r1
+ dec @r2
+endmcro
+mcro M145
+ inc @r1
+ dec @r2
+endmcro
+mcro M146
+ inc @r1
+ dec @r2
+endmcro
+mcro M147
+ inc @r1
+ dec @r2
+endmcro
+mcro M148
+ inc @r1
+ dec @r2
+endmcro
+mcro M149
+ inc @r1
+ dec @r2
+endmcro
+mcro M150
+ inc @r1
+ dec @r2
+endmcro
+mcro M151
+ inc @r1
+ dec @r2
+endmcro
+mcro M152
+ inc @r1
+ dec @r2
+endmcro
+mcro M153
+ inc @r1
+ dec @r2
+endmcro
+mcro M154
+ inc @r1
+ dec @r2
+endmcro
+mcro M155
+ inc @r1
+ dec @r2
+endmcro
+mcro M156
+ inc @r1
+ dec @r2
+endmcro
+mcro M157
+ inc @r1
+ dec @r2
+endmcro
+mcro M158
+ inc @r1
+ dec @r2
+endmcro
+mcro M159
+ inc @r1
+ dec @r2
+endmcro
+mcro M160
+ inc @r1
+ dec @r2
+endmcro
+mcro M161
+ inc @r1
+ dec @r2
+endmcro
+mcro M162
+ inc @r1
+ dec @r2
+endmcro
+mcro M163
+ inc @r1
+ dec @r2
+endmcro
+mcro M164
+ inc @r1
+ dec @r2
+endmcro
+mcro M165
+ inc @r1
+ dec @r2
+endmcro
+mcro M166
+ inc @r1
+ dec @r2
+endmcro
+mcro M167
+ inc @r1
+ dec @r2
+endmcro
+mcro M168
+ inc @r1
+ dec @r2
+endmcro
+mcro M169
+ inc @r1
+ dec @r2
+endmcro
+mcro M170
+ inc @r1
+ dec @r2
+endmcro
+mcro M171
+ inc @r1
+ dec @r2
+endmcro
+mcro M172
+ inc @r1
+ dec @r2
+endmcro
+mcro M173
+ inc @r1
+ dec @r2
+endmcro
+mcro M174
+ inc @r1
+ dec @r2
+endmcro
+mcro M175
+ inc @r1
+ dec @r2
+endmcro
+mcro M176
+ inc @r1
+ dec @r2
+endmcro
+mcro M177
+ inc @r1
+ dec @r2
+endmcro
+mcro M178
+ inc @r1
+ dec @r2
+endmcro
+mcro M179
+ inc @r1
+ dec @r2
+endmcro
+mcro M180
+ inc @r1
+ dec @r2
+endmcro
+mcro M181
+ inc @r1
+ dec @r2
+endmcro
+mcro M182
+ inc @r1
+ dec @r2
+endmcro
+mcro M183
+ inc @r1
+ dec @r2
+endmcro
+mcro M184
+ inc @r1
+ dec @r2
+endmcro
+mcro M185
+ inc @r1
+ dec @r2
+endmcro
+mcro M186
+ inc @r1
+ dec @r2
+endmcro
+mcro M187
+ inc @r1
+ dec @r2
+endmcro
+mcro M188
+ inc @r1
+ dec @r2
+endmcro
+mcro M189
+ inc @r1
+ dec @r2
+endmcro
+mcro M190
+ inc @r1
+ dec @r2
+endmcro
+mcro M191
+ inc @r1
+ dec @r2
+endmcro
+mcro M192
+ inc @r1
+ dec @r2
+endmcro
+mcro M193
+ inc @r1
+ dec @r2
+endmcro
+mcro M194
+ inc @r1
+ dec @r2
+endmcro
+mcro M195
+ inc @r1
+ dec @r2
+endmcro
+mcro M196
+ inc @r1
+ dec @r2
+endmcro
+mcro M197
+ inc @r1
+ dec @r2
+endmcro
+mcro M198
+ inc @r1
+ dec @r2
+endmcro
+mcro M199
+ inc @r1
+ dec @r2
+endmcro
+mcro M200
+ inc @r1
+ dec @r2
+endmcro
+mcro M201
+ inc @r1
+ dec @r2
+endmcro
+mcro M202
+ inc @r1
+ dec @r2
+endmcro
+mcro M203
+ inc @r1
+ dec @r2
+endmcro
+mcro M204
+ inc @r1
+ dec @r2
+endmcro
+mcro M205
+ inc @r1
+ dec @r2
+endmcro
+mcro M206
+ inc @r1
+ dec @r2
+endmcro
+mcro M207
+ inc @r1
+ dec @r2
+endmcro
+mcro M208
+ inc @r1
+ dec @r2
+endmcro
+mcro M209
+ inc @r1
+ dec @r2
+endmcro
+mcro M210
+ inc @r1
+ dec @r2
+endmcro
+mcro M211
+ inc @r1
+ dec @r2
+endmcro
+mcro M212
+ inc @r1
+ dec @r2
+endmcro
+mcro M213
+ inc @r1
+ dec @r2
+endmcro
+mcro M214
+ inc @r1
+ dec @r2
+endmcro
+mcro M215
+ inc @r1
+ dec @r2
+endmcro
+mcro M216
+ inc @r1
+ dec @r2
+endmcro
+mcro M217
+ inc @r1
+ dec @r2
+endmcro
+mcro M218
+ inc @r1
+ dec @r2
+endmcro
+mcro M219
+ inc @r1
+ dec @r2
+endmcro
+mcro M220
+ inc @r1
+ dec @r2
+endmcro
+mcro M221
+ inc @r1
+ dec @r2
+endmcro
+mcro M222
+ inc @r1
+ dec @r2
+endmcro
+mcro M223
+ inc @r1
+ dec @r2
+endmcro
+mcro M224
+ inc @r1
+ dec @r2
+endmcro
+mcro M225
+ inc @r1
+ dec @r2
+endmcro
+mcro M226
+ inc @r1
+ dec @r2
+endmcro
+mcro M227
+ inc @r1
+ dec @r2
+endmcro
+mcro M228
+ inc @r1
+ dec @r2
+endmcro
+mcro M229
+ inc @r1
+ dec @r2
+endmcro
+mcro M230
+ inc @r1
+ dec @r2
+endmcro
+mcro M231
+ inc @r1
+ dec @r2
+endmcro
+mcro M232
+ inc @r1
+ dec @r2
+endmcro
+mcro M233
+ inc @r1
+ dec @r2
+endmcro
+mcro M234
+ inc @r1
+ dec @r2
+endmcro
+mcro M235
+ inc @r1
+ dec @r2
+endmcro
+mcro M236
+ inc @r1
+ dec @r2
+endmcro
+mcro M237
+ inc @r1
+ dec @r2
+endmcro
+mcro M238
+ inc @r1
+ dec @r2
+endmcro
+mcro M239
+ inc @r1
+ dec @r2
+endmcro
+mcro M240
+ inc @r1
+ dec @r2
+endmcro
+mcro M241
+ inc @r1
+ dec @r2
+endmcro
+mcro M242
+ inc @r1
+ dec @r2
+endmcro
+mcro M243
+ inc @r1
+ dec @r2
+endmcro
+mcro M244
+ inc @r1
+ dec @r2
+endmcro
+mcro M245
+ inc @r1
+ dec @r2
+endmcro
+mcro M246
+ inc @r1
+ dec @r2
+endmcro
+mcro M247
+ inc @r1
+ dec @r2
+endmcro
+mcro M248
+ inc @r1
+ dec @r2
+endmcro
+mcro M249
+ inc @r1
+ dec @r2
+endmcro
+mcro M250
+ inc @r1
+ dec @r2
+endmcro
+mcro M251
+ inc @r1
+ dec @r2
+endmcro
+mcro M252
+ inc @r1
+ dec @r2
+endmcro
+mcro M253
+ inc @r1
+ dec @r2
+endmcro
+mcro M254
+ inc @r1
+ dec @r2
+endmcro
+mcro M255
+ inc @r1
+ dec @r2
+endmcro
+mcro M256
+ inc @r1
+ dec @r2
+endmcro
+mcro M257
+ inc @r1
+ dec @r2
+endmcro
+mcro M258
+ inc @r1
+ dec @r2
+endmcro
+mcro M259
+ inc @r1
+ dec @r2
+endmcro
+mcro M260
+ inc @r1
+ dec @r2
+endmcro
+mcro M261
+ inc @r1
+ dec @r2
+endmcro
+mcro M262
+ inc @r1
+ dec @r2
+endmcro
+mcro M263
+ inc @r1
+ dec @r2
+endmcro
+mcro M264
+ inc @r1
+ dec @r2
+endmcro
+mcro M265
+ inc @r1
+ dec @r2
+endmcro
+mcro M266
+ inc @r1
+ dec @r2
+endmcro
+mcro M267
+ inc @r1
+ dec @r2
+endmcro
+mcro M268
+ inc @r1
+ dec @r2
+endmcro
+mcro M269
+ inc @r1
+ dec @r2
+endmcro
+mcro M270
+ inc @r1
+ dec @r2
+endmcro
+mcro M271
+ inc @r1
+ dec @r2
+endmcro
+mcro M272
+ inc @r1
+ dec @r2
+endmcro
+mcro M273
+ inc @r1
+ dec @r2
+endmcro
+mcro M274
+ inc @r1
+ dec @r2
+endmcro
+mcro M275
+ inc @r1
+ dec @r2
+endmcro
+mcro M276
+ inc @r1
+ dec @r2
+endmcro
+mcro M277
+ inc @r1
+ dec @r2
+endmcro
+mcro M278
+ inc @r1
+ dec @r2
+endmcro
+mcro M279
+ inc @r1
+ dec @r2
+endmcro
+mcro M280
+ inc @r1
+ dec @r2
+endmcro
+mcro M281
+ inc @r1
+ dec @r2
+endmcro
+mcro M282
+ inc @r1
+ dec @r2
+endmcro
+mcro M283
+ inc @r1
+ dec @r2
+endmcro
+mcro M284
+ inc @r1
+ dec @r2
+endmcro
+mcro M285
+ inc @r1
+ dec @r2
+endmcro
+mcro M286
+ inc @r1
+ dec @r2
+endmcro
+mcro M287
+ inc @r1
+ dec @r2
+endmcro
+mcro M288
+ inc @r1
+ dec @r2
+endmcro
+mcro M289
+ inc @r1
+ dec @r2
+endmcro
+mcro M290
+ inc @r1
+ dec @r2
+endmcro
+mcro M291
+ inc @r1
+ dec @r2
+endmcro
+mcro M292
+ inc @r1
+ dec @r2
+endmcro
+mcro M293
+ inc @r1
+ dec @r2
+endmcro
+mcro M294
+ inc @r1
+ dec @r2
+endmcro
+mcro M295
+ inc @r1
+ dec @r2
+endmcro
+mcro M296
+ inc @r1
+ dec @r2
+endmcro
+mcro M297
+ inc @r1
+ dec @r2
+endmcro
+mcro M298
+ inc @r1
+ dec @r2
+endmcro
+mcro M299
+ inc @r1
+ dec @r2
+endmcro
+MAIN: stop
+M0
+M3
+M6
+M9
+M12
+M15
+M18
+M21
+M24
+M27
+M30
+M33
+M36
+M39
+M42
+M45
+M48
+M51
+M54
+M57
+M60
+M63
+M66
+M69
+M72
+M75
+M78
+M81
+M84
+M87
+M90
+M93
+M96
+M99
+M102
+M105
+M108
+M111
+M114
+M117
+M120
+M123
+M126
+M129
+M132
+M135
+M138
+M141
+M144
+M147
+M150
+M153
+M156
+M159
+M162
+M165
+M168
+M171
+M174
+M177
+M180
+M183
+M186
+M189
+M192
+M195
+M198
+M201
+M204
+M207
+M210
+M213
+M216
+M219
+M222
+M225
+M228
+M231
+M234
+M237
+M240
+M243
+M246
+M249
+M252
+M255
+M258
+M261
+M264
+M267
+M270
+M273
+M276
+M279
+M282
+M285
+M288
+M291
+M294
+M297
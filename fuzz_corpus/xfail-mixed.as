@@ -0,0 +1,367 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.extern X25
+.extern X26
+.extern X27
+.extern X28
+.extern X29
+.extern X30
+.extern X31
+.extern X32
+.extern X33
+.extern X34
+.extern X35
+.extern X36
+.extern X37
+.extern X38
+.extern X39
+F0: mov @r0, @r1
+ cmp X0, @r1
+ bne F0
+ add -0, @r3
+ lea D0, @r4
+F1: mov @r1, @r2
+ cmp X1, @r1
+ bne F0
+ add -1, @r3
+ lea D1, @r4
+F2: mov @r2, @r3
+ cmp X2, @r1
+ bne F1
+ add -2, @r3
+ lea D2, @r4
+F3: mov @r3, @r4
+ cmp X3, @r1
+ bne F1
+ add -3, @r3
+ lea D3, @r4
+F4: mov @r4, @r5
+ cmp X4, @r1
+ bne F2
+ add -4, @r3
+ lea D4, @r4
+F5: mov @r5, @r6
+ cmp X5, @r1
+ bne F2
+ add -5, @r3
+ lea D5, @r4
+F6: mov @r6, @r7
+ cmp X6, @r1
+ bne F3
+ add -6, @r3
+ lea D6, @r4
+F7: mov @r7, @r0
+ cmp X7, @r1
+ bne F3
+ add -7, @r3
+ lea D7, @r4
+F8: mov @r0, @r1
+ cmp X8, @r1
+ bne F4
+ add -8, @r3
+ lea D8, @r4
+F9: mov @r1, @r2
+ cmp X9, @r1
+ bne F4
+ add -9, @r3
+ lea D9, @r4
+F10: mov @r2, @r3
+ cmp X10, @r1
+ bne F5
+ add -10, @r3
+ lea D10, @r4
+F11: mov @r3, @r4
+ cmp X11, @r1
+ bne F5
+ add -11, @r3
+ lea D11, @r4
+F12: mov @r4, @r5
+ cmp X12, @r1
+ bne F6
+ add -12, @r3
+ lea D12, @r4
+F13: mov @r5, @r6
+ cmp X13, @r1
+ bne F6
+ add -13, @r3
+ lea D13, @r4
+F14: mov @r6, @r7
+ cmp X14, @r1
+ bne F7
+ add -14, @r3
+ lea D14, @r4
+F15: mov @r7, @r0
+ cmp X15, @r1
+ bne F7
+ add -15, @r3
+ lea D15, @r4
+F16: mov @r0, @r1
+ cmp X16, @r1
+ bne F8
+ add -16, @r3
+ lea D16, @r4
+F17: mov @r1, @r2
+ cmp X17, @r1
+ bne F8
+ add -17, @r3
+ lea D17, @r4
+F18: mov @r2, @r3
+ cmp X18, @r1
+ bne F9
+ add -18, @r3
+ lea D18, @r4
+F19: mov @r3, @r4
+ cmp X19, @r1
+ bne F9
+ add -19, @r3
+ lea D19, @r4
+F20: mov @r4, @r5
+ cmp X20, @r1
+ bne F10
+ add -20, @r3
+ lea D0, @r4
+F21: mov @r5, @r6
+ cmp X21, @r1
+ bne F10
+ add -21, @r3
+ lea D1, @r4
+F22: mov @r6, @r7
+ cmp X22, @r1
+ bne F11
+ add -22, @r3
+ lea D2, @r4
+F23: mov @r7, @r0
+ cmp X23, @r1
+ bne F11
+ add -23, @r3
+ lea D3, @r4
+F24: mov @r0, @r1
+ cmp X24, @r1
+ bne F12
+ add -24, @r3
+ lea D4, @r4
+F25: mov @r1, @r2
+ cmp X25, @r1
+ bne F12
+ add -25, @r3
+ lea D5, @r4
+F26: mov @r2, @r3
+ cmp X26, @r1
+ bne F13
+ add -26, @r3
+ lea D6, @r4
+F27: mov @r3, @r4
+ cmp X27, @r1
+ bne F13
+ add -27, @r3
+ lea D7, @r4
+F28: mov @r4, @r5
+ cmp X28, @r1
+ bne F14
+ add -28, @r3
+ lea D8, @r4
+F29: mov @r5, @r6
+ cmp X29, @r1
+ bne F14
+ add -29, @r3
+ lea D9, @r4
+F30: mov @r6, @r7
+ cmp X30, @r1
+ bne F15
+ add -30, @r3
+ lea D10, @r4
+F31: mov @r7, @r0
+ cmp X31, @r1
+ bne F15
+ add -31, @r3
+ lea D11, @r4
+F32: mov @r0, @r1
+ cmp X32, @r1
+ bne F16
+ add -32, @r3
+ lea D12, @r4
+F33: mov @r1, @r2
+ cmp X33, @r1
+ bne F16
+ add -33, @r3
+ lea D13, @r4
+F34: mov @r2, @r3
+ cmp X34, @r1
+ bne F17
+ add -34, @r3
+ lea D14, @r4
+F35: mov @r3, @r4
+ cmp X35, @r1
+ bne F17
+ add -35, @r3
+ lea D15, @r4
+F36: mov @r4, @r5
+ cmp X36, @r1
+ bne F18
+ add -36, @r3
+ lea D16, @r4
+F37: mov @r5, @r6
+ cmp X37, @r1
+ bne F18
+ add -37, @r3
+ lea D17, @r4
+F38: mov @r6, @r7
+ cmp X38, @r1
+ bne F19
+ add -38, @r3
+ lea D18, @r4
+F39: mov @r7, @r0
+ cmp X39, @r1
+ bne F19
+ add -39, @r3
+ lea D19, @r4
+F40: mov @r0, @r1
+ cmp X0, @r1
+ bne F20
+ add -40, @r3
+ lea D0, @r4
+F41: mov @r1, @r2
+ cmp X1, @r1
+ bne F20
+ add -41, @r3
+ lea D1, @r4
+F42: mov @r2, @r3
+ cmp X2, @r1
+ bne F21
+ add -42, @r3
+ lea D2, @r4
+F43: mov @r3, @r4
+ cmp X3, @r1
+ bne F21
+ add -43, @r3
+ lea D3, @r4
+F44: mov @r4, @r5
+ cmp X4, @r1
+ bne F22
+ add -44, @r3
+ lea D4, @r4
+F45: mov @r5, @r6
+ cmp X5, @r1
+ bne F22
+ add -45, @r3
+ lea D5, @r4
+F46: mov @r6, @r7
+ cmp X6, @r1
+ bne F23
+ add -46, @r3
+ lea D6, @r4
+F47: mov @r7, @r0
+ cmp X7, @r1
+ bne F23
+ add -47, @r3
+ lea D7, @r4
+F48: mov @r0, @r1
+ cmp X8, @r1
+ bne F24
+ add -48, @r3
+ lea D8, @r4
+F49: mov @r1, @r2
+ cmp X9, @r1
+ bne F24
+ add -49, @r3
+ lea D9, @r4
+F50: mov @r2, @r3
+ cmp X10, @r1
+ bne F25
+ add -50, @r3
+ lea D10, @r4
+F51: mov @r3, @r4
+ cmp X11, @r1
+ bne F25
+ add -51, @r3
+ lea D11, @r4
+F52: mov @r4, @r5
+ cmp X12, @r1
+ bne F26
+ add -52, @r3
+ lea D12, @r4
+F53: mov @r5, @r6
+ cmp X13, @r1
+ bne F26
+ add -53, @r3
+ lea D13, @r4
+F54: mov @r6, @r7
+ cmp X14, @r1
+ bne F27
+ add -54, @r3
+ lea D14, @r4
+F55: mov @r7, @r0
+ cmp X15, @r1
+ bne F27
+ add -55, @r3
+ lea D15, @r4
+F56: mov @r0, @r1
+ cmp X16, @r1
+ bne F28
+ add -56, @r3
+ lea D16, @r4
+F57: mov @r1, @r2
+ cmp X17, @r1
+ bne F28
+ add -57, @r3
+ lea D17, @r4
+F58: mov @r2, @r3
+ cmp X18, @r1
+ bne F29
+ add -58, @r3
+ lea D18, @r4
+F59: mov @r3, @r4
+ cmp X19, @r1
+ bne F29
+ add -59, @r3
+ lea D19, @r4
+ stop
+D0: .data 0, 0
+D1: .data 1, -1
+D2: .data 2, -2
+D3: .data 3, -3
+D4: .data 4, -4
+D5: .data 5, -5
+D6: .data 6, -6
+D7: .data 7, -7
+D8: .data 8, -8
+D9: .data 9, -9
+D10: .data 10, -10
+D11: .data 11, -11
+D12: .data 12, -12
+D13: .data 13, -13
+D14: .data 14, -14
+D15: .data 15, -15
+D16: .data 16, -16
+D17: .data 17, -17
+D18: .data 18, -18
+D19: .data 19, -19
+ .entry F0
+ .entry F10
+ .entry F20
+ .entry F30
+ .entry F40
+ .entry F50
@@ -0,0 +1,462 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "fuzzer.h"
+#include "frame.h"
+#include "utils.h"
+
+#define DEFAULT_RUNS 2000
+#define DEFAULT_MAX_LENGTH (64 * 1024)
+#define MAX_POPULATION 256
+#define MAX_PATH_LENGTH 1024
+#define MAX_GENERATED_LINE 64
+#define MAX_MUTATIONS 4
+#define REPORT_EVERY 100
+#define FUZZ_SCALE_RUNS 5 /* the scales of '-check' cost the cheapest of this many measurements */
+
+/* An input of the population, with its cost per byte */
+typedef struct fuzz_input {
+    unsigned char *data;
+    size_t size;
+    double perByte; /* 0 for inputs too small to be scored */
+} fuzz_input;
+
+/* The results of '-check' over the regression corpus */
+typedef struct corpus_check {
+    double fixedCost; /* the cost of assembling a single line, taken out of the cost of every scale */
+    int slow; /* inputs that cost too much */
+    int expectedSlow; /* inputs that cost too much and are marked with FUZZ_EXPECTED_SLOW_PREFIX */
+    int scaled; /* inputs not marked as slow whose growth was checked over all the scales */
+} corpus_check;
+
+/* The inputs the mutations start from, the slowest ones found so far */
+typedef struct population {
+    fuzz_input inputs[MAX_POPULATION];
+    int count;
+} population;
+
+/* pieces of source that the mutations insert, so that they get past the tokenizer */
+static const char *dictionary[] = {
+    "mov ", "cmp ", "add ", "sub ", "lea ", "not ", "clr ", "inc ", "dec ", "jmp ", "bne ", "red ", "prn ", "jsr ",
+    "rts\n", "stop\n", "@r1", "@r7", ", ", "\n", ":", " ", "-5", "+17", "4095", "\"", ";",
+    ".data ", ".string ", ".entry ", ".extern ", ".pool ", ".keep ", ".space ", ".fill ",
+    "mcro ", "endmcro\n", "MAIN", "LOOP", "X"
+};
+
+/* whole lines that stress the tables, each with a new name every time */
+static const char *generatedLines[] = {
+    ".extern E%ld\n",
+    "L%ld: inc @r1\n",
+    " .entry L%ld\n",
+    "mcro M%ld\n inc @r2\nendmcro\n",
+    "M%ld\n",
+    " jmp L%ld\n",
+    "D%ld: .data 1, 2, 3\n",
+    " prn E%ld\n"
+};
+
+static long nextName = 0; /* numbers the names of the generated lines */
+
+/**
+ * Returns a random number below a bound.
+ * @param bound The bound (at least 1).
+ * @return A number from 0 to bound - 1.
+ */
+static size_t randomBelow (size_t bound) {
+    return (size_t) (((double) rand() / ((double) RAND_MAX + 1)) * bound);
+}
+
+/**
+ * Replaces the bytes from start to end of an input with other bytes.
+ * @param input The input, which is reallocated.
+ * @param start The first byte replaced.
+ * @param end The byte after the last one replaced.
+ * @param bytes The new bytes.
+ * @param length The number of new bytes.
+ * @param maxLength The maximum size of an input, longer results are not made.
+ * @return TRUE if the input was changed, FALSE otherwise.
+ */
+static boolean replaceBytes (fuzz_input *input, size_t start, size_t end, const unsigned char *bytes, size_t length, size_t maxLength) {
+    unsigned char *data;
+    size_t size = input->size - (end - start) + length;
+
+    if (size == 0 || size > maxLength || (data = malloc(size)) == NULL)
+        return FALSE;
+    memcpy(data, input->data, start);
+    memcpy(data + start, bytes, length);
+    memcpy(data + start + length, input->data + end, input->size - end);
+    free(input->data);
+    input->data = data;
+    input->size = size;
+    return TRUE;
+}
+
+/**
+ * Finds the start of the line of a byte.
+ * @param input The input.
+ * @param position The byte.
+ * @return The index of the first byte of its line.
+ */
+static size_t lineStart (fuzz_input *input, size_t position) {
+    while (position > 0 && input->data[position - 1] != '\n')
+        position--;
+    return position;
+}
+
+/**
+ * Finds the end of the line of a byte.
+ * @param input The input.
+ * @param position The byte.
+ * @return The index after the new line that ends the line (or the size of the input).
+ */
+static size_t lineEnd (fuzz_input *input, size_t position) {
+    while (position < input->size && input->data[position] != '\n')
+        position++;
+    return (position < input->size) ? position + 1 : position;
+}
+
+/**
+ * Applies a random mutation to an input: changes a byte, inserts a piece of the dictionary or a generated line,
+ * deletes a line, or copies a run of lines to another place (which is how the inputs grow).
+ * @param input The input.
+ * @param maxLength The maximum size of an input.
+ */
+static void mutate (fuzz_input *input, size_t maxLength) {
+    char generated[MAX_GENERATED_LINE];
+    unsigned char byte, *copy;
+    size_t position = randomBelow(input->size + 1), start, end;
+
+    switch (randomBelow(6)) {
+        case 0:
+            if (position < input->size) {
+                byte = (unsigned char) dictionary[randomBelow(sizeof(dictionary) / sizeof(dictionary[0]))][0];
+                replaceBytes(input, position, position + 1, &byte, 1, maxLength);
+            }
+            break;
+        case 1:
+            start = randomBelow(sizeof(dictionary) / sizeof(dictionary[0]));
+            replaceBytes(input, position, position, (const unsigned char *) dictionary[start], strlen(dictionary[start]), maxLength);
+            break;
+        case 2:
+        case 3:
+            /* new names keep the tables growing, rather than stopping at the first duplicate */
+            sprintf(generated, generatedLines[randomBelow(sizeof(generatedLines) / sizeof(generatedLines[0]))], nextName++);
+            position = lineStart(input, position < input->size ? position : input->size);
+            replaceBytes(input, position, position, (unsigned char *) generated, strlen(generated), maxLength);
+            break;
+        case 4:
+            if (position < input->size) {
+                start = lineStart(input, position);
+                replaceBytes(input, start, lineEnd(input, position), NULL, 0, maxLength);
+            }
+            break;
+        default:
+            if (position < input->size) {
+                start = lineStart(input, position);
+                end = lineEnd(input, randomBelow(input->size - position) + position);
+                copy = malloc(end - start);
+                if (copy == NULL)
+                    break;
+                memcpy(copy, input->data + start, end - start);
+                position = lineStart(input, randomBelow(input->size));
+                replaceBytes(input, position, position, copy, end - start, maxLength);
+                free(copy);
+            }
+            break;
+    }
+}
+
+/**
+ * Adds an input to the population, replacing the cheapest one if it is full and the input costs more.
+ * @param inputs The population.
+ * @param input The input, which the population takes over (or frees).
+ */
+static void addToPopulation (population *inputs, fuzz_input *input) {
+    int i, cheapest = 0;
+
+    if (inputs->count < MAX_POPULATION) {
+        inputs->inputs[inputs->count++] = *input;
+        return;
+    }
+    for (i = 1; i < inputs->count; i++) {
+        if (inputs->inputs[i].perByte < inputs->inputs[cheapest].perByte)
+            cheapest = i;
+    }
+    if (input->perByte > inputs->inputs[cheapest].perByte) {
+        free(inputs->inputs[cheapest].data);
+        inputs->inputs[cheapest] = *input;
+    } else {
+        free(input->data);
+    }
+}
+
+/**
+ * Reads all the files of a directory.
+ * @param directory The path of the directory.
+ * @param onFile Called with every file that was read, which it takes over.
+ * @param context The context of onFile.
+ * @return The number of files read, or -1 if the directory could not be opened.
+ */
+static int readDirectory (const char *directory, void (*onFile)(const char *, fuzz_input *, void *), void *context) {
+    char path[2 * MAX_PATH_LENGTH];
+    struct dirent *entry;
+    struct stat status;
+    fuzz_input input;
+    long length;
+    int count = 0;
+    DIR *files = opendir(directory);
+    FILE *file;
+
+    if (files == NULL)
+        return -1;
+    while ((entry = readdir(files)) != NULL) {
+        sprintf(path, "%.1000s/%.1000s", directory, entry->d_name);
+        if (entry->d_name[0] == '.' || stat(path, &status) != 0 || !S_ISREG(status.st_mode))
+            continue;
+        file = fopen(path, "rb");
+        if (file == NULL)
+            continue;
+        input.data = (unsigned char *) readFileContents(file, &length);
+        fclose(file);
+        if (input.data == NULL || length == 0) {
+            free(input.data);
+            continue;
+        }
+        input.size = length;
+        input.perByte = 0;
+        onFile(path, &input, context);
+        count++;
+    }
+    closedir(files);
+    return count;
+}
+
+/**
+ * Checks if a file of the regression corpus is marked as known to be slow.
+ * @param path The path of the file.
+ * @return TRUE if its name starts with FUZZ_EXPECTED_SLOW_PREFIX, FALSE otherwise.
+ */
+static boolean isExpectedSlow (const char *path) {
+    const char *name = strrchr(path, '/');
+    name = (name != NULL) ? name + 1 : path;
+    return (strncmp(name, FUZZ_EXPECTED_SLOW_PREFIX, strlen(FUZZ_EXPECTED_SLOW_PREFIX)) == 0);
+}
+
+/**
+ * Scores a file of the starting corpus and adds it to the population. The inputs known to be slow are left out,
+ * so that the mutations look for other slow paths.
+ * @param path The path of the file.
+ * @param input Its contents.
+ * @param context The population.
+ */
+static void addSeed (const char *path, fuzz_input *input, void *context) {
+    if (isFuzzableInput(input->data, input->size) == FALSE || isExpectedSlow(path) == TRUE) {
+        free(input->data);
+        return;
+    }
+    input->perByte = (input->size >= FUZZ_MIN_SCORED_BYTES) ? measureCostPerByte(input->data, input->size) : 0;
+    addToPopulation(context, input);
+}
+
+/**
+ * Measures the cost of an input more steadily than measureCost, since the small scales take only microseconds.
+ * @param data The input.
+ * @param size The number of bytes in data (at least 1).
+ * @return The cheapest cost of FUZZ_SCALE_RUNS times FUZZ_COST_RUNS runs.
+ */
+static double measureSteadyCost (const unsigned char *data, size_t size) {
+    double cost, cheapest = -1;
+    int i;
+
+    for (i = 0; i < FUZZ_SCALE_RUNS; i++) {
+        cost = measureCost(data, size);
+        if (cheapest < 0 || cost < cheapest)
+            cheapest = cost;
+    }
+    return cheapest;
+}
+
+/**
+ * Checks that a file of the regression corpus costs at most the limit per byte, and that its cost per byte does
+ * not grow with its size: its first sixteenth, its first quarter and the whole input (each four times bigger than
+ * the one before) may each cost at most FUZZ_GROWTH_LIMIT times more per byte than the one before. Inputs known to
+ * be slow may grow up to FUZZ_EXPECTED_GROWTH_LIMIT, so they still fail if they get any slower. Inputs whose
+ * sixteenth costs less than the fixed cost of a run are too cheap to be scaled. Prints the costs.
+ * @param path The path of the file.
+ * @param input Its contents.
+ * @param context The corpus check.
+ */
+static void checkCorpusFile (const char *path, fuzz_input *input, void *context) {
+    corpus_check *check = context;
+    boolean scored = (input->size >= FUZZ_MIN_SCORED_BYTES && isFuzzableInput(input->data, input->size) == TRUE);
+    boolean slow, expected = isExpectedSlow(path), worse;
+    size_t size = input->size / (FUZZ_SCALE_STEP * FUZZ_SCALE_STEP), length;
+    double perByte, cost, scaled[FUZZ_SCALES], growth = 0;
+    char growthText[32];
+    int i;
+
+    if (scored == FALSE) {
+        printf("%-40s %8lu bytes  not scored\n", path, (unsigned long) input->size);
+        free(input->data);
+        return;
+    }
+    perByte = measureCostPerByte(input->data, input->size);
+    for (i = 0; i < FUZZ_SCALES && size > 0; i++, size *= FUZZ_SCALE_STEP) {
+        /* every scale ends with a whole line, and costs what it costs more than a run over a single line */
+        length = (i == FUZZ_SCALES - 1) ? input->size : lineEnd(input, size - 1);
+        cost = measureSteadyCost(input->data, length) - check->fixedCost;
+        /* below the fixed cost, the growth would only be that of the noise of the fixed cost */
+        if (i == 0 && cost < check->fixedCost)
+            break;
+        scaled[i] = cost / length;
+        if (i > 0 && scaled[i - 1] > 0 && scaled[i] / scaled[i - 1] > growth)
+            growth = scaled[i] / scaled[i - 1];
+    }
+
+    slow = (perByte > costPerByteLimit || growth > FUZZ_GROWTH_LIMIT);
+    worse = (expected == TRUE && growth > FUZZ_EXPECTED_GROWTH_LIMIT);
+    if (i == FUZZ_SCALES)
+        sprintf(growthText, "x%.1f per scale", growth);
+    else
+        strcpy(growthText, "not scaled");
+    if (i == FUZZ_SCALES && expected == FALSE)
+        check->scaled++;
+    printf("%-40s %8lu bytes %10.1f %s per byte, %-15s %s\n", path, (unsigned long) input->size, perByte,
+           costUnitName(), growthText,
+           worse ? "SLOW (worse than expected)" : slow ? (expected ? "SLOW (expected)" : "SLOW") : "ok");
+    if (slow == TRUE && expected == TRUE && worse == FALSE)
+        check->expectedSlow++;
+    else if (slow == TRUE)
+        check->slow++;
+    free(input->data);
+}
+
+/**
+ * Mutates the population for a number of runs, and saves every scored input that costs more than the limit per byte.
+ * @param inputs The population.
+ * @param runs The number of mutated inputs to try.
+ * @param maxLength The maximum size of an input.
+ * @return The number of slow inputs saved.
+ */
+static int fuzz (population *inputs, long runs, size_t maxLength) {
+    fuzz_input input, *parent;
+    char path[64];
+    double slowest = 0;
+    long run;
+    int i, mutations, saved = 0;
+
+    for (run = 1; run <= runs; run++) {
+        parent = &inputs->inputs[randomBelow(inputs->count)];
+        input.data = malloc(parent->size);
+        if (input.data == NULL)
+            break;
+        memcpy(input.data, parent->data, parent->size);
+        input.size = parent->size;
+        mutations = 1 + (int) randomBelow(MAX_MUTATIONS);
+        for (i = 0; i < mutations; i++)
+            mutate(&input, maxLength);
+
+        if (isFuzzableInput(input.data, input.size) == FALSE) {
+            free(input.data);
+            continue;
+        }
+        input.perByte = measureCostPerByte(input.data, input.size);
+        if (input.size < FUZZ_MIN_SCORED_BYTES)
+            input.perByte = 0;
+        if (input.perByte > slowest)
+            slowest = input.perByte;
+        if (input.perByte > costPerByteLimit && saveSlowInput(input.data, input.size, path) == TRUE) {
+            printf("#%ld slow input: %.1f %s per byte over %lu bytes, saved to '%s'\n", run, input.perByte,
+                   costUnitName(), (unsigned long) input.size, path);
+            saved++;
+        }
+        /* the inputs that cost more per byte than the one they came from lead towards the slow paths,
+           and until they are big enough to be scored, the bigger ones lead there */
+        if ((input.perByte > 0) ? input.perByte > parent->perByte : input.size > parent->size)
+            addToPopulation(inputs, &input);
+        else
+            free(input.data);
+        if (run % REPORT_EVERY == 0)
+            printf("#%ld population: %d, slowest: %.1f %s per byte\n", run, inputs->count, slowest, costUnitName());
+    }
+    return saved;
+}
+
+int main (int argc, char *argv[]) {
+    population inputs;
+    corpus_check corpus;
+    fuzz_input seed;
+    long runs = DEFAULT_RUNS, maxLength = DEFAULT_MAX_LENGTH, randomSeed = 1;
+    boolean check = FALSE;
+    int i, slow = 0, directories = 0;
+    char *value;
+
+    initFuzzTarget();
+    inputs.count = 0;
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-check") == 0)
+            check = TRUE;
+        else if (strncmp(argv[i], "-runs=", 6) == 0)
+            runs = atol(argv[i] + 6);
+        else if (strncmp(argv[i], "-seed=", 6) == 0)
+            randomSeed = atol(argv[i] + 6);
+        else if (strncmp(argv[i], "-max_len=", 9) == 0)
+            maxLength = atol(argv[i] + 9);
+        else if (strncmp(argv[i], "-limit=", 7) == 0 && atof(value = argv[i] + 7) > 0)
+            costPerByteLimit = atof(value);
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: fuzzer [-check] [-runs=N] [-seed=N] [-max_len=BYTES] [-limit=COST] <corpus directory>...\n");
+            return 1;
+        }
+    }
+    srand((unsigned int) randomSeed);
+    printf("cost per byte limit: %.1f %s, inputs under %d bytes are not scored\n", costPerByteLimit, costUnitName(), FUZZ_MIN_SCORED_BYTES);
+    if (check == TRUE) {
+        corpus.fixedCost = measureSteadyCost((const unsigned char *) " stop\n", strlen(" stop\n"));
+        corpus.slow = 0;
+        corpus.expectedSlow = 0;
+        corpus.scaled = 0;
+        printf("growth limit: x%.1f per byte from each scale to the next, %d times bigger (%.0f %s per run taken out), "
+               "x%.1f for the inputs known to be slow\n", FUZZ_GROWTH_LIMIT, FUZZ_SCALE_STEP, corpus.fixedCost,
+               costUnitName(), FUZZ_EXPECTED_GROWTH_LIMIT);
+    }
+
+    for (i = 1; i < argc; i++) {
+        if (argv[i][0] == '-')
+            continue;
+        directories++;
+        if (readDirectory(argv[i], check ? checkCorpusFile : addSeed, check ? (void *) &corpus : (void *) &inputs) < 0)
+            fprintf(stderr, "fuzzer: cannot read the directory '%s'\n", argv[i]);
+    }
+    if (check == TRUE) {
+        if (directories == 0)
+            fprintf(stderr, "fuzzer: -check needs a corpus directory\n");
+        printf("%d inputs cost more than the limits, and %d more are known to be slow\n", corpus.slow,
+               corpus.expectedSlow);
+        /* without a single scaled input, nothing checked that the costs grow linearly */
+        printf("%d inputs had their growth checked\n", corpus.scaled);
+        if (corpus.scaled == 0)
+            fprintf(stderr, "fuzzer: no input of the corpus was big enough to be scaled\n");
+        return (corpus.slow > 0 || corpus.scaled == 0 || directories == 0) ? 1 : 0;
+    }
+
+    if (inputs.count == 0) {
+        seed.data = malloc(strlen(" stop\n"));
+        if (seed.data == NULL)
+            return 1;
+        memcpy(seed.data, " stop\n", strlen(" stop\n"));
+        seed.size = strlen(" stop\n");
+        seed.perByte = measureCostPerByte(seed.data, seed.size);
+        addToPopulation(&inputs, &seed);
+    }
+    slow = fuzz(&inputs, runs, (size_t) maxLength);
+    printf("%d slow inputs saved to '%s'\n", slow, FUZZ_SLOW_DIRECTORY);
+    for (i = 0; i < inputs.count; i++)
+        free(inputs.inputs[i].data);
+    return 0;
+}
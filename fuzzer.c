@@ -0,0 +1,207 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "fuzzer.h"
+#include "assemble.h"
+#include "generateOutput.h"
+#include "optimizer.h"
+#include "hash.h"
+#include "memory.h"
+#include "print.h"
+#include "utils.h"
+
+#define FUZZ_FILE_NAME "fuzz"
+#define INCLUDE_DIRECTIVE ".include"
+
+double costPerByteLimit = 0;
+
+static boolean initialized = FALSE;
+static int instructionsFd = -1; /* the instruction counter of the calling thread, -1 to measure time instead */
+
+/**
+ * Prepares the fuzz target: silences the messages of the assembler and opens the instruction counter.
+ * Called by the first LLVMFuzzerTestOneInput, and may be called again.
+ */
+void initFuzzTarget (void) {
+#ifdef __linux__
+    struct perf_event_attr attributes;
+#endif
+    FILE *devNull;
+
+    if (initialized == TRUE)
+        return;
+    initialized = TRUE;
+
+    /* nearly every mutated input has errors, and printing them would cost more than assembling */
+    devNull = fopen("/dev/null", "w");
+    if (devNull != NULL)
+        setPrintStream(devNull);
+    /* the passes of '--dead-strip', '--optimize' and '--pool' run over every input too */
+    deadStripEnabled = TRUE;
+    optimizeEnabled = TRUE;
+    poolEnabled = TRUE;
+
+#ifdef __linux__
+    /* instructions are counted in user space only, which is both the work of the assembler and stable between runs */
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    instructionsFd = (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+#endif
+    if (costPerByteLimit <= 0)
+        costPerByteLimit = (instructionsFd >= 0) ? FUZZ_INSTRUCTIONS_PER_BYTE_LIMIT : FUZZ_NS_PER_BYTE_LIMIT;
+}
+
+/**
+ * Returns the unit the costs are measured in.
+ * @return "instructions" when the hardware counter could be opened, "ns" otherwise.
+ */
+const char *costUnitName (void) {
+    return (instructionsFd >= 0) ? "instructions" : "ns";
+}
+
+/**
+ * Checks if an input can be assembled by the fuzz target. Inputs with an '.include' are not,
+ * since they could read any file (like '/dev/zero').
+ * @param data The input.
+ * @param size The number of bytes in data.
+ * @return TRUE if the input can be assembled, FALSE otherwise.
+ */
+boolean isFuzzableInput (const unsigned char *data, size_t size) {
+    size_t i, length = strlen(INCLUDE_DIRECTIVE);
+    for (i = 0; i + length <= size; i++) {
+        if (data[i] == '.' && memcmp(data + i, INCLUDE_DIRECTIVE, length) == 0)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * Assembles an input the way the assembler assembles a file, through every pass, with every file kept in memory.
+ * @param data The input.
+ * @param size The number of bytes in data.
+ */
+static void assembleInput (const unsigned char *data, size_t size) {
+    memory_files files;
+    char *source = malloc(size);
+
+    if (source == NULL)
+        return;
+    memcpy(source, data, size);
+    initMemoryFiles(&files);
+    if (addMemoryFile(&files, ".as", source, size) == FALSE) {
+        free(source);
+        return;
+    }
+    useMemoryFiles(&files);
+    assembleFile(FUZZ_FILE_NAME, NULL, "");
+    useMemoryFiles(NULL);
+    clearMemoryFiles(&files);
+}
+
+/**
+ * Reads the cost counter: the instructions of the calling thread, or the monotonic clock.
+ * @return The count so far.
+ */
+static double readCost (void) {
+    struct timespec time;
+#ifdef __linux__
+    __u64 instructions;
+    if (instructionsFd >= 0 && read(instructionsFd, &instructions, sizeof(instructions)) == (long) sizeof(instructions))
+        return (double) instructions;
+#endif
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/**
+ * Assembles an input in memory, all the way to the output files, and measures its cost.
+ * @param data The input, as the contents of a '.as' file.
+ * @param size The number of bytes in data (at least 1).
+ * @return The cheapest cost of FUZZ_COST_RUNS runs.
+ */
+double measureCost (const unsigned char *data, size_t size) {
+    double start, cost, cheapest = -1;
+    int run;
+
+    initFuzzTarget();
+    for (run = 0; run < FUZZ_COST_RUNS; run++) {
+        start = readCost();
+        assembleInput(data, size);
+        cost = readCost() - start;
+        if (cheapest < 0 || cost < cheapest)
+            cheapest = cost;
+    }
+    return cheapest;
+}
+
+/**
+ * Assembles an input in memory, all the way to the output files, and measures the cost per byte.
+ * @param data The input, as the contents of a '.as' file.
+ * @param size The number of bytes in data (at least 1).
+ * @return The cheapest cost of FUZZ_COST_RUNS runs divided by the size.
+ */
+double measureCostPerByte (const unsigned char *data, size_t size) {
+    return measureCost(data, size) / size;
+}
+
+/**
+ * Saves an input into FUZZ_SLOW_DIRECTORY, named by the hash of its contents.
+ * @param data The input.
+ * @param size The number of bytes in data.
+ * @param path Receives the path of the saved file (at least 64 characters).
+ * @return TRUE if the input was saved, FALSE otherwise.
+ */
+boolean saveSlowInput (const unsigned char *data, size_t size, char *path) {
+    char hex[DIGEST_HEX_LENGTH + 1];
+    digest_t digest;
+    boolean saved;
+    FILE *file;
+
+    digestInit(&digest);
+    digestUpdate(&digest, data, size);
+    digestToHex(&digest, hex);
+    sprintf(path, "%s/slow-%.16s.as", FUZZ_SLOW_DIRECTORY, hex);
+
+    mkdir(FUZZ_SLOW_DIRECTORY, 0777);
+    file = fopen(path, "wb");
+    if (file == NULL)
+        return FALSE;
+    saved = (fwrite(data, 1, size, file) == size);
+    if (fclose(file) != 0)
+        saved = FALSE;
+    return saved;
+}
+
+/**
+ * The libFuzzer entry point: scores an input by its cost per byte and saves it if it exceeds costPerByteLimit.
+ * @param data The input.
+ * @param size The number of bytes in data.
+ * @return 0, as libFuzzer expects.
+ */
+int LLVMFuzzerTestOneInput (const unsigned char *data, size_t size) {
+    char path[64];
+    double perByte;
+
+    if (size == 0 || isFuzzableInput(data, size) == FALSE)
+        return 0;
+    perByte = measureCostPerByte(data, size);
+    if (size >= FUZZ_MIN_SCORED_BYTES && perByte > costPerByteLimit && saveSlowInput(data, size, path) == TRUE)
+        fprintf(stderr, "slow input: %.0f %s per byte over %lu bytes, saved to '%s'\n",
+                perByte, costUnitName(), (unsigned long) size, path);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#ifndef FUZZER_H
+#define FUZZER_H
+
+#include <stddef.h>
+
+#include "utils.h"
+
+#define FUZZ_MIN_SCORED_BYTES 512 /* smaller inputs are dominated by the fixed cost of a run, so they are not scored */
+#define FUZZ_INSTRUCTIONS_PER_BYTE_LIMIT 3000.0
+#define FUZZ_NS_PER_BYTE_LIMIT 1000.0
+#define FUZZ_COST_RUNS 3 /* an input costs the cheapest of this many runs, to keep out the noise of the machine */
+#define FUZZ_SLOW_DIRECTORY "fuzz_slow"
+#define FUZZ_SCALES 3 /* the regression corpus is checked on the first sixteenth, the first quarter and all of every input */
+#define FUZZ_SCALE_STEP 4
+#define FUZZ_GROWTH_LIMIT 2.0 /* how much the cost per byte may grow from one scale to the next, four times bigger */
+#define FUZZ_EXPECTED_SLOW_PREFIX "xfail-" /* inputs of the regression corpus known to be slow, until they are fixed */
+#define FUZZ_EXPECTED_GROWTH_LIMIT 5.0 /* how much the known slow inputs may grow per scale: a quadratic cost grows four times */
+
+/* the cost per byte above which an input is saved as slow, in the unit of costUnitName */
+extern double costPerByteLimit;
+
+/**
+ * Prepares the fuzz target: silences the messages of the assembler and opens the instruction counter.
+ * Called by the first LLVMFuzzerTestOneInput, and may be called again.
+ */
+void initFuzzTarget(void);
+
+/**
+ * Returns the unit the costs are measured in.
+ * @return "instructions" when the hardware counter could be opened, "ns" otherwise.
+ */
+const char *costUnitName(void);
+
+/**
+ * Checks if an input can be assembled by the fuzz target. Inputs with an '.include' are not,
+ * since they could read any file (like '/dev/zero').
+ * @param data The input.
+ * @param size The number of bytes in data.
+ * @return TRUE if the input can be assembled, FALSE otherwise.
+ */
+boolean isFuzzableInput(const unsigned char *data, size_t size);
+
+/**
+ * Assembles an input in memory, all the way to the output files, and measures its cost.
+ * @param data The input, as the contents of a '.as' file.
+ * @param size The number of bytes in data (at least 1).
+ * @return The cheapest cost of FUZZ_COST_RUNS runs.
+ */
+double measureCost(const unsigned char *data, size_t size);
+
+/**
+ * Assembles an input in memory, all the way to the output files, and measures the cost per byte.
+ * @param data The input, as the contents of a '.as' file.
+ * @param size The number of bytes in data (at least 1).
+ * @return The cheapest cost of FUZZ_COST_RUNS runs divided by the size.
+ */
+double measureCostPerByte(const unsigned char *data, size_t size);
+
+/**
+ * Saves an input into FUZZ_SLOW_DIRECTORY, named by the hash of its contents.
+ * @param data The input.
+ * @param size The number of bytes in data.
+ * @param path Receives the path of the saved file (at least 64 characters).
+ * @return TRUE if the input was saved, FALSE otherwise.
+ */
+boolean saveSlowInput(const unsigned char *data, size_t size, char *path);
+
+/**
+ * The libFuzzer entry point: scores an input by its cost per byte and saves it if it exceeds costPerByteLimit.
+ * @param data The input.
+ * @param size The number of bytes in data.
+ * @return 0, as libFuzzer expects.
+ */
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size);
+
+#endif /* FUZZER_H */
@@ -1,208 +1,570 @@
-#include <string.h>
-#include <stdlib.h>
-#include <stdio.h>
-
-#include "generateOutput.h"
-#include "parser.h"
-#include "directives.h"
-#include "instructions.h"
-#include "labels.h"
-#include "utils.h"
-#include "print.h"
-
-/* define a base 64 word */
-typedef struct base_64_word {
-    char data [2];
-} base_64_word;
-
-
-/**
- * Converts a machine word to a base64 representation.
- * @param machineWord The machine word to convert.
- * @return The base 64 representation.
-  */
-static base_64_word machineWordToBase64 (machine_word * machineWord) {
-
-    char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    base_64_word result;
-    unsigned short binary;
-    switch (machineWord -> type) {
-        case WORD_TYPE_FIRST:
-            binary =    ((machineWord -> word.first_word.src_am    & 0x007) << 9 ) |
-                        ((machineWord -> word.first_word.op_code        & 0x00F) << 5 ) |
-                        ((machineWord -> word.first_word.dst_am    & 0x007) << 2 ) |
-                        ((machineWord -> word.first_word.ARE            & 0x003) << 0 );
-            break;
-        case WORD_TYPE_IMMDT_DRCT:
-            binary =    ((machineWord -> word.immdt_drct_word.operand   & 0x3FF) << 2 ) |
-                        ((machineWord -> word.immdt_drct_word.ARE       & 0x003) << 0 );
-            break;
-        case WORD_TYPE_DATA:
-            binary =    ((machineWord -> word.data_word.data            & 0xFFF) << 0 );
-            break;
-        case WORD_TYPE_REGISTER:
-            binary =    ((machineWord -> word.register_word.src & 0x01F) << 7 ) |
-                        ((machineWord -> word.register_word.dest & 0x01F) << 2 ) |
-                        ((machineWord -> word.register_word.ARE         & 0x003) << 0 );
-            break;
-    }
-    /* extract each 6-bit group and map it to a base 64 character */
-    result.data[0] = base64Chars[(binary >> 6) & 0x3F];
-    result.data[1] = base64Chars[binary & 0x3F];
-    return result;
-}
-
-/**
- * Opens a file with the given file name, extension, and mode.
- * @param fileName The base name of the file.
- * @param fileExtension The file extension to append to the base name.
- * @param mode The mode in which to open the file (e.g., "r", "w", "a").
- * @return A pointer to the opened file, or NULL on failure.
- */
-FILE *openFile (const char* fileName, const char* fileExtension, const char *mode) {
-    FILE *file;
-    int nameLength = strlen(fileName);
-    int extensionLength = strlen(fileExtension);
-    char *name = malloc(nameLength + extensionLength + 1);
-    if (name == NULL) {
-        printErrorGeneral ("Not enough memory");
-        printf(" - Could not create filename %s with extension %s\n", fileName, fileExtension);
-        return NULL;
-    }
-
-    /* copy file name and extension, including trailing '\0' */
-    strncpy(name, fileName, nameLength);
-    strncpy(name + nameLength, fileExtension, extensionLength + 1); 
-
-    file = fopen(name, mode);
-    free(name);
-    if (file == NULL) {
-        printErrorGeneral("File error");
-        printf(" - cant open '%s%s'\n", fileName, fileExtension);
-        return FALSE;
-    }
-    return file;
-}
-
-/**
- * Updates internal label addresses and writes the external labels into the '.ext' file.
- * @param fileName The base name of the file.
- * @param labels Pointer to the various label tabels.
- * @param codeImage Array that stores the machine words for instructions.
- * @param IC Pointer to the instruction counter.
- * @return TRUE if successful, FALSE otherwise.
- */
-boolean updateAdressesAndWriteExtFile (char* fileName, labels_tables labels, machine_word codeImage[], int IC) {
-    int i;
-    table_entry *tableEntry = labels.internal;
-    FILE* fileExt = NULL;
-    /* at this point, all lables used by code were checked, and therefore all labels are either EXTERNAL or INTERNAL */
-    
-    /* increment all internal lables by BASE_ADDRESS */
-    while (tableEntry != NULL) {
-        tableEntry->label.address += BASE_ADDRESS;
-        tableEntry = tableEntry->next;
-    }
-
-    for (i = 0; i < IC; i++) {
-        if (codeImage[i].isLabel != TRUE){
-                    continue;
-        }
-
-        /* if label is defined as '.extern' then write into '.ext' file the address of the word that calls it */
-        if (findLabel(codeImage[i].labelName, &labels, EXTERNAL) != NULL) {
-            /* open file if this is the first label - this prevents creating the file if there are no external labels used */
-            if (fileExt == NULL) {
-                fileExt = openFile(fileName, ".ext", "w");
-                if (fileExt == NULL) {
-                    printWarningGeneral("Skipping updating addresses and writing .ext file\n");
-                    return FALSE;
-                }
-            }
-            codeImage[i].word.immdt_drct_word.operand = 0;
-            codeImage[i].word.immdt_drct_word.ARE = ARE_EXTERNAL;
-            fprintf(fileExt, "%s\t %d\n", codeImage[i].labelName, i + BASE_ADDRESS); /* write IC where external label is used by code */
-        } else { /* label is internal (must be at this point) */
-            codeImage[i].word.immdt_drct_word.ARE = ARE_RELOCATABLE;
-            tableEntry = findLabel(codeImage[i].labelName, &labels, INTERNAL);
-            if (tableEntry != NULL) {
-                codeImage[i].word.immdt_drct_word.operand = tableEntry->label.address;
-            }
-        }
-    }
-    if (fileExt != NULL)
-    	fclose(fileExt);
-    return TRUE;
-}
-
-/**
- * Writes the machine code and data segments into the '.obj' file.
- * @param fileName The base name of the file.
- * @param codeImage Array that stores the machine words for instructions.
- * @param dataImage Array that stores the machine words for data.
- * @param IC Pointer to the instruction counter.
- * @param DC Pointer to the data counter.
- * @return TRUE if successful, FALSE otherwise.
- */
-boolean writeObjFile (char *fileName, machine_word codeImage[], machine_word dataImage[], int IC, int DC) {
-    int i;
-    FILE * fileObj;
-    base_64_word word;
-
-    fileObj = openFile(fileName, ".obj", "w");
-    if (fileObj == NULL) {
-        printWarningGeneral("Skipping writing .obj file\n");
-        return FALSE;
-    }
-
-    fprintf(fileObj, "%d %d\n", IC, DC);
-
-    /* write IC array into '.obj' file */
-    for (i = 0; i < IC; i++) {
-       word = machineWordToBase64(&codeImage[i]);
-       fprintf(fileObj, "%c%c\n", word.data[0], word.data[1]);
-    }
-    
-    /* write DC array into '.obj' file */
-     for (i = 0; i < DC; i++) {
-        word = machineWordToBase64(&dataImage[i]);
-        fprintf(fileObj, "%c%c\n", word.data[0], word.data[1]);
-    }
-    
-    fclose(fileObj);
-    
-    return TRUE;
-}
-
-/**
- * Writes the labels that were marked as '.entry' into the '.ent' file.
- * @param fileName The base name of the file.
- * @param labels Pointer to the various label tabels.
- * @return TRUE if successful, FALSE otherwise.
- */
-boolean writeEntFile (char *fileName, labels_tables labels) {
-
-    FILE *fileEnt;
-    table_entry *exportal = labels.exportal;
-    table_entry *internal;
-    /* check if there are no '.entry' labels at all */
-    if (exportal == NULL) {
-        return TRUE;
-    }
-
-    fileEnt = openFile(fileName, ".ent", "w");
-    if (fileEnt == NULL) {
-        printWarningGeneral("Skipping writing .ent file\n");
-        return FALSE;
-    }
-
-    /* check that all the labels declared as '.entry' are defined in the file */
-    while (exportal != NULL) {
-        internal = findLabel(exportal->label.name, &labels, INTERNAL);
-        fprintf(fileEnt, "%s\t%d\n", internal->label.name, internal->label.address);
-        exportal = exportal->next;
-    }
-
-    fclose(fileEnt);
-    return TRUE;
-}
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "generateOutput.h"
+#include "parser.h"
+#include "directives.h"
+#include "instructions.h"
+#include "labels.h"
+#include "utils.h"
+#include "print.h"
+#include "memory.h"
+#include "trace.h"
+
+#define OBJ_LINE_LENGTH 3 /* two base 64 characters and a new line */
+#define MAX_EXT_ADDRESS_LENGTH 16 /* the tab, space, address and new line after the label of an '.ext' record */
+
+/* define a base 64 word */
+typedef struct base_64_word {
+    char data [2];
+} base_64_word;
+
+/* The chunks run by one thread: first, first + stride, first + 2 * stride... */
+typedef struct chunk_worker {
+    int chunks;
+    int stride;
+    int first;
+    void (*work)(void *context, int chunk);
+    void *context;
+} chunk_worker;
+
+/* Relocating the code image, with an '.ext' buffer per chunk */
+typedef struct relocation_job {
+    labels_tables *labels;
+    machine_word *codeImage;
+    int IC;
+    char *records; /* the '.ext' records of all the chunks, each chunk at its own offset */
+    size_t *recordOffsets;
+    size_t *recordLengths;
+} relocation_job;
+
+/* A part of an image and its place in the text of the '.obj' file */
+typedef struct encoding_chunk {
+    machine_word *image;
+    int start;
+    int end;
+    size_t offset;
+} encoding_chunk;
+
+/* Encoding the images into the text of the '.obj' file */
+typedef struct encoding_job {
+    encoding_chunk *chunks;
+    int count;
+    char *text;
+} encoding_job;
+
+int outputJobs = 1;
+int baseAddress = BASE_ADDRESS;
+
+/* when set for a thread, openFile reads and writes these files instead of the file system */
+static pthread_key_t memoryFilesKey;
+static pthread_once_t memoryFilesOnce = PTHREAD_ONCE_INIT;
+
+
+/**
+ * Converts a machine word to a base64 representation.
+ * @param machineWord The machine word to convert.
+ * @return The base 64 representation.
+  */
+static base_64_word machineWordToBase64 (machine_word * machineWord) {
+
+    char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    base_64_word result;
+    unsigned short binary;
+    switch (machineWord -> type) {
+        case WORD_TYPE_FIRST:
+            binary =    ((machineWord -> word.first_word.src_am    & 0x007) << 9 ) |
+                        ((machineWord -> word.first_word.op_code        & 0x00F) << 5 ) |
+                        ((machineWord -> word.first_word.dst_am    & 0x007) << 2 ) |
+                        ((machineWord -> word.first_word.ARE            & 0x003) << 0 );
+            break;
+        case WORD_TYPE_IMMDT_DRCT:
+            binary =    ((machineWord -> word.immdt_drct_word.operand   & 0x3FF) << 2 ) |
+                        ((machineWord -> word.immdt_drct_word.ARE       & 0x003) << 0 );
+            break;
+        case WORD_TYPE_DATA:
+            binary =    ((machineWord -> word.data_word.data            & 0xFFF) << 0 );
+            break;
+        case WORD_TYPE_REGISTER:
+            binary =    ((machineWord -> word.register_word.src & 0x01F) << 7 ) |
+                        ((machineWord -> word.register_word.dest & 0x01F) << 2 ) |
+                        ((machineWord -> word.register_word.ARE         & 0x003) << 0 );
+            break;
+        case WORD_TYPE_FILL:
+            binary =    ((machineWord -> word.fill_word.data            & 0xFFF) << 0 );
+            break;
+    }
+    /* extract each 6-bit group and map it to a base 64 character */
+    result.data[0] = base64Chars[(binary >> 6) & 0x3F];
+    result.data[1] = base64Chars[binary & 0x3F];
+    return result;
+}
+
+/**
+ * Runs the chunks of one worker.
+ * @param arg The worker.
+ * @return NULL.
+ */
+static void *runWorker (void *arg) {
+    chunk_worker *worker = arg;
+    int chunk;
+    for (chunk = worker->first; chunk < worker->chunks; chunk += worker->stride)
+        worker->work(worker->context, chunk);
+    return NULL;
+}
+
+/**
+ * Finds an in-memory file by its extension.
+ * @param files The set of in-memory files.
+ * @param fileExtension The extension that names the file.
+ * @return A pointer to the file, or NULL if not found.
+ */
+static memory_file *findMemoryFile (memory_files *files, const char *fileExtension) {
+    int i;
+    for (i = 0; i < files->count; i++) {
+        if (strcmp(files->files[i].extension, fileExtension) == 0)
+            return &files->files[i];
+    }
+    return NULL;
+}
+
+/**
+ * Opens an in-memory file as a stream. Reading needs the file to exist, writing replaces it.
+ * @param files The set of in-memory files.
+ * @param fileExtension The extension that names the file.
+ * @param mode The mode in which to open the file (e.g., "r", "w").
+ * @return A pointer to the opened stream, or NULL on failure.
+ */
+static FILE *openMemoryFile (memory_files *files, const char *fileExtension, const char *mode) {
+    memory_file *file = findMemoryFile(files, fileExtension);
+
+    if (mode[0] == 'r') {
+        if (file == NULL)
+            return NULL;
+        /* fmemopen cannot open an empty buffer, so an empty file reads from its NULL ending */
+        return fmemopen(file->data, file->length > 0 ? file->length : 1, "r");
+    }
+
+    if (file == NULL) {
+        if (files->count == MAX_MEMORY_FILES || strlen(fileExtension) > MAX_EXTENSION_LENGTH)
+            return NULL;
+        file = &files->files[files->count++];
+        strcpy(file->extension, fileExtension);
+    } else {
+        free(file->data);
+    }
+    file->data = NULL;
+    file->length = 0;
+    /* the data and length are updated by the stream when it is closed */
+    return open_memstream(&file->data, &file->length);
+}
+
+/**
+ * Creates the key of the in-memory files of every thread.
+ */
+static void createMemoryFilesKey (void) {
+    pthread_key_create(&memoryFilesKey, NULL);
+}
+
+/**
+ * Initializes an empty set of in-memory files.
+ * @param files The set to initialize.
+ */
+void initMemoryFiles (memory_files *files) {
+    files->count = 0;
+}
+
+/**
+ * Adds an in-memory file, taking ownership of its data.
+ * @param files The set of in-memory files.
+ * @param fileExtension The extension that names the file.
+ * @param data The contents of the file, allocated with malloc.
+ * @param length The number of bytes in data.
+ * @return TRUE if the file was added, FALSE otherwise.
+ */
+boolean addMemoryFile (memory_files *files, const char *fileExtension, char *data, size_t length) {
+    memory_file *file;
+    if (files->count == MAX_MEMORY_FILES || strlen(fileExtension) > MAX_EXTENSION_LENGTH)
+        return FALSE;
+    file = &files->files[files->count++];
+    strcpy(file->extension, fileExtension);
+    file->data = data;
+    file->length = length;
+    return TRUE;
+}
+
+/**
+ * Frees all the in-memory files of a set.
+ * @param files The set of in-memory files.
+ */
+void clearMemoryFiles (memory_files *files) {
+    int i;
+    for (i = 0; i < files->count; i++)
+        free(files->files[i].data);
+    files->count = 0;
+}
+
+/**
+ * Makes openFile use a set of in-memory files instead of the file system, in the calling thread.
+ * @param files The set of in-memory files, or NULL to go back to the file system.
+ */
+void useMemoryFiles (memory_files *files) {
+    pthread_once(&memoryFilesOnce, createMemoryFilesKey);
+    pthread_setspecific(memoryFilesKey, files);
+}
+
+/**
+ * Opens a file with the given file name, extension, and mode.
+ * @param fileName The base name of the file.
+ * @param fileExtension The file extension to append to the base name.
+ * @param mode The mode in which to open the file (e.g., "r", "w", "a").
+ * @return A pointer to the opened file, or NULL on failure.
+ */
+FILE *openFile (const char* fileName, const char* fileExtension, const char *mode) {
+    FILE *file;
+    int nameLength, extensionLength;
+    char *name;
+    memory_files *currentMemoryFiles;
+
+    pthread_once(&memoryFilesOnce, createMemoryFilesKey);
+    currentMemoryFiles = pthread_getspecific(memoryFilesKey);
+    if (currentMemoryFiles != NULL) {
+        file = openMemoryFile(currentMemoryFiles, fileExtension, mode);
+        if (file == NULL) {
+            printErrorGeneral("File error");
+            printMessage(" - cant open '%s%s' in memory\n", fileName, fileExtension);
+        }
+        return file;
+    }
+
+    nameLength = strlen(fileName);
+    extensionLength = strlen(fileExtension);
+    name = allocateMemory(nameLength + extensionLength + 1, MEMORY_FILENAMES);
+    if (name == NULL) {
+        printErrorGeneral ("Not enough memory");
+        printMessage(" - Could not create filename %s with extension %s\n", fileName, fileExtension);
+        return NULL;
+    }
+
+    /* copy file name and extension, including trailing '\0' */
+    strncpy(name, fileName, nameLength);
+    strncpy(name + nameLength, fileExtension, extensionLength + 1); 
+
+    file = fopen(name, mode);
+    freeMemory(name, MEMORY_FILENAMES);
+    if (file == NULL) {
+        printErrorGeneral("File error");
+        printMessage(" - cant open '%s%s'\n", fileName, fileExtension);
+        return FALSE;
+    }
+    return file;
+}
+
+/**
+ * Runs the workers of a chunked job on threads, and waits for them. A worker that could not get a thread
+ * runs on the calling thread, so the job is always done.
+ * @param chunks The number of chunks.
+ * @param work The work of a single chunk.
+ * @param context The job, passed to the work of every chunk.
+ */
+static void runChunks (int chunks, void (*work)(void *context, int chunk), void *context) {
+    pthread_t threads[MAX_OUTPUT_JOBS];
+    boolean started[MAX_OUTPUT_JOBS];
+    chunk_worker workers[MAX_OUTPUT_JOBS];
+    int i, count = (outputJobs < chunks) ? outputJobs : chunks;
+
+    for (i = 0; i < count; i++) {
+        workers[i].chunks = chunks;
+        workers[i].stride = count;
+        workers[i].first = i;
+        workers[i].work = work;
+        workers[i].context = context;
+        /* the calling thread is worker 0 */
+        started[i] = (i > 0 && pthread_create(&threads[i], NULL, runWorker, &workers[i]) == 0);
+    }
+    for (i = 0; i < count; i++) {
+        if (started[i] == FALSE)
+            runWorker(&workers[i]);
+    }
+    for (i = 1; i < count; i++) {
+        if (started[i] == TRUE)
+            pthread_join(threads[i], NULL);
+    }
+}
+
+/**
+ * Relocates the label words of a chunk of the code image, and writes the '.ext' records of the chunk into its own buffer.
+ * @param context The relocation job.
+ * @param chunk The index of the chunk.
+ */
+static void relocateChunk (void *context, int chunk) {
+    relocation_job *job = context;
+    machine_word *word;
+    table_entry *tableEntry;
+    char *records = job->records + job->recordOffsets[chunk];
+    int i, end = (chunk + 1) * OUTPUT_CHUNK_WORDS;
+
+    if (end > job->IC)
+        end = job->IC;
+    TRACE_BEGIN("relocate chunk", NULL);
+    for (i = chunk * OUTPUT_CHUNK_WORDS; i < end; i++) {
+        word = &job->codeImage[i];
+        if (word->isLabel != TRUE)
+            continue;
+
+        /* if label is defined as '.extern' then write into '.ext' file the address of the word that calls it */
+        if (findLabel(word->labelName, job->labels, EXTERNAL) != NULL) {
+            word->word.immdt_drct_word.operand = 0;
+            word->word.immdt_drct_word.ARE = ARE_EXTERNAL;
+            records += sprintf(records, "%s\t %d\n", word->labelName, i + baseAddress); /* write IC where external label is used by code */
+        } else { /* label is internal (must be at this point) */
+            word->word.immdt_drct_word.ARE = ARE_RELOCATABLE;
+            tableEntry = findLabel(word->labelName, job->labels, INTERNAL);
+            if (tableEntry != NULL) {
+                word->word.immdt_drct_word.operand = tableEntry->label.address;
+            }
+        }
+    }
+    job->recordLengths[chunk] = records - (job->records + job->recordOffsets[chunk]);
+    TRACE_END("relocate chunk");
+}
+
+/**
+ * Updates internal label addresses and writes the external labels into the '.ext' file.
+ * The code image is relocated in chunks of OUTPUT_CHUNK_WORDS words, by outputJobs threads, and the '.ext'
+ * records of the chunks are written in the order of the chunks, so the output does not depend on the threads.
+ * @param fileName The base name of the file.
+ * @param labels Pointer to the various label tabels.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param IC Pointer to the instruction counter.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean updateAdressesAndWriteExtFile (char* fileName, labels_tables labels, machine_word codeImage[], int IC) {
+    int i, chunks = (IC + OUTPUT_CHUNK_WORDS - 1) / OUTPUT_CHUNK_WORDS;
+    size_t size = 0;
+    boolean success = TRUE;
+    table_entry *tableEntry = labels.internal;
+    FILE* fileExt = NULL;
+    relocation_job job;
+    /* at this point, all lables used by code were checked, and therefore all labels are either EXTERNAL or INTERNAL */
+    
+    /* increment all internal lables by the base address, and place the data labels after the code */
+    while (tableEntry != NULL) {
+        tableEntry->label.address += baseAddress + (tableEntry->label.isData ? IC : 0);
+        tableEntry = tableEntry->next;
+    }
+    if (chunks == 0)
+        return TRUE;
+
+    /* every label word gets room for an '.ext' record in the buffer of its chunk */
+    job.recordOffsets = allocateMemory(chunks * sizeof(size_t), MEMORY_IMAGES);
+    job.recordLengths = allocateMemory(chunks * sizeof(size_t), MEMORY_IMAGES);
+    for (i = 0; i < IC; i++) {
+        if (i % OUTPUT_CHUNK_WORDS == 0 && job.recordOffsets != NULL)
+            job.recordOffsets[i / OUTPUT_CHUNK_WORDS] = size;
+        if (codeImage[i].isLabel == TRUE)
+            size += strlen(codeImage[i].labelName) + MAX_EXT_ADDRESS_LENGTH;
+    }
+    job.records = allocateMemory(size + 1, MEMORY_IMAGES);
+    if (job.recordOffsets == NULL || job.recordLengths == NULL || job.records == NULL) {
+        printWarningGeneral("Not enough memory, skipping updating addresses and writing .ext file\n");
+        success = FALSE;
+    } else {
+        job.labels = &labels;
+        job.codeImage = codeImage;
+        job.IC = IC;
+        runChunks(chunks, relocateChunk, &job);
+
+        /* open the file only if there are external records - this prevents creating the file if there are no external labels used */
+        for (i = 0; i < chunks && success == TRUE; i++) {
+            if (job.recordLengths[i] == 0)
+                continue;
+            if (fileExt == NULL) {
+                fileExt = openFile(fileName, ".ext", "w");
+                if (fileExt == NULL) {
+                    printWarningGeneral("Skipping updating addresses and writing .ext file\n");
+                    success = FALSE;
+                    break;
+                }
+            }
+            fwrite(job.records + job.recordOffsets[i], 1, job.recordLengths[i], fileExt);
+        }
+    }
+    if (fileExt != NULL)
+    	fclose(fileExt);
+    freeMemory(job.recordOffsets, MEMORY_IMAGES);
+    freeMemory(job.recordLengths, MEMORY_IMAGES);
+    freeMemory(job.records, MEMORY_IMAGES);
+    return success;
+}
+
+/**
+ * Encodes a chunk of the code or data image into its place in the text of the '.obj' file.
+ * @param context The encoding job.
+ * @param chunk The index of the chunk.
+ */
+static void encodeChunk (void *context, int chunk) {
+    encoding_job *job = context;
+    encoding_chunk *current = &job->chunks[chunk];
+    char *text = job->text + current->offset;
+    base_64_word word;
+    int i, count;
+
+    TRACE_BEGIN("encode chunk", NULL);
+    for (i = current->start; i < current->end; i++) {
+        word = machineWordToBase64(&current->image[i]);
+        /* a run of '.space' or '.fill' is expanded only here */
+        count = (current->image[i].type == WORD_TYPE_FILL) ? current->image[i].word.fill_word.count : 1;
+        for (; count > 0; count--) {
+            *text++ = word.data[0];
+            *text++ = word.data[1];
+            *text++ = '\n';
+        }
+        if (current->image[i].type == WORD_TYPE_FILL)
+            i += current->image[i].word.fill_word.count - 1;
+    }
+    TRACE_END("encode chunk");
+}
+
+/**
+ * Splits an image into chunks of about OUTPUT_CHUNK_WORDS words, never in the middle of a run of data words.
+ * @param job The encoding job, whose chunks are added to.
+ * @param image The code or data image.
+ * @param count The number of words in the image.
+ * @param offset Pointer to the offset of the image in the text, moved past it.
+ */
+static void addEncodingChunks (encoding_job *job, machine_word image[], int count, size_t *offset) {
+    encoding_chunk *current = NULL;
+    int i;
+    for (i = 0; i < count; i += (image[i].type == WORD_TYPE_FILL) ? (int) image[i].word.fill_word.count : 1) {
+        if (current == NULL || i - current->start >= OUTPUT_CHUNK_WORDS) {
+            if (current != NULL)
+                current->end = i;
+            current = &job->chunks[job->count++];
+            current->image = image;
+            current->start = i;
+            current->offset = *offset + i * OBJ_LINE_LENGTH;
+        }
+    }
+    if (current != NULL)
+        current->end = count;
+    *offset += count * OBJ_LINE_LENGTH;
+}
+
+/**
+ * Writes the machine code and data segments into the '.obj' file.
+ * The images are encoded in chunks of about OUTPUT_CHUNK_WORDS words, by outputJobs threads, each into its
+ * place in one text, so the output does not depend on the threads.
+ * @param fileName The base name of the file.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param dataImage Array that stores the machine words for data.
+ * @param IC Pointer to the instruction counter.
+ * @param DC Pointer to the data counter.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeObjFile (char *fileName, machine_word codeImage[], machine_word dataImage[], int IC, int DC) {
+    FILE * fileObj;
+    encoding_job job;
+    size_t length = 0;
+    boolean success;
+
+    job.count = 0;
+    job.chunks = allocateMemory((IC / OUTPUT_CHUNK_WORDS + DC / OUTPUT_CHUNK_WORDS + 2) * sizeof(encoding_chunk), MEMORY_IMAGES);
+    job.text = allocateMemory((size_t) (IC + DC) * OBJ_LINE_LENGTH + 1, MEMORY_IMAGES);
+    if (job.chunks == NULL || job.text == NULL) {
+        printWarningGeneral("Not enough memory, skipping writing .obj file\n");
+        freeMemory(job.chunks, MEMORY_IMAGES);
+        freeMemory(job.text, MEMORY_IMAGES);
+        return FALSE;
+    }
+    addEncodingChunks(&job, codeImage, IC, &length);
+    addEncodingChunks(&job, dataImage, DC, &length);
+
+    fileObj = openFile(fileName, ".obj", "w");
+    if (fileObj == NULL) {
+        printWarningGeneral("Skipping writing .obj file\n");
+        freeMemory(job.chunks, MEMORY_IMAGES);
+        freeMemory(job.text, MEMORY_IMAGES);
+        return FALSE;
+    }
+
+    fprintf(fileObj, "%d %d\n", IC, DC);
+    runChunks(job.count, encodeChunk, &job);
+    success = (fwrite(job.text, 1, length, fileObj) == length);
+    fclose(fileObj);
+    
+    freeMemory(job.chunks, MEMORY_IMAGES);
+    freeMemory(job.text, MEMORY_IMAGES);
+    return success;
+}
+
+/**
+ * Writes the labels that were marked as '.entry' into the '.ent' file.
+ * @param fileName The base name of the file.
+ * @param labels Pointer to the various label tabels.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeEntFile (char *fileName, labels_tables labels) {
+
+    FILE *fileEnt;
+    table_entry *exportal = labels.exportal;
+    table_entry *internal;
+    /* check if there are no '.entry' labels at all */
+    if (exportal == NULL) {
+        return TRUE;
+    }
+
+    fileEnt = openFile(fileName, ".ent", "w");
+    if (fileEnt == NULL) {
+        printWarningGeneral("Skipping writing .ent file\n");
+        return FALSE;
+    }
+
+    /* check that all the labels declared as '.entry' are defined in the file */
+    while (exportal != NULL) {
+        internal = findLabel(exportal->label.name, &labels, INTERNAL);
+        fprintf(fileEnt, "%s\t%d\n", internal->label.name, internal->label.address);
+        exportal = exportal->next;
+    }
+
+    fclose(fileEnt);
+    return TRUE;
+}
+
+/**
+ * Writes the relocation table into the '.rel' file: a line with the base the code was relocated for, and a line
+ * with the offset (from the start of the code) of every relocatable word. The file is only created when the code
+ * has relocatable words or the base is not BASE_ADDRESS, so that the linker and the simulator can find the base.
+ * @param fileName The base name of the file.
+ * @param codeImage Array that stores the machine words for instructions, after relocation.
+ * @param IC The instruction counter.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeRelFile (char *fileName, machine_word codeImage[], int IC) {
+    FILE *fileRel;
+    int i;
+
+    for (i = 0; i < IC; i++) {
+        if (codeImage[i].isLabel == TRUE && codeImage[i].word.immdt_drct_word.ARE == ARE_RELOCATABLE)
+            break;
+    }
+    if (i == IC && baseAddress == BASE_ADDRESS)
+        return TRUE;
+
+    fileRel = openFile(fileName, ".rel", "w");
+    if (fileRel == NULL) {
+        printWarningGeneral("Skipping writing .rel file\n");
+        return FALSE;
+    }
+    fprintf(fileRel, "%d\n", baseAddress);
+    for (; i < IC; i++) {
+        if (codeImage[i].isLabel == TRUE && codeImage[i].word.immdt_drct_word.ARE == ARE_RELOCATABLE)
+            fprintf(fileRel, "%d\n", i);
+    }
+    fclose(fileRel);
+    return TRUE;
+}
@@ -1,45 +1,113 @@
-#ifndef GENERATE_OUTPUT_H
-#define GENERATE_OUTPUT_H
-
-#include "utils.h"
-#include "stdio.h"
-
-/**
- * Opens a file with the given file name, extension, and mode.
- * @param fileName The base name of the file.
- * @param fileExtension The file extension to append to the base name.
- * @param mode The mode in which to open the file (e.g., "r", "w", "a").
- * @return A pointer to the opened file, or NULL on failure.
- */
-FILE *openFile(const char* fileName, const char* fileExtension, const char *mode);
-
-/**
- * Updates internal label addresses and writes the external labels into the '.ext' file.
- * @param fileName The base name of the file.
- * @param labels Pointer to the various label tabels.
- * @param codeImage Array that stores the machine words for instructions.
- * @param IC Pointer to the instruction counter.
- * @return TRUE if successful, FALSE otherwise.
- */
-boolean updateAdressesAndWriteExtFile(char *fileName, labels_tables labels, machine_word codeImage[], int IC);
-
-/**
- * Writes the machine code and data segments into the '.obj' file.
- * @param fileName The base name of the file.
- * @param codeImage Array that stores the machine words for instructions.
- * @param dataImage Array that stores the machine words for data.
- * @param IC Pointer to the instruction counter.
- * @param DC Pointer to the data counter.
- * @return TRUE if successful, FALSE otherwise.
- */
-boolean writeObjFile(char *fileName, machine_word codeImage[], machine_word dataImage[], int IC, int DC);
-
-/**
- * Writes the labels that were marked as '.entry' into the '.ent' file.
- * @param fileName The base name of the file.
- * @param labels Pointer to the various label tabels.
- * @return TRUE if successful, FALSE otherwise.
- */
-boolean writeEntFile(char *fileName, labels_tables labels);
-
-#endif /*GENERATE_OUTPUT_H*/
+#ifndef GENERATE_OUTPUT_H
+#define GENERATE_OUTPUT_H
+
+#include "utils.h"
+#include "stdio.h"
+
+#define MAX_MEMORY_FILES 8
+#define MAX_EXTENSION_LENGTH 7
+#define OUTPUT_CHUNK_WORDS 256
+#define MAX_OUTPUT_JOBS 64
+
+/* A file kept in memory instead of the file system, named only by its extension */
+typedef struct memory_file {
+    char extension[MAX_EXTENSION_LENGTH+1]; /* adding one extra space for NULL ending */
+    char *data;
+    size_t length;
+} memory_file;
+
+/* The in-memory files of a single source file, in the order they were created */
+typedef struct memory_files {
+    memory_file files[MAX_MEMORY_FILES];
+    int count;
+} memory_files;
+
+/**
+ * Initializes an empty set of in-memory files.
+ * @param files The set to initialize.
+ */
+void initMemoryFiles(memory_files *files);
+
+/**
+ * Adds an in-memory file, taking ownership of its data.
+ * @param files The set of in-memory files.
+ * @param fileExtension The extension that names the file.
+ * @param data The contents of the file, allocated with malloc.
+ * @param length The number of bytes in data.
+ * @return TRUE if the file was added, FALSE otherwise.
+ */
+boolean addMemoryFile(memory_files *files, const char *fileExtension, char *data, size_t length);
+
+/**
+ * Frees all the in-memory files of a set.
+ * @param files The set of in-memory files.
+ */
+void clearMemoryFiles(memory_files *files);
+
+/**
+ * Makes openFile use a set of in-memory files instead of the file system, in the calling thread.
+ * @param files The set of in-memory files, or NULL to go back to the file system.
+ */
+void useMemoryFiles(memory_files *files);
+
+/**
+ * Opens a file with the given file name, extension, and mode.
+ * While useMemoryFiles is active the file is opened in memory, and only its extension is used.
+ * @param fileName The base name of the file.
+ * @param fileExtension The file extension to append to the base name.
+ * @param mode The mode in which to open the file (e.g., "r", "w", "a").
+ * @return A pointer to the opened file, or NULL on failure.
+ */
+FILE *openFile(const char* fileName, const char* fileExtension, const char *mode);
+
+/* The number of threads that relocate and encode the images, set by --jobs (1 by default) */
+extern int outputJobs;
+
+/* The address the code is loaded at, set by --base (BASE_ADDRESS by default) */
+extern int baseAddress;
+
+/**
+ * Updates internal label addresses and writes the external labels into the '.ext' file.
+ * The code image is relocated in chunks of OUTPUT_CHUNK_WORDS words, by outputJobs threads, and the '.ext'
+ * records of the chunks are written in the order of the chunks, so the output does not depend on the threads.
+ * @param fileName The base name of the file.
+ * @param labels Pointer to the various label tabels.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param IC Pointer to the instruction counter.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean updateAdressesAndWriteExtFile(char *fileName, labels_tables labels, machine_word codeImage[], int IC);
+
+/**
+ * Writes the machine code and data segments into the '.obj' file.
+ * The images are encoded in chunks of about OUTPUT_CHUNK_WORDS words, by outputJobs threads, each into its
+ * place in one text, so the output does not depend on the threads.
+ * @param fileName The base name of the file.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param dataImage Array that stores the machine words for data.
+ * @param IC Pointer to the instruction counter.
+ * @param DC Pointer to the data counter.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeObjFile(char *fileName, machine_word codeImage[], machine_word dataImage[], int IC, int DC);
+
+/**
+ * Writes the labels that were marked as '.entry' into the '.ent' file.
+ * @param fileName The base name of the file.
+ * @param labels Pointer to the various label tabels.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeEntFile(char *fileName, labels_tables labels);
+
+/**
+ * Writes the relocation table into the '.rel' file: a line with the base the code was relocated for, and a line
+ * with the offset (from the start of the code) of every relocatable word. The file is only created when the code
+ * has relocatable words or the base is not BASE_ADDRESS, so that the linker and the simulator can find the base.
+ * @param fileName The base name of the file.
+ * @param codeImage Array that stores the machine words for instructions, after relocation.
+ * @param IC The instruction counter.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeRelFile(char *fileName, machine_word codeImage[], int IC);
+
+#endif /*GENERATE_OUTPUT_H*/
@@ -0,0 +1,362 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+
+#define DEFAULT_WORD_BUDGET (MAX_MEMORY_SPACE - 24)
+#define MAX_MACRO_BODY 3
+#define MAX_PATH_LENGTH 1024
+
+/* Parameters of the generated programs */
+typedef struct generator_options {
+    int lines; /* lines in every file */
+    int labels; /* labels defined in every file */
+    int macros; /* macros defined in every file */
+    int callPercent; /* chance of a body line being a macro call */
+    int externPercent; /* percentage of label references that go to '.extern' labels, also used for '.entry' */
+    int dataPercent; /* chance of a body line being '.data' or '.string' */
+    int files; /* number of files to generate */
+    int wordBudget; /* machine words a file may use, to stay within MAX_MEMORY_SPACE */
+    char *prefix; /* files are named <prefix><index>.as */
+} generator_options;
+
+/* A macro: its body lines and the number of words they take */
+typedef struct generated_macro {
+    char body[MAX_MACRO_BODY][MAX_LINE_LENGTH+1];
+    int lines;
+    int words;
+} generated_macro;
+
+/* State of the file being generated */
+typedef struct generator_state {
+    int codeLabels; /* labels C0..C(n-1) are defined on instructions */
+    int dataLabels; /* labels D0..D(n-1) are defined on data */
+    int externs; /* labels X0..X(n-1) are '.extern' */
+    int definedCode;
+    int definedData;
+    int words;
+    int fillerExterns; /* unused '.extern' labels U0..U(n-1) written once the words ran out */
+    int fillerMacros; /* unused macros u0..u(n-1) defined once the words ran out */
+} generator_state;
+
+static unsigned long randomState = 1;
+
+/* two operand instructions, in the order of their opcodes */
+static char *twoOperands[] = {"mov", "cmp", "add", "sub", "lea"};
+/* one operand instructions */
+static char *oneOperand[] = {"not", "clr", "inc", "dec", "jmp", "bne", "red", "prn", "jsr"};
+
+/**
+ * Returns the next pseudo random number (xorshift), the same on every platform.
+ * @param limit One above the largest number returned.
+ * @return A number between 0 and limit - 1.
+ */
+static int nextRandom (int limit) {
+    randomState ^= (randomState << 13) & 0xFFFFFFFFUL;
+    randomState ^= randomState >> 17;
+    randomState ^= (randomState << 5) & 0xFFFFFFFFUL;
+    return (limit <= 0) ? 0 : (int) (randomState % limit);
+}
+
+/**
+ * Writes the name of a random label that may be used as an operand.
+ * @param state The state of the current file.
+ * @param options The generator options.
+ * @param name Receives the label name.
+ */
+static void randomLabel (generator_state *state, generator_options *options, char *name) {
+    if (state->externs > 0 && nextRandom(100) < options->externPercent)
+        sprintf(name, "X%d", nextRandom(state->externs));
+    else if (state->dataLabels > 0 && (state->codeLabels == 0 || nextRandom(2) == 0))
+        sprintf(name, "D%d", nextRandom(state->dataLabels));
+    else if (state->codeLabels > 0)
+        sprintf(name, "C%d", nextRandom(state->codeLabels));
+    else
+        strcpy(name, "@r0");
+}
+
+/**
+ * Writes a random operand of one of the allowed kinds.
+ * @param state The state of the current file.
+ * @param options The generator options.
+ * @param allowNumber TRUE if an immediate number is allowed.
+ * @param allowRegister TRUE if a register is allowed.
+ * @param operand Receives the operand.
+ */
+static void randomOperand (generator_state *state, generator_options *options, boolean allowNumber, boolean allowRegister, char *operand) {
+    int kind = nextRandom(3);
+    if (kind == 0 && allowNumber == TRUE)
+        sprintf(operand, "%d", nextRandom(2048) - 1024);
+    else if (kind == 1 && allowRegister == TRUE)
+        sprintf(operand, "@r%d", nextRandom(8));
+    else
+        randomLabel(state, options, operand);
+}
+
+/**
+ * Writes a random instruction (without a label) and returns the number of words it takes.
+ * @param state The state of the current file.
+ * @param options The generator options.
+ * @param line Receives the instruction.
+ * @return The number of machine words of the instruction.
+ */
+static int randomInstruction (generator_state *state, generator_options *options, char *line) {
+    char src[MAX_LABEL_LENGTH+1], dst[MAX_LABEL_LENGTH+1];
+    int opcode, kind = nextRandom(10);
+
+    if (kind < 5) {
+        opcode = nextRandom(5);
+        if (strcmp(twoOperands[opcode], "lea") == 0) {
+            randomLabel(state, options, src);
+            if (src[0] == '@') /* 'lea' needs a label as its source, without labels it becomes 'mov' */
+                opcode = 0;
+        } else {
+            randomOperand(state, options, TRUE, TRUE, src);
+        }
+        randomOperand(state, options, strcmp(twoOperands[opcode], "cmp") == 0, TRUE, dst);
+        sprintf(line, "%s %s, %s", twoOperands[opcode], src, dst);
+        return (src[0] == '@' && dst[0] == '@') ? 2 : 3;
+    }
+    if (kind < 9) {
+        opcode = nextRandom(9);
+        randomOperand(state, options, strcmp(oneOperand[opcode], "prn") == 0, TRUE, dst);
+        sprintf(line, "%s %s", oneOperand[opcode], dst);
+        return 2;
+    }
+    strcpy(line, nextRandom(2) ? "rts" : "stop");
+    return 1;
+}
+
+/**
+ * Writes a random '.data' or '.string' directive (without a label) and returns the number of words it takes.
+ * @param line Receives the directive.
+ * @return The number of machine words of the directive.
+ */
+static int randomData (char *line) {
+    int i, count = 1 + nextRandom(6);
+    char *c;
+
+    if (nextRandom(2) == 0) {
+        c = line + sprintf(line, ".data %d", nextRandom(4096) - 2048);
+        for (i = 1; i < count; i++)
+            c += sprintf(c, ", %d", nextRandom(4096) - 2048);
+        return count;
+    }
+    c = line + sprintf(line, ".string \"");
+    for (i = 0; i < count * 2; i++)
+        *c++ = 'a' + nextRandom(26);
+    strcpy(c, "\"");
+    return count * 2 + 1;
+}
+
+/**
+ * Writes filler once the words of a file ran out: lines the assembler processes in full, but that take no words.
+ * These are unused macro definitions, or unused '.extern' labels when there is no room for a whole definition.
+ * @param file The file to write to.
+ * @param state The state of the current file.
+ * @param options The generator options.
+ * @param room The number of lines the filler may take (at least 1).
+ * @return The number of lines written.
+ */
+static int writeFiller (FILE *file, generator_state *state, generator_options *options, int room) {
+    char line[MAX_LINE_LENGTH+1];
+
+    if (room >= 3 && nextRandom(2) == 0) {
+        randomInstruction(state, options, line);
+        fprintf(file, "mcro u%d\n\t%s\nendmcro\n", state->fillerMacros++, line);
+        return 3;
+    }
+    fprintf(file, ".extern U%d\n", state->fillerExterns++);
+    return 1;
+}
+
+/**
+ * Generates a single source file.
+ * @param file The file to write to.
+ * @param options The generator options.
+ * @param filler Receives the number of lines written as filler after the words ran out.
+ * @return The number of lines written.
+ */
+static int generateFile (FILE *file, generator_options *options, int *filler) {
+    generator_state state;
+    generated_macro *macros;
+    char line[MAX_LINE_LENGTH+1];
+    int i, j, macroCount, written = 0, bodyLines, reserved, words;
+
+    /* split the labels between code and data, and pick the '.extern' labels */
+    state.dataLabels = options->labels * options->dataPercent / 100;
+    state.codeLabels = options->labels - state.dataLabels;
+    state.externs = (options->labels * options->externPercent + 99) / 100;
+    state.definedCode = 0;
+    state.definedData = 0;
+    state.words = 0;
+    state.fillerExterns = 0;
+    state.fillerMacros = 0;
+    *filler = 0;
+
+    for (i = 0; i < state.externs; i++, written++)
+        fprintf(file, ".extern X%d\n", i);
+
+    /* macros are defined up front, each has one to MAX_MACRO_BODY instructions */
+    macroCount = options->macros;
+    macros = calloc(macroCount > 0 ? macroCount : 1, sizeof(generated_macro));
+    if (macros == NULL)
+        return written;
+    for (i = 0; i < macroCount; i++) {
+        macros[i].lines = 1 + nextRandom(MAX_MACRO_BODY);
+        fprintf(file, "mcro m%d\n", i);
+        for (j = 0; j < macros[i].lines; j++) {
+            macros[i].words += randomInstruction(&state, options, macros[i].body[j]);
+            fprintf(file, "\t%s\n", macros[i].body[j]);
+        }
+        fprintf(file, "endmcro\n");
+        written += macros[i].lines + 2;
+    }
+
+    fprintf(file, "; generated program\n");
+    written++;
+    bodyLines = options->lines - written - (options->labels * options->externPercent + 99) / 100 - 1;
+    for (i = 0; i < bodyLines; i++, written++) {
+        /* every label that was not defined yet needs at least one word at the end */
+        reserved = (state.codeLabels - state.definedCode) + (state.dataLabels - state.definedData) + 1;
+        if (macroCount > 0 && nextRandom(100) < options->callPercent) {
+            j = nextRandom(macroCount);
+            if (state.words + macros[j].words + reserved <= options->wordBudget) {
+                fprintf(file, "m%d\n", j);
+                state.words += macros[j].words;
+                continue;
+            }
+        } else if (nextRandom(100) < options->dataPercent) {
+            words = randomData(line);
+            if (state.words + words + reserved <= options->wordBudget) {
+                if (state.definedData < state.dataLabels && nextRandom(bodyLines - i) < state.dataLabels - state.definedData)
+                    fprintf(file, "D%d: ", state.definedData++);
+                fprintf(file, "%s\n", line);
+                state.words += words;
+                continue;
+            }
+        } else {
+            words = randomInstruction(&state, options, line);
+            if (state.words + words + reserved <= options->wordBudget) {
+                if (state.definedCode < state.codeLabels && nextRandom(bodyLines - i) < state.codeLabels - state.definedCode)
+                    fprintf(file, "C%d: ", state.definedCode++);
+                fprintf(file, "\t%s\n", line);
+                state.words += words;
+                continue;
+            }
+        }
+        /* out of words, keep the line count with lines that are still assembled */
+        words = writeFiller(file, &state, options, bodyLines - i);
+        *filler += words;
+        written += words - 1;
+        i += words - 1;
+    }
+
+    /* define whatever labels are left, and end the program */
+    for (; state.definedCode < state.codeLabels; written++)
+        fprintf(file, "C%d: rts\n", state.definedCode++);
+    for (; state.definedData < state.dataLabels; written++)
+        fprintf(file, "D%d: .data 0\n", state.definedData++);
+    fprintf(file, "\tstop\n");
+    written++;
+    /* as many '.entry' labels as '.extern' ones, each label exported once */
+    for (i = 0; i < state.externs && i < state.codeLabels + state.dataLabels; i++, written++) {
+        if (i < state.codeLabels)
+            fprintf(file, ".entry C%d\n", i);
+        else
+            fprintf(file, ".entry D%d\n", i - state.codeLabels);
+    }
+
+    free(macros);
+    return written;
+}
+
+/**
+ * Parses a numeric command line argument.
+ * @param value The argument.
+ * @param result Receives the number.
+ * @return TRUE if the argument is a non negative number, FALSE otherwise.
+ */
+static boolean parseNumber (char *value, int *result) {
+    char *end;
+    long number = strtol(value, &end, 10);
+    if (end == value || *end != '\0' || number < 0)
+        return FALSE;
+    *result = (int) number;
+    return TRUE;
+}
+
+/**
+ * Prints how to use the generator.
+ */
+static void printUsage (void) {
+    fprintf(stderr, "usage: generator [-n lines] [-l labels] [-m macros] [-c call%%] [-e extern%%] [-d data%%]\n"
+                    "                 [-f files] [-w words] [-s seed] [-o prefix]\n");
+}
+
+int main (int argc, char *argv[]) {
+    generator_options options;
+    char path[MAX_PATH_LENGTH];
+    int i, seed = 1, lines = 0, filler = 0, fileFiller, *target;
+    FILE *file;
+
+    options.lines = 200;
+    options.labels = 20;
+    options.macros = 4;
+    options.callPercent = 10;
+    options.externPercent = 10;
+    options.dataPercent = 20;
+    options.files = 1;
+    options.wordBudget = DEFAULT_WORD_BUDGET;
+    options.prefix = "gen";
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            options.prefix = argv[++i];
+            continue;
+        }
+        if (argv[i][0] != '-' || strlen(argv[i]) != 2 || i + 1 == argc) {
+            printUsage();
+            return 1;
+        }
+        switch (argv[i][1]) {
+            case 'n': target = &options.lines; break;
+            case 'l': target = &options.labels; break;
+            case 'm': target = &options.macros; break;
+            case 'c': target = &options.callPercent; break;
+            case 'e': target = &options.externPercent; break;
+            case 'd': target = &options.dataPercent; break;
+            case 'f': target = &options.files; break;
+            case 'w': target = &options.wordBudget; break;
+            case 's': target = &seed; break;
+            default: printUsage(); return 1;
+        }
+        if (parseNumber(argv[++i], target) == FALSE) {
+            printUsage();
+            return 1;
+        }
+    }
+    /* every label needs a word of its own, and '.extern' labels are counted in percents */
+    if (options.labels > options.wordBudget / 2)
+        options.labels = options.wordBudget / 2;
+    if (options.externPercent > 100)
+        options.externPercent = 100;
+    if (options.dataPercent > 100)
+        options.dataPercent = 100;
+    randomState = (seed == 0) ? 1 : seed;
+
+    for (i = 0; i < options.files; i++) {
+        sprintf(path, "%.1000s%d.as", options.prefix, i);
+        file = fopen(path, "w");
+        if (file == NULL) {
+            fprintf(stderr, "generator: cannot write '%s'\n", path);
+            return 1;
+        }
+        lines += generateFile(file, &options, &fileFiller);
+        filler += fileFiller;
+        fclose(file);
+    }
+    printf("%d files, %d lines, %d filler lines\n", options.files, lines, filler);
+    return 0;
+}
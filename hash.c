@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "hash.h"
+
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
+#define MASK_32_BITS 0xFFFFFFFFUL
+
+/* every lane starts from a different seed and sees the bytes through a different mask */
+static const unsigned long laneSeeds[DIGEST_LANES] = {
+    2166136261UL, 3735928559UL, 2654435769UL, 1779033703UL
+};
+
+/**
+ * Mixes the bits of a 32-bit value so that every input bit affects every output bit.
+ * @param h The value to mix.
+ * @return The mixed value.
+ */
+static unsigned long mix32 (unsigned long h) {
+    h ^= h >> 16;
+    h = (h * 0x85EBCA6BUL) & MASK_32_BITS;
+    h ^= h >> 13;
+    h = (h * 0xC2B2AE35UL) & MASK_32_BITS;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * Hashes a buffer of bytes into a 32-bit value (FNV-1a).
+ * @param data The bytes to hash.
+ * @param length The number of bytes to hash.
+ * @return The 32-bit hash value.
+ */
+unsigned long hashBytes (const void *data, size_t length) {
+    const unsigned char *bytes = data;
+    unsigned long h = FNV_OFFSET_BASIS;
+    size_t i;
+
+    for (i = 0; i < length; i++) {
+        h ^= bytes[i];
+        h = (h * FNV_PRIME) & MASK_32_BITS;
+    }
+    return h;
+}
+
+/**
+ * Hashes a NULL terminated string into a 32-bit value (FNV-1a).
+ * @param str The string to hash.
+ * @return The 32-bit hash value.
+ */
+unsigned long hashString (const char *str) {
+    return hashBytes(str, strlen(str));
+}
+
+/**
+ * Initializes a digest before feeding it any bytes.
+ * @param digest The digest to initialize.
+ */
+void digestInit (digest_t *digest) {
+    int i;
+    for (i = 0; i < DIGEST_LANES; i++)
+        digest->lanes[i] = laneSeeds[i];
+}
+
+/**
+ * Feeds more bytes into a digest.
+ * @param digest The digest to update.
+ * @param data The bytes to add.
+ * @param length The number of bytes to add.
+ */
+void digestUpdate (digest_t *digest, const void *data, size_t length) {
+    const unsigned char *bytes = data;
+    size_t i;
+    int lane;
+
+    for (i = 0; i < length; i++) {
+        for (lane = 0; lane < DIGEST_LANES; lane++) {
+            digest->lanes[lane] ^= bytes[i] ^ (lane * 0x5B);
+            digest->lanes[lane] = (digest->lanes[lane] * FNV_PRIME) & MASK_32_BITS;
+        }
+    }
+}
+
+/**
+ * Writes the final value of a digest as a hex string.
+ * @param digest The digest to print.
+ * @param hex The output buffer, at least DIGEST_HEX_LENGTH + 1 characters long.
+ */
+void digestToHex (digest_t *digest, char *hex) {
+    int lane;
+    for (lane = 0; lane < DIGEST_LANES; lane++)
+        sprintf(hex + lane * 8, "%08lx", mix32(digest->lanes[lane] ^ digest->lanes[(lane + 1) % DIGEST_LANES]));
+    hex[DIGEST_HEX_LENGTH] = '\0';
+}
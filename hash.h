@@ -0,0 +1,50 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+
+#define DIGEST_LANES 4
+#define DIGEST_HEX_LENGTH (DIGEST_LANES * 8)
+
+/* A 128-bit content digest, kept as four independent 32-bit lanes */
+typedef struct digest_t {
+    unsigned long lanes[DIGEST_LANES];
+} digest_t;
+
+/**
+ * Hashes a buffer of bytes into a 32-bit value (FNV-1a).
+ * @param data The bytes to hash.
+ * @param length The number of bytes to hash.
+ * @return The 32-bit hash value.
+ */
+unsigned long hashBytes(const void *data, size_t length);
+
+/**
+ * Hashes a NULL terminated string into a 32-bit value (FNV-1a).
+ * @param str The string to hash.
+ * @return The 32-bit hash value.
+ */
+unsigned long hashString(const char *str);
+
+/**
+ * Initializes a digest before feeding it any bytes.
+ * @param digest The digest to initialize.
+ */
+void digestInit(digest_t *digest);
+
+/**
+ * Feeds more bytes into a digest.
+ * @param digest The digest to update.
+ * @param data The bytes to add.
+ * @param length The number of bytes to add.
+ */
+void digestUpdate(digest_t *digest, const void *data, size_t length);
+
+/**
+ * Writes the final value of a digest as a hex string.
+ * @param digest The digest to print.
+ * @param hex The output buffer, at least DIGEST_HEX_LENGTH + 1 characters long.
+ */
+void digestToHex(digest_t *digest, char *hex);
+
+#endif /* HASH_H */
@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "incremental.h"
+#include "parser.h"
+#include "labels.h"
+#include "hash.h"
+#include "memory.h"
+#include "utils.h"
+#include "print.h"
+
+/* The start of a sidecar */
+typedef struct sidecar_header {
+    char magic[8];
+    char version[8];
+    int wordSize; /* sizeof(machine_word) of the build that wrote it */
+    int count; /* the number of lines */
+} sidecar_header;
+
+/* A line in a sidecar, followed by its text and then its words */
+typedef struct sidecar_line {
+    int textLength;
+    int codeCount;
+    int dataCount;
+    int dataWords;
+    int hasLabel;
+    int labelType;
+    int isData;
+    char labelName[MAX_LABEL_LENGTH+1]; /* adding one extra space for NULL ending */
+} sidecar_line;
+
+boolean incrementalEnabled = FALSE;
+
+/**
+ * Opens the sidecar of a file.
+ * @param fileName The base name of the file.
+ * @param mode The mode to open it in.
+ * @return The sidecar, or NULL if it could not be opened.
+ */
+static FILE *openSidecar (const char *fileName, const char *mode) {
+    char *path = allocateMemory(strlen(fileName) + strlen(SIDECAR_EXTENSION) + 1, MEMORY_FILENAMES);
+    FILE *file;
+    if (path == NULL)
+        return NULL;
+    sprintf(path, "%s%s", fileName, SIDECAR_EXTENSION);
+    file = fopen(path, mode);
+    freeMemory(path, MEMORY_FILENAMES);
+    return file;
+}
+
+/**
+ * Finds the stored result of a line.
+ * @param cache The parsed lines.
+ * @param line The line.
+ * @param hash The hash of the line.
+ * @return The stored result, or NULL if the line was not parsed before.
+ */
+static line_record *findLine (line_cache *cache, const char *line, unsigned long hash) {
+    line_record *record = cache->buckets[hash % LINE_CACHE_BUCKETS];
+    while (record != NULL && (record->hash != hash || strcmp(record->text, line) != 0))
+        record = record->next;
+    return record;
+}
+
+/**
+ * Adds a line to the cache.
+ * @param cache The parsed lines.
+ * @param record The line, with its text and hash set.
+ */
+static void addLine (line_cache *cache, line_record *record) {
+    unsigned long bucket = record->hash % LINE_CACHE_BUCKETS;
+    record->next = cache->buckets[bucket];
+    cache->buckets[bucket] = record;
+}
+
+/**
+ * Frees a single stored line.
+ * @param record The line.
+ */
+static void freeLine (line_record *record) {
+    freeMemory(record->text, MEMORY_SIDECARS);
+    freeMemory(record->words, MEMORY_SIDECARS);
+    freeMemory(record, MEMORY_SIDECARS);
+}
+
+/**
+ * Counts the data words that the stored data words of a line take in the data image.
+ * @param words The stored data words.
+ * @param count The number of stored data words.
+ * @return The number of words in the data image.
+ */
+static int expandedDataCount (machine_word words[], int count) {
+    int i, total = 0;
+    for (i = 0; i < count; i++)
+        total += (words[i].type == WORD_TYPE_FILL) ? (int) words[i].word.fill_word.count : 1;
+    return total;
+}
+
+/**
+ * Copies a word of an image into a stored line, leaving out the bytes the word does not use.
+ * @param stored Receives the word.
+ * @param word The word of the image.
+ */
+static void storeWord (machine_word *stored, machine_word *word) {
+    memset(stored, 0, sizeof(machine_word));
+    stored->isLabel = word->isLabel;
+    if (word->isLabel == TRUE)
+        strcpy(stored->labelName, word->labelName);
+    stored->type = word->type;
+    /* the instructions build their words on the stack, so only the fields of the word's type are copied */
+    switch (word->type) {
+        case WORD_TYPE_FIRST:
+            stored->word.first_word.src_am = word->word.first_word.src_am;
+            stored->word.first_word.op_code = word->word.first_word.op_code;
+            stored->word.first_word.dst_am = word->word.first_word.dst_am;
+            stored->word.first_word.ARE = word->word.first_word.ARE;
+            break;
+        case WORD_TYPE_IMMDT_DRCT:
+            stored->word.immdt_drct_word.ARE = word->word.immdt_drct_word.ARE;
+            stored->word.immdt_drct_word.operand = word->word.immdt_drct_word.operand;
+            break;
+        case WORD_TYPE_REGISTER:
+            stored->word.register_word.ARE = word->word.register_word.ARE;
+            stored->word.register_word.dest = word->word.register_word.dest;
+            stored->word.register_word.src = word->word.register_word.src;
+            break;
+        case WORD_TYPE_FILL:
+            stored->word.fill_word.data = word->word.fill_word.data;
+            stored->word.fill_word.count = word->word.fill_word.count;
+            break;
+        default:
+            stored->word.data_word.data = word->word.data_word.data;
+    }
+}
+
+/**
+ * Creates a stored line with room for its words.
+ * @param text The line.
+ * @param length The length of the line.
+ * @param words The number of code and data words.
+ * @return The line, or NULL if out of memory.
+ */
+static line_record *newLine (const char *text, size_t length, int words) {
+    line_record *record = allocateZeroedMemory(1, sizeof(line_record), MEMORY_SIDECARS);
+    if (record == NULL)
+        return NULL;
+    record->text = allocateMemory(length + 1, MEMORY_SIDECARS);
+    record->words = allocateZeroedMemory(words > 0 ? words : 1, sizeof(machine_word), MEMORY_SIDECARS);
+    if (record->text == NULL || record->words == NULL) {
+        freeLine(record);
+        return NULL;
+    }
+    memcpy(record->text, text, length);
+    record->text[length] = '\0';
+    record->hash = hashString(record->text);
+    return record;
+}
+
+/**
+ * Loads the sidecar of a file with the lines parsed by the previous run.
+ * A missing, old or damaged sidecar gives an empty cache.
+ * @param cache The cache to load into.
+ * @param fileName The base name of the file.
+ */
+void loadLineCache (line_cache *cache, const char *fileName) {
+    sidecar_header header;
+    sidecar_line stored;
+    line_record *record;
+    FILE *file;
+    int i, words;
+
+    memset(cache, 0, sizeof(line_cache));
+    file = openSidecar(fileName, "rb");
+    if (file == NULL)
+        return;
+
+    /* the words are stored as they are in memory, so a sidecar is only used by the same build */
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, SIDECAR_MAGIC, sizeof(header.magic)) != 0 ||
+        strncmp(header.version, ASSEMBLER_VERSION, sizeof(header.version)) != 0 || header.wordSize != (int) sizeof(machine_word)) {
+        fclose(file);
+        return;
+    }
+    for (i = 0; i < header.count; i++) {
+        if (fread(&stored, sizeof(stored), 1, file) != 1 || stored.textLength < 0 || stored.textLength > MAX_LINE_LENGTH ||
+            stored.codeCount < 0 || stored.dataCount < 0 || stored.codeCount + stored.dataCount > MAX_MEMORY_SPACE ||
+            stored.dataWords < 0 || stored.dataWords > stored.dataCount)
+            break;
+        words = stored.codeCount + stored.dataWords;
+        record = newLine("", stored.textLength, words);
+        if (record == NULL)
+            break;
+        if (fread(record->text, 1, stored.textLength, file) != (size_t) stored.textLength ||
+            fread(record->words, sizeof(machine_word), words, file) != (size_t) words ||
+            expandedDataCount(record->words + stored.codeCount, stored.dataWords) != stored.dataCount) {
+            freeLine(record);
+            break;
+        }
+        record->text[stored.textLength] = '\0';
+        record->hash = hashString(record->text);
+        record->codeCount = stored.codeCount;
+        record->dataCount = stored.dataCount;
+        record->dataWords = stored.dataWords;
+        record->hasLabel = stored.hasLabel ? TRUE : FALSE;
+        record->labelType = (labelType) stored.labelType;
+        record->isData = stored.isData ? TRUE : FALSE;
+        stored.labelName[MAX_LABEL_LENGTH] = '\0';
+        strcpy(record->labelName, stored.labelName);
+        addLine(cache, record);
+    }
+    fclose(file);
+}
+
+/**
+ * Finds the label that parsing a line added, by comparing the heads of the label tables.
+ * @param before The label tables before the line was parsed.
+ * @param after The label tables after the line was parsed.
+ * @param record Receives the label, if one was added.
+ */
+static void findAddedLabel (labels_tables *before, labels_tables *after, line_record *record) {
+    table_entry *added = NULL;
+    record->hasLabel = TRUE;
+    if (after->internal != before->internal) {
+        added = after->internal;
+        record->labelType = INTERNAL;
+    } else if (after->external != before->external) {
+        added = after->external;
+        record->labelType = EXTERNAL;
+    } else if (after->exportal != before->exportal) {
+        added = after->exportal;
+        record->labelType = EXPORTAL;
+    } else if (after->pooled != before->pooled) {
+        added = after->pooled;
+        record->labelType = POOLED;
+    } else if (after->kept != before->kept) {
+        added = after->kept;
+        record->labelType = KEPT;
+    }
+    if (added == NULL) {
+        record->hasLabel = FALSE;
+        return;
+    }
+    strcpy(record->labelName, added->label.name);
+    record->isData = added->label.isData;
+}
+
+/**
+ * Parses a line of the '.am' file, or replays its stored result if the same line was parsed before.
+ * Replaying adds the same label (at the current IC or DC) and the same words as parsing would, so the lines
+ * after a changed line simply move. The result of a line parsed without errors is stored for the next run.
+ * @param cache The parsed lines.
+ * @param line The line.
+ * @param codeImage Array to store the machine words for instructions.
+ * @param dataImage Array to store the machine words for data commands.
+ * @param labels Pointer to the various label tabels.
+ * @param IC Pointer to the instruction counter.
+ * @param DC Pointer to the data counter.
+ * @param lineNumber The number of the line.
+ * @return TRUE if the line is valid, FALSE otherwise.
+ */
+boolean parseLineIncremental (line_cache *cache, char *line, machine_word codeImage[], machine_word dataImage[], labels_tables *labels, int *IC, int *DC, int lineNumber) {
+    unsigned long hash = hashString(line);
+    line_record *record = findLine(cache, line, hash);
+    labels_tables before;
+    machine_word *word;
+    int i, startIC = *IC, startDC = *DC;
+
+    /* a line that would not fit is parsed, so that it reports the error */
+    if (record != NULL && *IC + *DC + record->codeCount + record->dataCount < MAX_MEMORY_SPACE) {
+        if (record->hasLabel == TRUE &&
+            addLabel(record->labelName, labels, record->labelType, record->isData, IC, DC, lineNumber) == FALSE)
+            return FALSE;
+        memcpy(&codeImage[*IC], record->words, record->codeCount * sizeof(machine_word));
+        *IC += record->codeCount;
+        /* a run takes all of its words of the image, but only its first one is written, as when it is parsed */
+        for (i = 0; i < record->dataWords; i++) {
+            word = &record->words[record->codeCount + i];
+            dataImage[*DC] = *word;
+            if (word->type == WORD_TYPE_FILL) {
+                memset(&dataImage[*DC + 1], 0, (word->word.fill_word.count - 1) * sizeof(machine_word));
+                *DC += word->word.fill_word.count;
+            } else
+                (*DC)++;
+        }
+        record->used = TRUE;
+        cache->reused++;
+        return TRUE;
+    }
+
+    before = *labels;
+    cache->parsed++;
+    if (parseLine(line, codeImage, dataImage, labels, IC, DC, lineNumber) == FALSE)
+        return FALSE;
+    if (record != NULL) /* parsed only because it did not fit, nothing new to store */
+        return TRUE;
+    record = newLine(line, strlen(line), (*IC - startIC) + (*DC - startDC));
+    if (record == NULL) /* the line is just not stored */
+        return TRUE;
+    record->codeCount = *IC - startIC;
+    record->dataCount = *DC - startDC;
+    for (i = 0; i < record->codeCount; i++)
+        storeWord(&record->words[i], &codeImage[startIC + i]);
+    /* the rest of the words of a run are never written, so only its first one is stored */
+    for (i = startDC; i < *DC; i += (dataImage[i].type == WORD_TYPE_FILL) ? (int) dataImage[i].word.fill_word.count : 1)
+        storeWord(&record->words[record->codeCount + record->dataWords++], &dataImage[i]);
+    findAddedLabel(&before, labels, record);
+    record->used = TRUE;
+    addLine(cache, record);
+    return TRUE;
+}
+
+/**
+ * Writes the lines of this run into the sidecar of a file, for the next run.
+ * @param cache The parsed lines.
+ * @param fileName The base name of the file.
+ * @return TRUE if the sidecar was written, FALSE otherwise.
+ */
+boolean saveLineCache (line_cache *cache, const char *fileName) {
+    sidecar_header header;
+    sidecar_line stored;
+    line_record *record;
+    FILE *file;
+    int i;
+    boolean success = TRUE;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SIDECAR_MAGIC, sizeof(header.magic));
+    strncpy(header.version, ASSEMBLER_VERSION, sizeof(header.version));
+    header.wordSize = sizeof(machine_word);
+    for (i = 0; i < LINE_CACHE_BUCKETS; i++)
+        for (record = cache->buckets[i]; record != NULL; record = record->next)
+            header.count += record->used;
+
+    file = openSidecar(fileName, "wb");
+    if (file == NULL)
+        return FALSE;
+    success = (fwrite(&header, sizeof(header), 1, file) == 1);
+    /* lines that are no longer in the file are dropped */
+    for (i = 0; i < LINE_CACHE_BUCKETS && success == TRUE; i++) {
+        for (record = cache->buckets[i]; record != NULL && success == TRUE; record = record->next) {
+            if (record->used == FALSE)
+                continue;
+            memset(&stored, 0, sizeof(stored));
+            stored.textLength = strlen(record->text);
+            stored.codeCount = record->codeCount;
+            stored.dataCount = record->dataCount;
+            stored.dataWords = record->dataWords;
+            stored.hasLabel = record->hasLabel;
+            stored.labelType = record->labelType;
+            stored.isData = record->isData;
+            strcpy(stored.labelName, record->labelName);
+            success = (fwrite(&stored, sizeof(stored), 1, file) == 1 &&
+                       fwrite(record->text, 1, stored.textLength, file) == (size_t) stored.textLength &&
+                       fwrite(record->words, sizeof(machine_word), record->codeCount + record->dataWords, file) ==
+                       (size_t) (record->codeCount + record->dataWords));
+        }
+    }
+    return (fclose(file) == 0 && success == TRUE);
+}
+
+/**
+ * Frees all the lines of a cache.
+ * @param cache The cache.
+ */
+void freeLineCache (line_cache *cache) {
+    line_record *record, *next;
+    int i;
+    for (i = 0; i < LINE_CACHE_BUCKETS; i++) {
+        for (record = cache->buckets[i]; record != NULL; record = next) {
+            next = record->next;
+            freeLine(record);
+        }
+        cache->buckets[i] = NULL;
+    }
+}
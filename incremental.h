@@ -0,0 +1,74 @@
+#ifndef INCREMENTAL_H
+#define INCREMENTAL_H
+
+#include "utils.h"
+
+#define SIDECAR_EXTENSION ".lines"
+#define SIDECAR_MAGIC "asmlines"
+#define LINE_CACHE_BUCKETS 4096
+
+/* What parsing a single line without errors did: the words it added and the label it declared */
+typedef struct line_record {
+    char *text; /* the line of the '.am' file */
+    unsigned long hash;
+    int codeCount;
+    int dataCount;
+    int dataWords; /* the data words stored, fewer than dataCount when a run of '.space' or '.fill' is stored once */
+    machine_word *words; /* the code words followed by the stored data words */
+    boolean hasLabel;
+    labelType labelType;
+    boolean isData;
+    char labelName[MAX_LABEL_LENGTH+1]; /* adding one extra space for NULL ending */
+    boolean used; /* the line is in the file this time, so it is saved again */
+    struct line_record *next;
+} line_record;
+
+/* The parsed lines of a file, by their text */
+typedef struct line_cache {
+    line_record *buckets[LINE_CACHE_BUCKETS];
+    int reused; /* lines replayed instead of parsed in this run */
+    int parsed; /* lines parsed in this run */
+} line_cache;
+
+/* TRUE when --incremental was given */
+extern boolean incrementalEnabled;
+
+/**
+ * Loads the sidecar of a file with the lines parsed by the previous run.
+ * A missing, old or damaged sidecar gives an empty cache.
+ * @param cache The cache to load into.
+ * @param fileName The base name of the file.
+ */
+void loadLineCache(line_cache *cache, const char *fileName);
+
+/**
+ * Parses a line of the '.am' file, or replays its stored result if the same line was parsed before.
+ * Replaying adds the same label (at the current IC or DC) and the same words as parsing would, so the lines
+ * after a changed line simply move. The result of a line parsed without errors is stored for the next run.
+ * @param cache The parsed lines.
+ * @param line The line.
+ * @param codeImage Array to store the machine words for instructions.
+ * @param dataImage Array to store the machine words for data commands.
+ * @param labels Pointer to the various label tabels.
+ * @param IC Pointer to the instruction counter.
+ * @param DC Pointer to the data counter.
+ * @param lineNumber The number of the line.
+ * @return TRUE if the line is valid, FALSE otherwise.
+ */
+boolean parseLineIncremental(line_cache *cache, char *line, machine_word codeImage[], machine_word dataImage[], labels_tables *labels, int *IC, int *DC, int lineNumber);
+
+/**
+ * Writes the lines of this run into the sidecar of a file, for the next run.
+ * @param cache The parsed lines.
+ * @param fileName The base name of the file.
+ * @return TRUE if the sidecar was written, FALSE otherwise.
+ */
+boolean saveLineCache(line_cache *cache, const char *fileName);
+
+/**
+ * Frees all the lines of a cache.
+ * @param cache The cache.
+ */
+void freeLineCache(line_cache *cache);
+
+#endif /* INCREMENTAL_H */
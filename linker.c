@@ -0,0 +1,320 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "hash.h"
+#include "objfile.h"
+
+#define MAX_PATH_LENGTH 1024
+#define INITIAL_SYMBOL_SLOTS 1024
+
+/* An input module: its '.obj' contents and where its segments go in the linked image */
+typedef struct module_t {
+    char *name; /* base name of the '.obj', '.ent' and '.ext' files */
+    object_file object;
+    int base; /* the address the module was assembled at, from its '.rel' file */
+    int codeStart; /* offset of the module's code in the linked code segment */
+    int dataStart; /* offset of the module's data in the linked data segment */
+} module_t;
+
+/* A global symbol exported with '.entry' */
+typedef struct symbol_t {
+    char name[MAX_LABEL_LENGTH+1]; /* adding one extra space for NULL ending, empty for a free slot */
+    int address; /* address in the linked image */
+    int module;
+} symbol_t;
+
+/* Open addressing hash table of the global symbols */
+typedef struct symbol_table {
+    symbol_t *slots;
+    int capacity; /* always a power of two */
+    int count;
+} symbol_table;
+
+/**
+ * Opens an input file of a module.
+ * @param name The base name of the module.
+ * @param extension The extension of the file.
+ * @return The opened file, or NULL if it does not exist.
+ */
+static FILE *openModuleFile (char *name, char *extension) {
+    char path[MAX_PATH_LENGTH + 8];
+    sprintf(path, "%.1000s%s", name, extension);
+    return fopen(path, "r");
+}
+
+/**
+ * Finds the slot of a symbol, or the free slot where it belongs.
+ * @param table The symbol table.
+ * @param name The name of the symbol.
+ * @return The slot.
+ */
+static symbol_t *findSlot (symbol_table *table, char *name) {
+    unsigned long i = hashString(name) & (table->capacity - 1);
+    while (table->slots[i].name[0] != '\0' && strcmp(table->slots[i].name, name) != 0)
+        i = (i + 1) & (table->capacity - 1);
+    return &table->slots[i];
+}
+
+/**
+ * Doubles the number of slots of the symbol table, keeping it at most half full.
+ * @param table The symbol table.
+ * @return TRUE if successful, FALSE if out of memory.
+ */
+static boolean growTable (symbol_table *table) {
+    symbol_t *old = table->slots;
+    int i, oldCapacity = table->capacity;
+
+    table->capacity = (oldCapacity == 0) ? INITIAL_SYMBOL_SLOTS : oldCapacity * 2;
+    table->slots = calloc(table->capacity, sizeof(symbol_t));
+    if (table->slots == NULL) {
+        table->slots = old;
+        table->capacity = oldCapacity;
+        return FALSE;
+    }
+    for (i = 0; i < oldCapacity; i++)
+        if (old[i].name[0] != '\0')
+            *findSlot(table, old[i].name) = old[i];
+    free(old);
+    return TRUE;
+}
+
+/**
+ * Translates an address of a module to its address in the linked image, which starts at BASE_ADDRESS.
+ * @param module The module.
+ * @param address The address in the module, as written by the assembler for the module's base.
+ * @param totalIC The size of the linked code segment.
+ * @return The linked address, or -1 if the address is outside the module.
+ */
+static int relocate (module_t *module, int address, int totalIC) {
+    int offset = address - module->base;
+    if (offset < 0 || offset >= module->object.IC + module->object.DC)
+        return -1;
+    if (offset < module->object.IC)
+        return BASE_ADDRESS + module->codeStart + offset;
+    return BASE_ADDRESS + totalIC + module->dataStart + (offset - module->object.IC);
+}
+
+/**
+ * Adds the '.entry' symbols of a module to the global symbol table.
+ * @param table The symbol table.
+ * @param modules All the modules.
+ * @param index The index of the module.
+ * @param totalIC The size of the linked code segment.
+ * @return The number of errors found.
+ */
+static int addModuleSymbols (symbol_table *table, module_t *modules, int index, int totalIC) {
+    char name[MAX_LABEL_LENGTH+1];
+    int address, errors = 0;
+    symbol_t *slot;
+    FILE *file = openModuleFile(modules[index].name, ".ent");
+
+    if (file == NULL) /* a module without '.entry' labels */
+        return 0;
+    while (readSymbolLine(file, name, &address) == TRUE) {
+        if (table->count * 2 >= table->capacity && growTable(table) == FALSE) {
+            fprintf(stderr, "linker: out of memory\n");
+            errors++;
+            break;
+        }
+        slot = findSlot(table, name);
+        if (slot->name[0] != '\0') {
+            fprintf(stderr, "linker: duplicate symbol '%s' in '%s', first defined in '%s'\n",
+                    name, modules[index].name, modules[slot->module].name);
+            errors++;
+            continue;
+        }
+        slot->address = relocate(&modules[index], address, totalIC);
+        if (slot->address < 0) {
+            fprintf(stderr, "linker: symbol '%s' in '%s.ent' is outside the module\n", name, modules[index].name);
+            errors++;
+            continue;
+        }
+        strcpy(slot->name, name);
+        slot->module = index;
+        table->count++;
+    }
+    fclose(file);
+    return errors;
+}
+
+/**
+ * Relocates the internal label words of a module and resolves its external label words.
+ * @param table The symbol table.
+ * @param module The module.
+ * @param totalIC The size of the linked code segment.
+ * @return The number of errors found.
+ */
+static int linkModule (symbol_table *table, module_t *module, int totalIC) {
+    char name[MAX_LABEL_LENGTH+1];
+    int i, address, errors = 0;
+    unsigned short *words = module->object.words;
+    boolean *listed;
+    symbol_t *slot;
+    FILE *file;
+
+    /* only label words are relocatable, every other code word is absolute */
+    for (i = 0; i < module->object.IC; i++) {
+        if (WORD_ARE(words[i]) != ARE_RELOCATABLE)
+            continue;
+        address = relocate(module, WORD_OPERAND(words[i]), totalIC);
+        if (address < 0) {
+            fprintf(stderr, "linker: word %d of '%s' refers outside the module\n", i + module->base, module->name);
+            errors++;
+            continue;
+        }
+        words[i] = MAKE_OPERAND_WORD(address, ARE_RELOCATABLE);
+    }
+
+    listed = calloc(module->object.IC + 1, sizeof(boolean));
+    if (listed == NULL) {
+        fprintf(stderr, "linker: out of memory\n");
+        return errors + 1;
+    }
+    /* a module that uses no external labels has no '.ext' file */
+    file = openModuleFile(module->name, ".ext");
+    while (file != NULL && readSymbolLine(file, name, &address) == TRUE) {
+        i = address - module->base;
+        if (i < 0 || i >= module->object.IC || WORD_ARE(words[i]) != ARE_EXTERNAL) {
+            fprintf(stderr, "linker: '%s.ext' refers to word %d, which is not an external label\n", module->name, address);
+            errors++;
+            continue;
+        }
+        listed[i] = TRUE;
+        slot = findSlot(table, name);
+        if (slot->name[0] == '\0') {
+            fprintf(stderr, "linker: unresolved symbol '%s' used in '%s' at %d\n", name, module->name, address);
+            errors++;
+            continue;
+        }
+        words[i] = MAKE_OPERAND_WORD(slot->address, ARE_RELOCATABLE);
+    }
+    if (file != NULL)
+        fclose(file);
+
+    /* an external word must be listed in the '.ext' file, or it would be left unresolved without a word */
+    for (i = 0; i < module->object.IC; i++) {
+        if (WORD_ARE(words[i]) == ARE_EXTERNAL && listed[i] == FALSE) {
+            fprintf(stderr, "linker: word %d of '%s' uses an external label that '%s.ext' does not list\n",
+                    i + module->base, module->name, module->name);
+            errors++;
+        }
+    }
+    free(listed);
+    return errors;
+}
+
+/**
+ * Writes the linked image: the code of all the modules, followed by the data of all the modules.
+ * @param path The base name of the output.
+ * @param modules All the modules.
+ * @param count The number of modules.
+ * @param totalIC The size of the linked code segment.
+ * @param totalDC The size of the linked data segment.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean writeLinkedImage (char *path, module_t *modules, int count, int totalIC, int totalDC) {
+    char fileName[MAX_PATH_LENGTH + 8];
+    object_file linked;
+    boolean success;
+    FILE *file;
+    int i;
+
+    linked.IC = totalIC;
+    linked.DC = totalDC;
+    linked.words = malloc((totalIC + totalDC + 1) * sizeof(unsigned short));
+    if (linked.words == NULL)
+        return FALSE;
+    for (i = 0; i < count; i++) {
+        memcpy(linked.words + modules[i].codeStart, modules[i].object.words,
+               modules[i].object.IC * sizeof(unsigned short));
+        memcpy(linked.words + totalIC + modules[i].dataStart, modules[i].object.words + modules[i].object.IC,
+               modules[i].object.DC * sizeof(unsigned short));
+    }
+
+    sprintf(fileName, "%.1000s.obj", path);
+    file = fopen(fileName, "w");
+    if (file == NULL) {
+        freeObjectFile(&linked);
+        return FALSE;
+    }
+    success = writeObjectFile(file, &linked);
+    success &= (fclose(file) == 0);
+    freeObjectFile(&linked);
+    return success;
+}
+
+int main (int argc, char *argv[]) {
+    module_t *modules;
+    symbol_table table;
+    int i, count, totalIC = 0, totalDC = 0, errors = 0;
+    FILE *file;
+
+    if (argc < 4 || strcmp(argv[1], "-o") != 0) {
+        fprintf(stderr, "usage: linker -o <output> <module> [<module> ...]\n");
+        fprintf(stderr, "  reads <module>.obj, <module>.ent, <module>.ext and <module>.rel, and writes <output>.obj\n");
+        return 1;
+    }
+    count = argc - 3;
+    modules = calloc(count, sizeof(module_t));
+    table.slots = NULL;
+    table.capacity = 0;
+    table.count = 0;
+    if (modules == NULL || growTable(&table) == FALSE) {
+        fprintf(stderr, "linker: out of memory\n");
+        return 1;
+    }
+
+    /* lay out the segments: code of all the modules first, then their data, in command line order */
+    for (i = 0; i < count; i++) {
+        modules[i].name = argv[i + 3];
+        file = openModuleFile(modules[i].name, ".obj");
+        if (file == NULL || readObjectFile(file, &modules[i].object) == FALSE) {
+            fprintf(stderr, "linker: cannot read '%s.obj'\n", modules[i].name);
+            errors++;
+        }
+        if (file != NULL)
+            fclose(file);
+        /* a module without a '.rel' file was assembled at the default base */
+        file = openModuleFile(modules[i].name, ".rel");
+        if (readModuleBase(file, &modules[i].base) == FALSE) {
+            fprintf(stderr, "linker: '%s.rel' does not start with a base address\n", modules[i].name);
+            errors++;
+        }
+        if (file != NULL)
+            fclose(file);
+        modules[i].codeStart = totalIC;
+        modules[i].dataStart = totalDC;
+        totalIC += modules[i].object.IC;
+        totalDC += modules[i].object.DC;
+    }
+    if (errors == 0 && totalIC + totalDC > MAX_MEMORY_SPACE) {
+        fprintf(stderr, "linker: the linked image needs %d words, more than the %d available\n",
+                totalIC + totalDC, MAX_MEMORY_SPACE);
+        errors++;
+    }
+
+    /* report every duplicate and every unresolved symbol, not just the first one */
+    if (errors == 0) {
+        for (i = 0; i < count; i++)
+            errors += addModuleSymbols(&table, modules, i, totalIC);
+        for (i = 0; i < count; i++)
+            errors += linkModule(&table, &modules[i], totalIC);
+    }
+    if (errors == 0 && writeLinkedImage(argv[2], modules, count, totalIC, totalDC) == FALSE) {
+        fprintf(stderr, "linker: cannot write '%s.obj'\n", argv[2]);
+        errors++;
+    }
+
+    if (errors == 0)
+        printf("Linked %d modules into '%s.obj': %d code words, %d data words, %d symbols\n",
+               count, argv[2], totalIC, totalDC, table.count);
+    else
+        fprintf(stderr, "linker: %d errors, no output written\n", errors);
+    for (i = 0; i < count; i++)
+        freeObjectFile(&modules[i].object);
+    free(modules);
+    free(table.slots);
+    return (errors == 0) ? 0 : 1;
+}
@@ -1,115 +1,859 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-#include "preprocessor.h"
-#include "parser.h"
-#include "directives.h"
-#include "instructions.h"
-#include "labels.h"
-#include "utils.h"
-#include "generateOutput.h"
-#include "print.h"
-
-int main(int argc, char * argv[]) {
-    int i, IC, DC, lineNumber;
-    boolean ERROR_FOUND;
-    char *fileName;
-    FILE *fileAs, *fileAm;
-    long int file_offset;
-    machine_word codeImage[MAX_MEMORY_SPACE], dataImage[MAX_MEMORY_SPACE];
-    char line[MAX_LINE_LENGTH+1]; /* adding one extra space for NULL ending */
-
-    labels_tables labels;
-    labels.internal = NULL;
-    labels.external = NULL;
-    labels.exportal = NULL;
-
-    if (argc <= 1) {
-        printErrorGeneral("No files in command line\n");
-        return 1;
-    }
-
-    for (i = 1; i < argc; i++) {
-        fileName = argv[i];
-        lineNumber = 1;
-        IC = 0;
-        DC = 0;
-        ERROR_FOUND = FALSE;
-        
-        fileAs = openFile(fileName, ".as", "r");
-        if (fileAs == NULL) {
-            printWarningGeneral("Skipping file ");
-            printf("'%s.as'.\n", fileName);
-            continue;
-        }
-        
-        fileAm = openFile(fileName, ".am", "w+");
-        if (fileAm == NULL) {
-            printWarningGeneral("Skipping file ");
-            printf("'%s.as'.\n", fileName);
-            fclose(fileAs);
-            continue;
-        }
-        
-        /*preproccess files*/
-        fseek(fileAs, 0, SEEK_END);
-        file_offset = ftell(fileAs); 
-        rewind(fileAs);
-
-        printf("Preprocessing file: '%s'\n", fileName);
-        if (preprocessFile(fileAs, fileAm, 0, file_offset) == TRUE) { /*preprocessor error occured */ 
-            printWarningGeneral("Skipping file ");
-            printf("'%s.as'.\n", fileName);
-            fclose(fileAs);
-            fclose(fileAm);
-            continue;
-        }
-                
-		printf("Finished preprocessing file: '%s'\n", fileName);
-       /*done with .as file. Rewinding .am file to assemble it: */
-        fclose(fileAs);
-        rewind(fileAm);
-		
-        printf("Processing file: '%s'\n", fileName);
-        /*process the file line by line*/
-        while (fgets(line, sizeof(line), fileAm) != NULL) {
-            ERROR_FOUND |= (parseLine(line, codeImage, dataImage, &labels, &IC, &DC, lineNumber) == FALSE);
-            lineNumber++;
-        }
-        /*close file*/
-        fclose(fileAm);
-
-        if (checkValidLabelsTables(labels) == FALSE) {
-            ERROR_FOUND = TRUE;
-        } else if (checkAllLabelsDefined(labels, codeImage, IC) == FALSE) {
-            ERROR_FOUND = TRUE;
-        }
-        if (ERROR_FOUND == TRUE) {
-            printErrorGeneral("Skipping file ");
-            printf("%s because it has at least one error in it! \n", fileName);
-            freeTables(labels);
-            labels.internal = NULL;
-            labels.external = NULL;
-            labels.exportal = NULL;
-            continue;
-        }
-        
-        /*if no errors were found then creates the files */
-        if (updateAdressesAndWriteExtFile(fileName, labels, codeImage, IC) == FALSE) {
-            printErrorGeneral("Updating addresses and writing .ext file failed\n");
-        } else if (writeObjFile(fileName, codeImage, dataImage, IC, DC) == FALSE) {
-            printErrorGeneral("Writing .obj file failed\n");
-        } else if (writeEntFile(fileName, labels) == FALSE) {
-            printErrorGeneral("Writing .ent file failed\n");
-        }
-       
-        freeTables(labels);
-        labels.internal = NULL;
-        labels.external = NULL;
-        labels.exportal = NULL;
-        printf("Finished processing file: '%s'\n", fileName);
-
-    }
-    return 0;
-}
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "preprocessor.h"
+#include "parser.h"
+#include "directives.h"
+#include "instructions.h"
+#include "labels.h"
+#include "utils.h"
+#include "generateOutput.h"
+#include "print.h"
+#include "options.h"
+#include "cache.h"
+#include "frame.h"
+#include "stats.h"
+#include "memory.h"
+#include "trace.h"
+#include "perfcounters.h"
+#include "optimizer.h"
+#include "watch.h"
+#include "incremental.h"
+#include "batchio.h"
+#include "pipeline.h"
+#include "manifest.h"
+#include "assemble.h"
+
+#define STDIN_FILE_NAME "-"
+
+/**
+ * Assembles the source read from stdin and writes all of its outputs to stdout as one framed stream.
+ * The stream holds a 'version' frame, a frame per output (tagged by its extension), an optional
+ * 'diagnostics' frame and a final 'status' frame that is either "ok" or "error".
+ * @param options The parsed options.
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @return TRUE if all the output files were written, FALSE otherwise.
+ */
+static boolean assembleStdin (options_t *options, cache_t *cache, char *optionsKey) {
+    memory_files files;
+    memory_file *file;
+    char *source, *diagnostics = NULL;
+    long length;
+    size_t diagnosticsLength = 0;
+    FILE *diagnosticsStream = NULL;
+    boolean success, incremental;
+    int i;
+
+    source = readFileContents(stdin, &length);
+    if (source == NULL) {
+        printErrorGeneral("Could not read the source from stdin\n");
+        return FALSE;
+    }
+    initMemoryFiles(&files);
+    addMemoryFile(&files, ".as", source, length);
+
+    if (options->frameDiagnostics == TRUE) {
+        diagnosticsStream = open_memstream(&diagnostics, &diagnosticsLength);
+        if (diagnosticsStream != NULL)
+            setPrintStream(diagnosticsStream);
+    }
+    /* the sidecar of an incremental run would have to be a file, and stdin has no name to put it by */
+    incremental = incrementalEnabled;
+    incrementalEnabled = FALSE;
+    useMemoryFiles(&files);
+    success = assembleFile("stdin", cache, optionsKey);
+    useMemoryFiles(NULL);
+    incrementalEnabled = incremental;
+    setPrintStream(stderr);
+
+    writeFrame(stdout, "version", ASSEMBLER_VERSION, strlen(ASSEMBLER_VERSION));
+    for (i = 0; i < files.count; i++) {
+        file = &files.files[i];
+        if (strcmp(file->extension, ".as") != 0)
+            writeFrame(stdout, file->extension, file->data, file->length);
+    }
+    if (diagnosticsStream != NULL) {
+        fclose(diagnosticsStream);
+        writeFrame(stdout, "diagnostics", diagnostics, diagnosticsLength);
+        free(diagnostics);
+    }
+    writeFrame(stdout, "status", success ? "ok" : "error", success ? 2 : 5);
+    fflush(stdout);
+    clearMemoryFiles(&files);
+    return success;
+}
+
+/**
+ * Checks a source file for '--check' without writing anything: the source is read into memory,
+ * and the '.am' file is preprocessed into memory and parsed from there.
+ * @param fileName The base name of the file (without the '.as' extension).
+ * @param optionsKey String describing the options that change the output.
+ * @return TRUE if the file has no errors, FALSE otherwise.
+ */
+static boolean checkFile (char *fileName, char *optionsKey) {
+    memory_files files;
+    FILE *fileAs;
+    char *source;
+    long length;
+    boolean success;
+
+    fileAs = openFile(fileName, ".as", "r");
+    if (fileAs == NULL) {
+        printWarningGeneral("Skipping file ");
+        printMessage("'%s.as'.\n", fileName);
+        return FALSE;
+    }
+    source = readFileContents(fileAs, &length);
+    fclose(fileAs);
+    if (source == NULL) {
+        printErrorGeneral("Could not read file ");
+        printMessage("'%s.as'.\n", fileName);
+        return FALSE;
+    }
+    initMemoryFiles(&files);
+    addMemoryFile(&files, ".as", source, length);
+    useMemoryFiles(&files);
+    success = assembleFile(fileName, NULL, optionsKey);
+    useMemoryFiles(NULL);
+    clearMemoryFiles(&files);
+    return success;
+}
+
+/**
+ * Assembles a file given in the command line, with the per file reports of the options.
+ * @param name The base name of the file, or "-" for stdin.
+ * @param options The parsed options.
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @param files The files of the source in memory when it is assembled in a batch, NULL to use the file system.
+ * @return TRUE if all the output files were written, FALSE otherwise.
+ */
+static boolean assembleArgument (char *name, options_t *options, cache_t *cache, char *optionsKey, memory_files *files) {
+    boolean success;
+
+    if (statsEnabled == TRUE)
+        statsBeginFile();
+    if (memoryReportEnabled == TRUE)
+        memoryBeginFile();
+    if (perfEnabled == TRUE)
+        perfBeginFile();
+    TRACE_BEGIN("file", name);
+    if (strcmp(name, STDIN_FILE_NAME) == 0)
+        success = assembleStdin(options, cache, optionsKey);
+    else if (files != NULL) {
+        useMemoryFiles(files);
+        success = assembleFile(name, cache, optionsKey);
+        useMemoryFiles(NULL);
+    } else if (checkOnly == TRUE)
+        success = checkFile(name, optionsKey);
+    else
+        success = assembleFile(name, cache, optionsKey);
+    TRACE_END("file");
+    if (statsEnabled == TRUE)
+        statsEndFile(name);
+    if (memoryReportEnabled == TRUE)
+        memoryEndFile(name);
+    if (perfEnabled == TRUE)
+        perfEndFile(name);
+    return success;
+}
+
+/**
+ * Builds the path of a file from its base name and extension.
+ * @param fileName The base name of the file.
+ * @param fileExtension The extension.
+ * @return A newly allocated path (must be freed with freeMemory), or NULL if there is not enough memory.
+ */
+static char *batchPath (const char *fileName, const char *fileExtension) {
+    char *path = allocateMemory(strlen(fileName) + strlen(fileExtension) + 1, MEMORY_FILENAMES);
+    if (path != NULL)
+        sprintf(path, "%s%s", fileName, fileExtension);
+    return path;
+}
+
+/**
+ * Assembles a batch of source files with the batched file I/O: the sources are all read together, assembled one
+ * by one in memory, and then the outputs of all of them are written together.
+ * @param names The base names of the files (without the '.as' extension).
+ * @param count The number of files, at most IO_BATCH_FILES.
+ * @param io The batched file I/O.
+ * @param options The parsed options.
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @param failed Incremented for every file that failed.
+ * @param stop Set to TRUE when '--fail-fast=batch' skips the rest of the files.
+ * @return The number of files assembled (or checked), which is less than count if the rest were skipped.
+ */
+static int assembleBatch (char *names[], int count, io_batch *io, options_t *options, cache_t *cache,
+                          char *optionsKey, int *failed, boolean *stop) {
+    io_file sources[IO_BATCH_FILES], *outputs;
+    memory_files *files;
+    memory_file *output;
+    int i, j, assembled, outputCount = 0;
+
+    files = malloc(count * sizeof(memory_files));
+    outputs = malloc(count * MAX_MEMORY_FILES * sizeof(io_file));
+    if (files == NULL || outputs == NULL) {
+        printErrorGeneral("Not enough memory for a batch of files\n");
+        free(files);
+        free(outputs);
+        *failed += count;
+        return count;
+    }
+    for (i = 0; i < count; i++)
+        sources[i].path = batchPath(names[i], ".as");
+    readFilesBatch(io, sources, count);
+
+    for (i = 0; i < count && *stop == FALSE; i++) {
+        initMemoryFiles(&files[i]);
+        if (sources[i].done == FALSE) {
+            printWarningGeneral("Skipping file ");
+            printMessage("'%s.as'.\n", names[i]);
+        } else {
+            addMemoryFile(&files[i], ".as", sources[i].data, sources[i].length);
+            if (assembleArgument(names[i], options, cache, optionsKey, &files[i]) == TRUE)
+                continue;
+        }
+        (*failed)++;
+        if (failFast == FAIL_FAST_BATCH)
+            *stop = TRUE;
+    }
+    assembled = i;
+
+    /* every file the assembler created is written, just like it would have been without a batch */
+    for (i = 0; i < assembled && checkOnly == FALSE; i++) {
+        for (j = 0; j < files[i].count; j++) {
+            output = &files[i].files[j];
+            if (strcmp(output->extension, ".as") == 0)
+                continue;
+            outputs[outputCount].path = batchPath(names[i], output->extension);
+            outputs[outputCount].data = output->data;
+            outputs[outputCount].length = output->length;
+            if (outputs[outputCount].path != NULL)
+                outputCount++;
+        }
+    }
+    writeFilesBatch(io, outputs, outputCount);
+    for (i = 0; i < outputCount; i++) {
+        if (outputs[i].done == FALSE) {
+            printErrorGeneral("Could not write file ");
+            printMessage("'%s'.\n", outputs[i].path);
+        }
+        freeMemory(outputs[i].path, MEMORY_FILENAMES);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (i < assembled)
+            clearMemoryFiles(&files[i]);
+        else
+            free(sources[i].data);
+        freeMemory(sources[i].path, MEMORY_FILENAMES);
+    }
+    free(files);
+    free(outputs);
+    return assembled;
+}
+
+/* A source file on its way through the stages of '--pipeline' */
+typedef struct pipeline_job {
+    char *name;
+    memory_files files; /* the source and every output, kept in memory until the writer */
+    FILE *diagnostics; /* the messages of every stage, printed by the writer */
+    char *diagnosticsText;
+    size_t diagnosticsLength;
+    char cacheKey[CACHE_KEY_LENGTH+1];
+    boolean loaded; /* the source was read */
+    stage_result stage;
+    boolean success;
+    boolean skipped; /* not parsed because '--fail-fast=batch' stopped at an earlier file */
+} pipeline_job;
+
+/* The stages of '--pipeline' and the queues between them */
+typedef struct pipeline_t {
+    char **names;
+    int count;
+    cache_t *cache;
+    char *optionsKey;
+    job_queue read; /* reader -> preprocessor */
+    job_queue preprocessed; /* preprocessor -> parser */
+    job_queue parsed; /* parser -> writer */
+} pipeline_t;
+
+#define PIPELINE_STAGES 3 /* the threads of the pipeline, each with the queue it fills */
+
+/**
+ * Makes the messages and the files of the calling thread go to a job, or back to the defaults.
+ * @param job The job, or NULL.
+ */
+static void attachJob (pipeline_job *job) {
+    setThreadPrintStream(job != NULL ? job->diagnostics : NULL);
+    useMemoryFiles(job != NULL ? &job->files : NULL);
+}
+
+/**
+ * The reader stage: reads every source file into memory, in order.
+ * @param arg The pipeline.
+ * @return NULL.
+ */
+static void *readerStage (void *arg) {
+    pipeline_t *pipeline = arg;
+    pipeline_job *job;
+    FILE *fileAs;
+    char *source;
+    long length;
+    int i;
+
+    traceNameThread("reader");
+    for (i = 0; i < pipeline->count; i++) {
+        job = calloc(1, sizeof(pipeline_job));
+        if (job == NULL)
+            break;
+        job->name = pipeline->names[i];
+        initMemoryFiles(&job->files);
+        job->diagnostics = open_memstream(&job->diagnosticsText, &job->diagnosticsLength);
+        setThreadPrintStream(job->diagnostics);
+        TRACE_BEGIN("read", job->name);
+        fileAs = openFile(job->name, ".as", "r");
+        if (fileAs == NULL) {
+            printWarningGeneral("Skipping file ");
+            printMessage("'%s.as'.\n", job->name);
+        } else {
+            source = readFileContents(fileAs, &length);
+            fclose(fileAs);
+            if (source == NULL) {
+                printErrorGeneral("Could not read file ");
+                printMessage("'%s.as'.\n", job->name);
+            } else {
+                job->loaded = addMemoryFile(&job->files, ".as", source, length);
+                if (job->loaded == FALSE)
+                    free(source);
+            }
+        }
+        TRACE_END("read");
+        setThreadPrintStream(NULL);
+        pushQueue(&pipeline->read, job);
+    }
+    closeQueue(&pipeline->read);
+    return NULL;
+}
+
+/**
+ * The preprocessor stage: preprocesses every source into its '.am' file in memory, or restores it from the cache.
+ * @param arg The pipeline.
+ * @return NULL.
+ */
+static void *preprocessorStage (void *arg) {
+    pipeline_t *pipeline = arg;
+    pipeline_job *job;
+
+    traceNameThread("preprocessor");
+    while ((job = popQueue(&pipeline->read)) != NULL) {
+        if (job->loaded == TRUE) {
+            attachJob(job);
+            TRACE_BEGIN("file", job->name);
+            job->stage = preprocessSource(job->name, pipeline->cache, pipeline->optionsKey, job->cacheKey);
+            TRACE_END("file");
+            attachJob(NULL);
+        }
+        pushQueue(&pipeline->preprocessed, job);
+    }
+    closeQueue(&pipeline->preprocessed);
+    return NULL;
+}
+
+/**
+ * The parser stage: parses every preprocessed file, resolves its labels and encodes its outputs in memory.
+ * After the first file that fails with '--fail-fast=batch', the rest are skipped.
+ * @param arg The pipeline.
+ * @return NULL.
+ */
+static void *parserStage (void *arg) {
+    pipeline_t *pipeline = arg;
+    pipeline_job *job;
+    boolean stopped = FALSE;
+
+    traceNameThread("parser");
+    while ((job = popQueue(&pipeline->preprocessed)) != NULL) {
+        if (stopped == TRUE) {
+            job->skipped = TRUE;
+        } else if (job->stage == STAGE_PREPROCESSED) {
+            attachJob(job);
+            TRACE_BEGIN("file", job->name);
+            job->success = parseSource(job->name, pipeline->cache, job->cacheKey);
+            TRACE_END("file");
+            attachJob(NULL);
+        } else {
+            job->success = (job->stage == STAGE_RESTORED);
+        }
+        if (job->skipped == FALSE && job->success == FALSE && failFast == FAIL_FAST_BATCH)
+            stopped = TRUE;
+        pushQueue(&pipeline->parsed, job);
+    }
+    closeQueue(&pipeline->parsed);
+    return NULL;
+}
+
+/**
+ * Writes the outputs of a source file from memory into their files (nothing with '--check').
+ * @param name The base name of the file.
+ * @param files The source and the outputs in memory.
+ * @return TRUE if every output was written, FALSE otherwise.
+ */
+static boolean writeMemoryOutputs (char *name, memory_files *files) {
+    memory_file *output;
+    boolean written = TRUE;
+    FILE *file;
+    int i;
+
+    for (i = 0; i < files->count && checkOnly == FALSE; i++) {
+        output = &files->files[i];
+        if (strcmp(output->extension, ".as") == 0)
+            continue;
+        file = openFile(name, output->extension, "w");
+        if (file == NULL || fwrite(output->data, 1, output->length, file) != output->length) {
+            printErrorGeneral("Could not write file ");
+            printMessage("'%s%s'.\n", name, output->extension);
+            written = FALSE;
+        }
+        if (file != NULL && fclose(file) != 0)
+            written = FALSE;
+    }
+    return written;
+}
+
+/**
+ * Frees a job and everything it holds.
+ * @param job The job.
+ */
+static void freeJob (pipeline_job *job) {
+    if (job->diagnostics != NULL)
+        fclose(job->diagnostics);
+    free(job->diagnosticsText);
+    clearMemoryFiles(&job->files);
+    free(job);
+}
+
+/**
+ * Writes the outputs of a job from memory into their files, and prints its messages.
+ * @param job The job.
+ * @return TRUE if every output was written, FALSE otherwise.
+ */
+static boolean writeJob (pipeline_job *job) {
+    boolean written = writeMemoryOutputs(job->name, &job->files);
+
+    if (job->diagnostics != NULL) {
+        fclose(job->diagnostics);
+        job->diagnostics = NULL;
+        printMessage("%s", job->diagnosticsText);
+    }
+    return written;
+}
+
+/**
+ * Assembles source files one after the other, when the pipeline cannot be started.
+ * @param names The base names of the files (without the '.as' extension).
+ * @param count The number of files.
+ * @param options The parsed options.
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @param failed Incremented for every file that failed.
+ * @param stop Set to TRUE when '--fail-fast=batch' skips the rest of the files.
+ * @return The number of files assembled (or checked), which is less than count if the rest were skipped.
+ */
+static int assembleSerially (char *names[], int count, options_t *options, cache_t *cache, char *optionsKey,
+                             int *failed, boolean *stop) {
+    int i;
+
+    for (i = 0; i < count && *stop == FALSE; i++) {
+        if (assembleArgument(names[i], options, cache, optionsKey, NULL) == FALSE) {
+            (*failed)++;
+            if (failFast == FAIL_FAST_BATCH)
+                *stop = TRUE;
+        }
+    }
+    return i;
+}
+
+/**
+ * Assembles source files with a thread per stage: a reader, a preprocessor and a parser, connected by queues of
+ * PIPELINE_QUEUE_DEPTH files, while the calling thread writes the outputs. Every stage takes the files in order,
+ * and the messages of a file are kept until its outputs are written, so both come out as without a pipeline.
+ * If a queue or a thread cannot be created, the files are assembled one after the other instead.
+ * @param names The base names of the files (without the '.as' extension).
+ * @param count The number of files.
+ * @param options The parsed options.
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @param failed Incremented for every file that failed.
+ * @param stop Set to TRUE when '--fail-fast=batch' skips the rest of the files.
+ * @return The number of files assembled (or checked), which is less than count if the rest were skipped.
+ */
+static int assemblePipeline (char *names[], int count, options_t *options, cache_t *cache, char *optionsKey,
+                             int *failed, boolean *stop) {
+    static void *(*const stages[PIPELINE_STAGES])(void *) = {readerStage, preprocessorStage, parserStage};
+    pipeline_t pipeline;
+    pthread_t threads[PIPELINE_STAGES];
+    job_queue *queues[PIPELINE_STAGES];
+    pipeline_job *job;
+    int i, initialized, started = 0, assembled = 0;
+
+    pipeline.names = names;
+    pipeline.count = count;
+    pipeline.cache = cache;
+    pipeline.optionsKey = optionsKey;
+    queues[0] = &pipeline.read;
+    queues[1] = &pipeline.preprocessed;
+    queues[2] = &pipeline.parsed;
+    for (initialized = 0; initialized < PIPELINE_STAGES; initialized++) {
+        if (initQueue(queues[initialized], PIPELINE_QUEUE_DEPTH) == FALSE)
+            break;
+    }
+    while (initialized == PIPELINE_STAGES && started < PIPELINE_STAGES &&
+           pthread_create(&threads[started], NULL, stages[started], &pipeline) == 0)
+        started++;
+
+    if (started < PIPELINE_STAGES) {
+        printWarningGeneral("Could not start the pipeline, assembling the files one by one\n");
+        /* the stages that started run to the end of the files, so throw away what the last of them produces */
+        if (started > 0) {
+            while ((job = popQueue(queues[started - 1])) != NULL)
+                freeJob(job);
+        }
+        for (i = 0; i < started; i++)
+            pthread_join(threads[i], NULL);
+        for (i = 0; i < initialized; i++)
+            destroyQueue(queues[i]);
+        return assembleSerially(names, count, options, cache, optionsKey, failed, stop);
+    }
+
+    /* the writer: the jobs come out of the parser in the order of the command line */
+    while ((job = popQueue(&pipeline.parsed)) != NULL) {
+        if (job->skipped == FALSE) {
+            assembled++;
+            TRACE_BEGIN("write", job->name);
+            if (writeJob(job) == FALSE || job->success == FALSE)
+                (*failed)++;
+            TRACE_END("write");
+            if (job->success == FALSE && failFast == FAIL_FAST_BATCH)
+                *stop = TRUE;
+        }
+        freeJob(job);
+    }
+
+    for (i = 0; i < PIPELINE_STAGES; i++) {
+        pthread_join(threads[i], NULL);
+        destroyQueue(queues[i]);
+    }
+    return assembled;
+}
+
+/**
+ * Assembles the files of one shard, in memory, and writes its manifest: every input of the shard with the digest
+ * of its source, the outputs with their digests, the time it took and its errors and warnings.
+ * @param names The base names of all the files of every shard (without the '.as' extension).
+ * @param count The number of files.
+ * @param options The parsed options, with the shard.
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ * @param failed Incremented for every file that failed.
+ * @param stop Set to TRUE when '--fail-fast=batch' skips the rest of the files.
+ * @return The number of files assembled (or checked).
+ */
+static int assembleShard (char *names[], int count, options_t *options, cache_t *cache, char *optionsKey,
+                          int *failed, boolean *stop) {
+    char defaultPath[64], *path = options->manifestPath, *source, *messages;
+    int *assignment, i, j, assembled = 0, assigned = 0;
+    double start = monotonicSeconds(), fileStart;
+    size_t messagesLength;
+    memory_files files;
+    boolean success;
+    FILE *manifest, *capture, *fileAs;
+    long length;
+
+    assignment = malloc(count * sizeof(int));
+    if (assignment == NULL || assignShards(names, count, options->shards, assignment) == FALSE) {
+        printErrorGeneral("Not enough memory to assign the files to shards\n");
+        free(assignment);
+        (*failed)++;
+        return 0;
+    }
+    if (path == NULL) {
+        sprintf(defaultPath, "shard-%d-of-%d.manifest", options->shard, options->shards);
+        path = defaultPath;
+    }
+    manifest = fopen(path, "w");
+    if (manifest == NULL) {
+        printErrorGeneral("Could not write the manifest ");
+        printMessage("'%s'.\n", path);
+        free(assignment);
+        (*failed)++;
+        return 0;
+    }
+    writeManifestHeader(manifest, options->shard, options->shards, names, count);
+
+    for (i = 0; i < count; i++) {
+        if (assignment[i] != options->shard - 1)
+            continue;
+        assigned++;
+        /* the files '--fail-fast=batch' skips are still listed, so a merge knows they were not assembled */
+        if (*stop == TRUE) {
+            writeManifestInput(manifest, i, names[i], NULL, 0, "skipped", 0);
+            continue;
+        }
+        assembled++;
+        initMemoryFiles(&files);
+        messages = NULL;
+        capture = open_memstream(&messages, &messagesLength);
+        setThreadPrintStream(capture);
+        fileStart = monotonicSeconds();
+        source = NULL;
+        length = 0;
+        fileAs = openFile(names[i], ".as", "r");
+        if (fileAs == NULL) {
+            printWarningGeneral("Skipping file ");
+            printMessage("'%s.as'.\n", names[i]);
+        } else {
+            source = readFileContents(fileAs, &length);
+            fclose(fileAs);
+            if (source == NULL) {
+                printErrorGeneral("Could not read file ");
+                printMessage("'%s.as'.\n", names[i]);
+            } else if (addMemoryFile(&files, ".as", source, length) == FALSE) {
+                free(source);
+                source = NULL;
+            }
+        }
+        success = (source != NULL && assembleArgument(names[i], options, cache, optionsKey, &files) == TRUE);
+        if (writeMemoryOutputs(names[i], &files) == FALSE)
+            success = FALSE;
+        setThreadPrintStream(NULL);
+        if (capture != NULL)
+            fclose(capture);
+        if (messages != NULL)
+            printMessage("%s", messages);
+
+        writeManifestInput(manifest, i, names[i], source, length, success ? "ok" : "error",
+                           monotonicSeconds() - fileStart);
+        for (j = 0; j < files.count && checkOnly == FALSE; j++) {
+            if (strcmp(files.files[j].extension, ".as") != 0)
+                writeManifestOutput(manifest, i, files.files[j].extension, files.files[j].data, files.files[j].length);
+        }
+        if (messages != NULL)
+            writeManifestDiagnostics(manifest, i, messages, messagesLength);
+        free(messages);
+        clearMemoryFiles(&files);
+        if (success == FALSE) {
+            (*failed)++;
+            if (failFast == FAIL_FAST_BATCH)
+                *stop = TRUE;
+        }
+    }
+
+    /* a manifest without its last record is from a shard that did not finish */
+    fprintf(manifest, "elapsed\t%.3f\n", (monotonicSeconds() - start) * 1000);
+    if (fclose(manifest) != 0) {
+        printErrorGeneral("Could not write the manifest ");
+        printMessage("'%s'.\n", path);
+        (*failed)++;
+    } else {
+        printMessage("Shard %d/%d: %d of %d files, manifest '%s'\n", options->shard, options->shards, assigned,
+                     count, path);
+    }
+    free(assignment);
+    return assembled;
+}
+
+/**
+ * Assembles the source files given in the command line again every time they (or the files they include) change,
+ * until Ctrl-C. Everything stays loaded between the runs, and only the files that changed are assembled.
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments.
+ * @param options The parsed options.
+ * @param cache The build cache, or NULL if caching is disabled.
+ * @param optionsKey String describing the options that change the output.
+ */
+static void watchFiles (int argc, char *argv[], options_t *options, cache_t *cache, char *optionsKey) {
+    watch_t watch;
+    char **names;
+    boolean *changed, success;
+    double start;
+    int i, count = 0;
+
+    names = malloc(argc * sizeof(char *));
+    changed = malloc(argc * sizeof(boolean));
+    if (names == NULL || changed == NULL) {
+        printErrorGeneral("Not enough memory to watch the files\n");
+        free(names);
+        free(changed);
+        return;
+    }
+    for (i = 1; i < argc; i++) {
+        if (isOption(argv[i]) == FALSE && strcmp(argv[i], STDIN_FILE_NAME) != 0)
+            names[count++] = argv[i];
+    }
+    if (count > 0 && initWatch(&watch, names, count) == TRUE) {
+        printMessage("Watching %d files, press Ctrl-C to stop\n", count);
+        while (waitForChanges(&watch, changed) > 0) {
+            for (i = 0; i < count; i++) {
+                if (changed[i] == FALSE)
+                    continue;
+                start = monotonicSeconds();
+                success = assembleArgument(names[i], options, cache, optionsKey, NULL);
+                printMessage("[watch] '%s': %s in %.3f ms\n", names[i], success ? "ok" : "failed",
+                             (monotonicSeconds() - start) * 1000);
+                refreshWatch(&watch, i);
+            }
+        }
+        closeWatch(&watch);
+    }
+    free(names);
+    free(changed);
+}
+
+int main(int argc, char * argv[]) {
+    int i, next, checked = 0, failed = 0, groupCount = 0;
+    options_t options;
+    cache_t cache;
+    io_batch io;
+    char **group;
+    boolean useCache = FALSE, stop = FALSE;
+    char optionsKey[MAX_OPTIONS_KEY_LENGTH];
+
+    if (argc <= 1) {
+        printErrorGeneral("No files in command line\n");
+        return 1;
+    }
+    /* a source file named 'merge.as' is still assembled as './merge' */
+    if (strcmp(argv[1], "merge") == 0) {
+        if (argc < 4) {
+            printErrorGeneral("Usage: assembler merge <merged manifest> <shard manifest>...\n");
+            return 1;
+        }
+        return mergeManifests(argv[2], argv + 3, argc - 3);
+    }
+
+    switch (parseOptions(argc, argv, &options)) {
+        case -1: return 1;
+        case 0:
+            printErrorGeneral("No files in command line\n");
+            return 1;
+    }
+    if (options.streaming == TRUE) /* stdout is reserved for the framed stream */
+        setPrintStream(stderr);
+    statsEnabled = options.stats;
+    memoryReportEnabled = options.memoryReport;
+    optimizeEnabled = options.optimize;
+    poolEnabled = options.pool;
+    deadStripEnabled = options.deadStrip;
+    /* the sidecar is a file, so '--check' does not keep one */
+    incrementalEnabled = (options.incremental == TRUE && options.check == FALSE);
+    outputJobs = (int) options.jobs;
+    baseAddress = (int) options.base;
+    checkOnly = options.check;
+    failFast = options.failFast;
+    if (options.perf == TRUE) /* without counters (e.g. in a container) nothing is reported */
+        startPerfCounters();
+    if (options.tracePath != NULL && startTrace() == TRUE)
+        traceNameThread("main");
+    if (options.cacheDirectory != NULL && options.check == FALSE)
+        useCache = initCache(&cache, options.cacheDirectory, options.cacheSize);
+    writeOptionsKey(&options, optionsKey);
+
+    /* '--manifest' alone writes the manifest of a single shard */
+    if (options.manifestPath != NULL && options.shards == 0) {
+        options.shard = 1;
+        options.shards = 1;
+    }
+    if (options.shards > 0 && (options.streaming == TRUE || options.watch == TRUE)) {
+        printErrorGeneral("'--shard' and '--manifest' do not go with stdin ('-') or '--watch'.\n");
+        return 1;
+    }
+    if (options.shards > 0 && (options.io != IO_BACKEND_STDIO || options.pipeline == TRUE)) {
+        printWarningGeneral("Ignoring '--io' and '--pipeline', a shard assembles its files one by one in memory.\n");
+        options.pipeline = FALSE;
+        options.io = IO_BACKEND_STDIO;
+    }
+    if (options.io != IO_BACKEND_STDIO && initBatchIO(&io, options.io) == FALSE && options.io == IO_BACKEND_URING)
+        printWarningGeneral("io_uring is not available, reading and writing with pread and pwrite.\n");
+    /* the reports of '--stats', '--memory' and '--perf' measure one file at a time */
+    if (options.pipeline == TRUE && (options.io != IO_BACKEND_STDIO || statsEnabled == TRUE ||
+                                     memoryReportEnabled == TRUE || perfEnabled == TRUE)) {
+        printWarningGeneral("Ignoring '--pipeline', which does not go with '--io', '--stats', '--memory' or '--perf'.\n");
+        options.pipeline = FALSE;
+    }
+    memoryLockEnabled = options.pipeline;
+
+    group = malloc(argc * sizeof(char *));
+    if (group == NULL) {
+        printErrorGeneral("Not enough memory for the file names\n");
+        return 1;
+    }
+    /* every shard sees every file, so they all assign the files the same way */
+    if (options.shards > 0) {
+        for (i = 1; i < argc; i++) {
+            if (isOption(argv[i]) == FALSE)
+                group[groupCount++] = argv[i];
+        }
+        checked = assembleShard(group, groupCount, &options, useCache ? &cache : NULL, optionsKey, &failed, &stop);
+        groupCount = 0;
+        stop = TRUE;
+    }
+    for (i = 1; i < argc && stop == FALSE; i++) {
+        if (isOption(argv[i]) == TRUE)
+            continue;
+        /* a group ends at the last file, before stdin (which is assembled on its own), or when a batch is full */
+        if ((options.io != IO_BACKEND_STDIO || options.pipeline == TRUE) && strcmp(argv[i], STDIN_FILE_NAME) != 0) {
+            group[groupCount++] = argv[i];
+            for (next = i + 1; next < argc && isOption(argv[next]) == TRUE; next++)
+                ;
+            if (next == argc || strcmp(argv[next], STDIN_FILE_NAME) == 0 ||
+                (options.io != IO_BACKEND_STDIO && groupCount == IO_BATCH_FILES)) {
+                if (options.pipeline == TRUE)
+                    checked += assemblePipeline(group, groupCount, &options, useCache ? &cache : NULL, optionsKey,
+                                                 &failed, &stop);
+                else
+                    checked += assembleBatch(group, groupCount, &io, &options, useCache ? &cache : NULL, optionsKey,
+                                             &failed, &stop);
+                groupCount = 0;
+            }
+            continue;
+        }
+        checked++;
+        if (assembleArgument(argv[i], &options, useCache ? &cache : NULL, optionsKey, NULL) == FALSE) {
+            failed++;
+            if (failFast == FAIL_FAST_BATCH)
+                stop = TRUE;
+        }
+    }
+    free(group);
+    if (options.io != IO_BACKEND_STDIO) {
+        printBatchIOReport(&io, checked);
+        closeBatchIO(&io);
+    }
+    if (checkOnly == TRUE)
+        printMessage("Checked %d files: %d with errors\n", checked, failed);
+    if (options.watch == TRUE)
+        watchFiles(argc, argv, &options, useCache ? &cache : NULL, optionsKey);
+
+    if (statsEnabled == TRUE)
+        printStatsTotal();
+    if (memoryReportEnabled == TRUE)
+        printMemoryTotal();
+    if (perfEnabled == TRUE) {
+        printPerfTotal();
+        stopPerfCounters();
+    }
+    if (useCache == TRUE) {
+        evictCache(&cache);
+        printCacheStatistics(&cache);
+    }
+    if (traceEnabled == TRUE)
+        writeTrace(options.tracePath);
+    /* the exit status tells scripts whether every file passed */
+    return ((checkOnly == TRUE || failFast != FAIL_FAST_NONE) && failed > 0) ? 1 : 0;
+}
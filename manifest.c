@@ -0,0 +1,579 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "manifest.h"
+#include "hash.h"
+#include "frame.h"
+#include "print.h"
+#include "utils.h"
+
+#define MAX_MANIFEST_FIELDS 8
+#define MAX_REPORTED_PROBLEMS 20 /* problems of the same kind printed by a merge before they are only counted */
+
+/* An input on its way to a shard */
+typedef struct shard_input {
+    long cost;
+    unsigned long hash;
+    int index;
+} shard_input;
+
+/* A shard and the bytes it was given, in the heap of the least loaded shards */
+typedef struct shard_load {
+    long bytes;
+    int shard;
+} shard_load;
+
+/* The kinds of the records of an input, in the order they are merged */
+typedef enum record_kind {
+    RECORD_INPUT = 0,
+    RECORD_OUTPUT,
+    RECORD_DIAGNOSTIC
+} record_kind;
+
+/* A record of an input, kept as written for the merged manifest */
+typedef struct manifest_record {
+    int index;
+    record_kind kind;
+    long order; /* the position of the record among all the records read, which keeps the outputs in order */
+    char *line;
+} manifest_record;
+
+/* A manifest read by a merge */
+typedef struct shard_manifest {
+    char *path;
+    char *contents;
+    int shard;
+    int shards;
+    int inputs;
+    char listDigest[DIGEST_HEX_LENGTH+1];
+    double elapsed; /* -1 if the manifest has no 'elapsed' record, so it was not finished */
+    int assigned;
+    int failed;
+    long bytes;
+} shard_manifest;
+
+/* How an input was covered by the shards */
+typedef struct input_coverage {
+    int times;
+    int shard; /* the shard of the first manifest that has it */
+    const char *name;
+    boolean skipped;
+    boolean failed;
+} input_coverage;
+
+/**
+ * Orders the inputs from the biggest to the smallest, equal ones by the hash of their names and then by position.
+ * @param first The first input.
+ * @param second The second input.
+ * @return A negative number, zero or a positive number, as qsort expects.
+ */
+static int compareShardInputs (const void *first, const void *second) {
+    const shard_input *a = first, *b = second;
+    if (a->cost != b->cost)
+        return (a->cost > b->cost) ? -1 : 1;
+    if (a->hash != b->hash)
+        return (a->hash < b->hash) ? -1 : 1;
+    return a->index - b->index;
+}
+
+/**
+ * Checks if a shard has less load than another, the lower shard first when they have the same.
+ * @param a The first shard.
+ * @param b The second shard.
+ * @return TRUE if a comes before b in the heap.
+ */
+static boolean lessLoaded (shard_load *a, shard_load *b) {
+    return (a->bytes < b->bytes || (a->bytes == b->bytes && a->shard < b->shard));
+}
+
+/**
+ * Moves the root of a heap of shards down to its place.
+ * @param heap The heap, least loaded first.
+ * @param count The number of shards in the heap.
+ */
+static void siftDown (shard_load heap[], int count) {
+    int parent = 0, child;
+    shard_load moved = heap[0];
+
+    while ((child = 2 * parent + 1) < count) {
+        if (child + 1 < count && lessLoaded(&heap[child + 1], &heap[child]) == TRUE)
+            child++;
+        if (lessLoaded(&heap[child], &moved) == FALSE)
+            break;
+        heap[parent] = heap[child];
+        parent = child;
+    }
+    heap[parent] = moved;
+}
+
+/**
+ * Assigns every input to a shard, the same way on every machine given the same inputs: the inputs are taken from
+ * the biggest '.as' file to the smallest (equal sizes in the order of a hash of their names), and each one goes to
+ * the shard with the fewest bytes so far, counting SHARD_FILE_COST for every file.
+ * @param names The base names of the inputs (without the '.as' extension).
+ * @param count The number of inputs.
+ * @param shards The number of shards.
+ * @param assignment Receives the shard of every input, counted from 0.
+ * @return TRUE if the inputs were assigned, FALSE if there is not enough memory.
+ */
+boolean assignShards (char *names[], int count, int shards, int assignment[]) {
+    shard_input *inputs = malloc((count > 0 ? count : 1) * sizeof(shard_input));
+    shard_load *heap = malloc(shards * sizeof(shard_load));
+    struct stat status;
+    char *path;
+    int i;
+
+    if (inputs == NULL || heap == NULL) {
+        free(inputs);
+        free(heap);
+        return FALSE;
+    }
+    for (i = 0; i < count; i++) {
+        path = malloc(strlen(names[i]) + 4);
+        inputs[i].cost = SHARD_FILE_COST;
+        if (path != NULL) {
+            sprintf(path, "%s.as", names[i]);
+            if (stat(path, &status) == 0)
+                inputs[i].cost += (long) status.st_size;
+            free(path);
+        }
+        inputs[i].hash = hashString(names[i]);
+        inputs[i].index = i;
+    }
+    qsort(inputs, count, sizeof(shard_input), compareShardInputs);
+
+    /* every shard starts empty, so the heap is already in order */
+    for (i = 0; i < shards; i++) {
+        heap[i].bytes = 0;
+        heap[i].shard = i;
+    }
+    for (i = 0; i < count; i++) {
+        assignment[inputs[i].index] = heap[0].shard;
+        heap[0].bytes += inputs[i].cost;
+        siftDown(heap, shards);
+    }
+    free(inputs);
+    free(heap);
+    return TRUE;
+}
+
+/**
+ * Writes text into a manifest, escaping the tabs, new lines and backslashes.
+ * @param file The manifest.
+ * @param text The text.
+ * @param length The number of bytes in text.
+ */
+static void writeEscaped (FILE *file, const char *text, size_t length) {
+    size_t i;
+    for (i = 0; i < length; i++) {
+        if (text[i] == '\t')
+            fputs("\\t", file);
+        else if (text[i] == '\n')
+            fputs("\\n", file);
+        else if (text[i] == '\\')
+            fputs("\\\\", file);
+        else
+            fputc(text[i], file);
+    }
+}
+
+/**
+ * Writes the digest of some bytes as hex.
+ * @param data The bytes.
+ * @param length The number of bytes in data.
+ * @param hex Receives the digest, at least DIGEST_HEX_LENGTH + 1 characters long.
+ */
+static void digestBytes (const char *data, size_t length, char *hex) {
+    digest_t digest;
+    digestInit(&digest);
+    digestUpdate(&digest, data, length);
+    digestToHex(&digest, hex);
+}
+
+/**
+ * Writes the header of a manifest.
+ * @param file The manifest.
+ * @param shard The shard, counted from 1.
+ * @param shards The number of shards.
+ * @param names The base names of all the inputs, of every shard.
+ * @param count The number of inputs.
+ */
+void writeManifestHeader (FILE *file, int shard, int shards, char *names[], int count) {
+    char hex[DIGEST_HEX_LENGTH+1];
+    digest_t digest;
+    int i;
+
+    /* the list of inputs tells the manifests of one run from those of another */
+    digestInit(&digest);
+    for (i = 0; i < count; i++)
+        digestUpdate(&digest, names[i], strlen(names[i]) + 1);
+    digestToHex(&digest, hex);
+    fprintf(file, "%s\nshard\t%d\t%d\ninputs\t%d\t%s\n", MANIFEST_MAGIC, shard, shards, count, hex);
+}
+
+/**
+ * Writes the record of an input.
+ * @param file The manifest.
+ * @param index The index of the input among all the inputs.
+ * @param name The base name of the input.
+ * @param source The contents of its '.as' file, or NULL if it could not be read.
+ * @param length The number of bytes in source.
+ * @param status "ok", "error" or "skipped".
+ * @param seconds The time it took to assemble the input.
+ */
+void writeManifestInput (FILE *file, int index, const char *name, const char *source, size_t length,
+                         const char *status, double seconds) {
+    char hex[DIGEST_HEX_LENGTH+1];
+
+    if (source != NULL)
+        digestBytes(source, length, hex);
+    else
+        strcpy(hex, "-");
+    fprintf(file, "input\t%d\t", index);
+    writeEscaped(file, name, strlen(name));
+    fprintf(file, "\t%lu\t%s\t%s\t%.3f\n", (unsigned long) (source != NULL ? length : 0), hex, status, seconds * 1000);
+}
+
+/**
+ * Writes the record of an output of an input.
+ * @param file The manifest.
+ * @param index The index of the input.
+ * @param extension The extension of the output.
+ * @param data The contents of the output.
+ * @param length The number of bytes in data.
+ */
+void writeManifestOutput (FILE *file, int index, const char *extension, const char *data, size_t length) {
+    char hex[DIGEST_HEX_LENGTH+1];
+    digestBytes(data, length, hex);
+    fprintf(file, "output\t%d\t%s\t%lu\t%s\n", index, extension, (unsigned long) length, hex);
+}
+
+/**
+ * Writes a record for every error and warning among the messages of an input.
+ * @param file The manifest.
+ * @param index The index of the input.
+ * @param messages The messages printed while the input was assembled.
+ * @param length The number of bytes in messages.
+ */
+void writeManifestDiagnostics (FILE *file, int index, const char *messages, size_t length) {
+    char *line = malloc(length + 1);
+    size_t start = 0, end, i, lineLength;
+
+    if (line == NULL)
+        return;
+    while (start < length) {
+        for (end = start; end < length && messages[end] != '\n'; end++)
+            ;
+        /* the colors are left out, so the records are the same on any terminal */
+        lineLength = 0;
+        for (i = start; i < end; i++) {
+            if (messages[i] == '\033' && i + 1 < end && messages[i + 1] == '[') {
+                for (i += 2; i < end && (messages[i] < '@' || messages[i] > '~'); i++)
+                    ;
+                continue;
+            }
+            line[lineLength++] = messages[i];
+        }
+        if ((lineLength >= 5 && strncmp(line, "ERROR", 5) == 0) || (lineLength >= 7 && strncmp(line, "WARNING", 7) == 0)) {
+            fprintf(file, "diagnostic\t%d\t", index);
+            writeEscaped(file, line, lineLength);
+            fputc('\n', file);
+        }
+        start = end + 1;
+    }
+    free(line);
+}
+
+/**
+ * Splits a record into its tab separated fields, in place.
+ * @param line The record.
+ * @param fields Receives the fields.
+ * @return The number of fields (at most MAX_MANIFEST_FIELDS).
+ */
+static int splitFields (char *line, char *fields[]) {
+    int count = 0;
+    fields[count++] = line;
+    while (count < MAX_MANIFEST_FIELDS && (line = strchr(line, '\t')) != NULL) {
+        *line++ = '\0';
+        fields[count++] = line;
+    }
+    return count;
+}
+
+/**
+ * Reads the header of a manifest and points at its records.
+ * @param manifest The manifest, whose path is set.
+ * @param records Receives the first record.
+ * @return TRUE if the manifest was read and has a valid header, FALSE otherwise.
+ */
+static boolean readManifestHeader (shard_manifest *manifest, char **records) {
+    FILE *file = fopen(manifest->path, "r");
+    long length;
+    char *second, *third;
+
+    manifest->contents = NULL;
+    if (file != NULL) {
+        manifest->contents = readFileContents(file, &length);
+        fclose(file);
+    }
+    if (manifest->contents == NULL) {
+        printErrorGeneral("Could not read the manifest ");
+        printMessage("'%s'.\n", manifest->path);
+        return FALSE;
+    }
+    second = strchr(manifest->contents, '\n');
+    third = (second != NULL) ? strchr(second + 1, '\n') : NULL;
+    *records = (third != NULL) ? strchr(third + 1, '\n') : NULL;
+    if (*records == NULL || strncmp(manifest->contents, MANIFEST_MAGIC "\n", strlen(MANIFEST_MAGIC) + 1) != 0 ||
+        sscanf(second + 1, "shard\t%d\t%d", &manifest->shard, &manifest->shards) != 2 ||
+        sscanf(third + 1, "inputs\t%d\t%32s", &manifest->inputs, manifest->listDigest) != 2 ||
+        manifest->shards < 1 || manifest->shard < 1 || manifest->shard > manifest->shards || manifest->inputs < 0) {
+        printErrorGeneral("Not a shard manifest ");
+        printMessage("'%s'.\n", manifest->path);
+        return FALSE;
+    }
+    (*records)++;
+    return TRUE;
+}
+
+/**
+ * Orders the records by input, then by kind, then as they were read.
+ * @param first The first record.
+ * @param second The second record.
+ * @return A negative number, zero or a positive number, as qsort expects.
+ */
+static int compareRecords (const void *first, const void *second) {
+    const manifest_record *a = first, *b = second;
+    if (a->index != b->index)
+        return a->index - b->index;
+    if (a->kind != b->kind)
+        return (int) a->kind - (int) b->kind;
+    return (a->order < b->order) ? -1 : (a->order > b->order);
+}
+
+/**
+ * Reads the records of a manifest, and counts every input it covers.
+ * @param manifest The manifest, whose header was read.
+ * @param text The first record.
+ * @param records The records read so far, which grow to take these ones.
+ * @param recordCount The number of records read so far.
+ * @param capacity The number of records there is room for.
+ * @param coverage The coverage of every input.
+ * @return TRUE if every record is valid, FALSE otherwise.
+ */
+static boolean readManifestRecords (shard_manifest *manifest, char *text, manifest_record **records, long *recordCount,
+                                    long *capacity, input_coverage coverage[]) {
+    manifest_record *bigger;
+    char *fields[MAX_MANIFEST_FIELDS], *end, *line;
+    int count, index;
+    record_kind kind;
+
+    manifest->elapsed = -1;
+    for (; *text != '\0'; text = end + 1) {
+        end = strchr(text, '\n');
+        if (end == NULL)
+            end = text + strlen(text) - 1; /* a last record without a new line */
+        else
+            *end = '\0';
+        if (*text == '\0')
+            continue;
+        line = malloc(strlen(text) + 1);
+        if (line == NULL)
+            return FALSE;
+        strcpy(line, text);
+        count = splitFields(text, fields);
+        if (strcmp(fields[0], "elapsed") == 0 && count == 2) {
+            manifest->elapsed = atof(fields[1]);
+            free(line);
+            continue;
+        }
+        kind = (strcmp(fields[0], "input") == 0) ? RECORD_INPUT :
+               (strcmp(fields[0], "output") == 0) ? RECORD_OUTPUT : RECORD_DIAGNOSTIC;
+        index = (count >= 2) ? atoi(fields[1]) : -1;
+        if ((kind == RECORD_DIAGNOSTIC && strcmp(fields[0], "diagnostic") != 0) || index < 0 || index >= manifest->inputs ||
+            (kind == RECORD_INPUT && count != 7) || (kind == RECORD_OUTPUT && count != 5)) {
+            printErrorGeneral("Invalid record in the manifest ");
+            printMessage("'%s': '%s'.\n", manifest->path, line);
+            free(line);
+            return FALSE;
+        }
+
+        if (kind == RECORD_INPUT) {
+            manifest->assigned++;
+            manifest->bytes += atol(fields[3]);
+            coverage[index].skipped |= (strcmp(fields[5], "skipped") == 0);
+            if (strcmp(fields[5], "error") == 0) {
+                coverage[index].failed = TRUE;
+                manifest->failed++;
+            }
+            if (coverage[index].times++ == 0) {
+                coverage[index].shard = manifest->shard;
+                coverage[index].name = fields[2];
+            }
+        }
+        if (*recordCount == *capacity) {
+            *capacity *= 2;
+            bigger = realloc(*records, *capacity * sizeof(manifest_record));
+            if (bigger == NULL) {
+                free(line);
+                return FALSE;
+            }
+            *records = bigger;
+        }
+        (*records)[*recordCount].index = index;
+        (*records)[*recordCount].kind = kind;
+        (*records)[*recordCount].order = *recordCount;
+        (*records)[*recordCount].line = line;
+        (*recordCount)++;
+    }
+    return TRUE;
+}
+
+/**
+ * Prints a problem found by a merge, unless too many of its kind were printed already.
+ * @param printed The number of problems of its kind printed so far, which is incremented.
+ * @param format The format string of the message.
+ * @param index The index of the input.
+ * @param name The name of the input, or NULL if no shard has it (and format has no name).
+ * @param shard The shard of the input.
+ */
+static void printCoverageProblem (int *printed, const char *format, int index, const char *name, int shard) {
+    if ((*printed)++ >= MAX_REPORTED_PROBLEMS)
+        return;
+    printErrorGeneral("");
+    if (name == NULL)
+        printMessage(format, index);
+    else
+        printMessage(format, index, name, shard);
+}
+
+/**
+ * Combines the manifests of all the shards of a run into one merged manifest, prints a report, and checks that
+ * every input was assembled by exactly one shard.
+ * @param outputPath The path of the merged manifest.
+ * @param paths The paths of the manifests of the shards.
+ * @param count The number of manifests.
+ * @return 0 if every input was covered exactly once and assembled without errors, 1 otherwise.
+ */
+int mergeManifests (const char *outputPath, char *paths[], int count) {
+    shard_manifest *manifests = calloc(count, sizeof(shard_manifest));
+    manifest_record *records = malloc(64 * sizeof(manifest_record));
+    input_coverage *coverage = NULL;
+    int *shardOwners = NULL;
+    long recordCount = 0, capacity = 64, i, outputs = 0;
+    int j, inputs = 0, shards = 0, missing = 0, duplicated = 0, skipped = 0, failed = 0;
+    double slowest = 0;
+    boolean valid = (manifests != NULL && records != NULL);
+    char *text = NULL;
+    FILE *file;
+
+    /* every manifest must come from the same run: the same number of shards and the same list of inputs */
+    for (j = 0; j < count && valid == TRUE; j++) {
+        manifests[j].path = paths[j];
+        valid = readManifestHeader(&manifests[j], &text);
+        if (valid == TRUE && j == 0) {
+            inputs = manifests[0].inputs;
+            shards = manifests[0].shards;
+            coverage = calloc(inputs > 0 ? inputs : 1, sizeof(input_coverage));
+            shardOwners = calloc(shards + 1, sizeof(int));
+            valid = (coverage != NULL && shardOwners != NULL);
+        } else if (valid == TRUE && (manifests[j].shards != shards || manifests[j].inputs != inputs ||
+                                     strcmp(manifests[j].listDigest, manifests[0].listDigest) != 0)) {
+            printErrorGeneral("The manifests are not from the same run: ");
+            printMessage("'%s' has %d inputs in %d shards, '%s' has %d in %d (or another list of inputs).\n",
+                         manifests[0].path, inputs, shards, manifests[j].path, manifests[j].inputs, manifests[j].shards);
+            valid = FALSE;
+        }
+        if (valid == TRUE && shardOwners[manifests[j].shard] != 0) {
+            printErrorGeneral("Shard ");
+            printMessage("%d/%d is in both '%s' and '%s'.\n", manifests[j].shard, shards,
+                         paths[shardOwners[manifests[j].shard] - 1], paths[j]);
+            valid = FALSE;
+        }
+        if (valid == TRUE) {
+            shardOwners[manifests[j].shard] = j + 1;
+            valid = readManifestRecords(&manifests[j], text, &records, &recordCount, &capacity, coverage);
+        }
+    }
+
+    if (valid == TRUE) {
+        printMessage("Merged %d of %d shards, %d inputs:\n", count, shards, inputs);
+        for (j = 0; j < count; j++) {
+            printMessage("  shard %d/%d: %d inputs, %ld bytes, %d with errors, ", manifests[j].shard, shards,
+                         manifests[j].assigned, manifests[j].bytes, manifests[j].failed);
+            if (manifests[j].elapsed < 0) {
+                printMessage("unfinished\n");
+                printErrorGeneral("The manifest ");
+                printMessage("'%s' has no 'elapsed' record, the shard did not finish.\n", manifests[j].path);
+                valid = FALSE;
+            } else {
+                printMessage("%.1f ms\n", manifests[j].elapsed);
+                if (manifests[j].elapsed > slowest)
+                    slowest = manifests[j].elapsed;
+            }
+        }
+        for (j = 1; j <= shards; j++) {
+            if (shardOwners[j] == 0) {
+                printErrorGeneral("Shard ");
+                printMessage("%d/%d has no manifest.\n", j, shards);
+                valid = FALSE;
+            }
+        }
+        for (j = 0; j < inputs; j++) {
+            if (coverage[j].times == 0)
+                printCoverageProblem(&missing, "Input #%d is not covered by any shard.\n", j, NULL, 0);
+            else if (coverage[j].times > 1)
+                printCoverageProblem(&duplicated, "Input #%d (%s) is covered more than once, first by shard %d.\n",
+                                     j, coverage[j].name, coverage[j].shard);
+            else if (coverage[j].skipped == TRUE)
+                printCoverageProblem(&skipped, "Input #%d (%s) was skipped by shard %d.\n",
+                                     j, coverage[j].name, coverage[j].shard);
+            else if (coverage[j].failed == TRUE)
+                failed++;
+        }
+        if (missing + duplicated + skipped > 0) {
+            printErrorGeneral("");
+            printMessage("Coverage failed: %d inputs not covered, %d covered more than once, %d skipped.\n",
+                         missing, duplicated, skipped);
+            valid = FALSE;
+        } else if (shards == count) {
+            printMessage("Every input was covered exactly once: %d assembled, %d with errors, slowest shard %.1f ms.\n",
+                         inputs - failed, failed, slowest);
+        }
+    }
+
+    /* the merged manifest holds the records of every input in the order of the inputs */
+    if (valid == TRUE) {
+        qsort(records, recordCount, sizeof(manifest_record), compareRecords);
+        file = fopen(outputPath, "w");
+        if (file == NULL) {
+            printErrorGeneral("Could not write the merged manifest ");
+            printMessage("'%s'.\n", outputPath);
+            valid = FALSE;
+        } else {
+            fprintf(file, "%s\nmerged\t%d\ninputs\t%d\t%s\n", MANIFEST_MAGIC, shards, inputs, manifests[0].listDigest);
+            for (i = 0; i < recordCount; i++) {
+                fprintf(file, "%s\n", records[i].line);
+                outputs += (records[i].kind == RECORD_OUTPUT);
+            }
+            fprintf(file, "elapsed\t%.3f\n", slowest);
+            if (fclose(file) != 0)
+                valid = FALSE;
+            printMessage("Wrote '%s': %ld outputs\n", outputPath, outputs);
+        }
+    }
+
+    for (i = 0; i < recordCount; i++)
+        free(records[i].line);
+    for (j = 0; manifests != NULL && j < count; j++)
+        free(manifests[j].contents);
+    free(records);
+    free(manifests);
+    free(coverage);
+    free(shardOwners);
+    return (valid == TRUE && failed == 0) ? 0 : 1;
+}
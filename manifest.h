@@ -0,0 +1,89 @@
+#ifndef MANIFEST_H
+#define MANIFEST_H
+
+#include <stdio.h>
+
+#include "utils.h"
+
+#define MANIFEST_MAGIC "assembler-manifest 1"
+#define MAX_SHARDS 4096
+#define SHARD_FILE_COST 1024 /* the fixed cost of assembling a file, counted as this many bytes of source */
+
+/*
+ * A manifest is a text file with one tab separated record per line (tabs, new lines and backslashes in the
+ * names and messages are escaped as \t, \n and \\):
+ *     assembler-manifest 1
+ *     shard    <i>    <N>                   ('merged <N>' in a merged manifest)
+ *     inputs   <count>    <digest of the list of inputs>
+ *     input    <index>    <name>    <bytes>    <digest of the source>    ok|error|skipped    <milliseconds>
+ *     output   <index>    <extension>    <bytes>    <digest>
+ *     diagnostic    <index>    <message without colors>
+ *     elapsed  <milliseconds>
+ * where index is the position of the input among all the inputs of the command line, counted from 0.
+ */
+
+/**
+ * Assigns every input to a shard, the same way on every machine given the same inputs: the inputs are taken from
+ * the biggest '.as' file to the smallest (equal sizes in the order of a hash of their names), and each one goes to
+ * the shard with the fewest bytes so far, counting SHARD_FILE_COST for every file.
+ * @param names The base names of the inputs (without the '.as' extension).
+ * @param count The number of inputs.
+ * @param shards The number of shards.
+ * @param assignment Receives the shard of every input, counted from 0.
+ * @return TRUE if the inputs were assigned, FALSE if there is not enough memory.
+ */
+boolean assignShards(char *names[], int count, int shards, int assignment[]);
+
+/**
+ * Writes the header of a manifest.
+ * @param file The manifest.
+ * @param shard The shard, counted from 1.
+ * @param shards The number of shards.
+ * @param names The base names of all the inputs, of every shard.
+ * @param count The number of inputs.
+ */
+void writeManifestHeader(FILE *file, int shard, int shards, char *names[], int count);
+
+/**
+ * Writes the record of an input.
+ * @param file The manifest.
+ * @param index The index of the input among all the inputs.
+ * @param name The base name of the input.
+ * @param source The contents of its '.as' file, or NULL if it could not be read.
+ * @param length The number of bytes in source.
+ * @param status "ok", "error" or "skipped".
+ * @param seconds The time it took to assemble the input.
+ */
+void writeManifestInput(FILE *file, int index, const char *name, const char *source, size_t length,
+                        const char *status, double seconds);
+
+/**
+ * Writes the record of an output of an input.
+ * @param file The manifest.
+ * @param index The index of the input.
+ * @param extension The extension of the output.
+ * @param data The contents of the output.
+ * @param length The number of bytes in data.
+ */
+void writeManifestOutput(FILE *file, int index, const char *extension, const char *data, size_t length);
+
+/**
+ * Writes a record for every error and warning among the messages of an input.
+ * @param file The manifest.
+ * @param index The index of the input.
+ * @param messages The messages printed while the input was assembled.
+ * @param length The number of bytes in messages.
+ */
+void writeManifestDiagnostics(FILE *file, int index, const char *messages, size_t length);
+
+/**
+ * Combines the manifests of all the shards of a run into one merged manifest, prints a report, and checks that
+ * every input was assembled by exactly one shard.
+ * @param outputPath The path of the merged manifest.
+ * @param paths The paths of the manifests of the shards.
+ * @param count The number of manifests.
+ * @return 0 if every input was covered exactly once and assembled without errors, 1 otherwise.
+ */
+int mergeManifests(const char *outputPath, char *paths[], int count);
+
+#endif /* MANIFEST_H */
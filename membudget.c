@@ -0,0 +1,106 @@
+/*
+ * Checks the allocation budgets of the parser with the counters of 'memory.h' ('make membudget'): parsing an
+ * instruction or a directive allocates nothing, and a label declaration allocates exactly its table entry.
+ * Exits with 1 and names the line if any of them allocates more.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parser.h"
+#include "labels.h"
+#include "memory.h"
+#include "utils.h"
+
+#define BUDGET_REPEATS 1000 /* every line is parsed this many times, so that even a rare allocation shows */
+
+/* A line and the number of allocations of every subsystem it may make when parsed */
+typedef struct budget_case {
+    const char *line;
+    long labels; /* allocations of MEMORY_LABELS */
+} budget_case;
+
+static const budget_case budgetCases[] = {
+    {" mov @r3, @r4\n", 0},
+    {" add -3, @r2\n", 0},
+    {" cmp W, @r1\n", 0},
+    {" mov 5, W\n", 0},
+    {" inc @r1\n", 0},
+    {" jmp W\n", 0},
+    {" prn +5\n", 0},
+    {" rts\n", 0},
+    {" .data 7, -57, 17, 9\n", 0},
+    {" .string \"abcdef\"\n", 0},
+    {" .fill 10, 3\n", 0},
+    {" .space 4\n", 0},
+    {"MAIN: mov @r3, @r4\n", 1},
+    {"STR: .string \"abc\"\n", 1}
+};
+
+/**
+ * Parses a line BUDGET_REPEATS times and checks the allocations it made against its budget.
+ * @param budget The line and its budget.
+ * @param codeImage The code image to parse into.
+ * @param dataImage The data image to parse into.
+ * @return TRUE if the line parsed within its budget, FALSE otherwise.
+ */
+static boolean checkBudget (const budget_case *budget, machine_word codeImage[], machine_word dataImage[]) {
+    labels_tables labels;
+    memory_usage before[NUM_OF_SUBSYSTEMS], after;
+    long allowed;
+    int i, IC, DC;
+    boolean within = TRUE;
+
+    for (i = 0; i < NUM_OF_SUBSYSTEMS; i++)
+        before[i] = getMemoryUsage((memory_subsystem) i);
+    for (i = 0; i < BUDGET_REPEATS; i++) {
+        labels.internal = NULL;
+        labels.external = NULL;
+        labels.exportal = NULL;
+        labels.pooled = NULL;
+        labels.kept = NULL;
+        IC = 0;
+        DC = 0;
+        if (parseLine((char *) budget->line, codeImage, dataImage, &labels, &IC, &DC, 1) == FALSE) {
+            fprintf(stderr, "membudget: the line '%s' does not parse\n", budget->line);
+            return FALSE;
+        }
+        freeTables(labels);
+    }
+
+    for (i = 0; i < NUM_OF_SUBSYSTEMS; i++) {
+        after = getMemoryUsage((memory_subsystem) i);
+        allowed = (i == MEMORY_LABELS) ? budget->labels : 0;
+        if (after.allocations - before[i].allocations > allowed * BUDGET_REPEATS) {
+            fprintf(stderr, "membudget: '%.*s' makes %.2f %s allocations per line, the budget is %ld\n",
+                    (int) strcspn(budget->line, "\n"), budget->line,
+                    (double) (after.allocations - before[i].allocations) / BUDGET_REPEATS, subsystemNames[i], allowed);
+            within = FALSE;
+        }
+        if (after.bytesLive != before[i].bytesLive) {
+            fprintf(stderr, "membudget: '%.*s' leaks %ld bytes of %s\n", (int) strcspn(budget->line, "\n"),
+                    budget->line, after.bytesLive - before[i].bytesLive, subsystemNames[i]);
+            within = FALSE;
+        }
+    }
+    return within;
+}
+
+int main (void) {
+    machine_word *codeImage = malloc(MAX_MEMORY_SPACE * sizeof(machine_word));
+    machine_word *dataImage = malloc(MAX_MEMORY_SPACE * sizeof(machine_word));
+    int i, failed = 0, count = (int) (sizeof(budgetCases) / sizeof(budgetCases[0]));
+
+    if (codeImage == NULL || dataImage == NULL) {
+        fprintf(stderr, "membudget: not enough memory for the images\n");
+        return 1;
+    }
+    for (i = 0; i < count; i++) {
+        if (checkBudget(&budgetCases[i], codeImage, dataImage) == FALSE)
+            failed++;
+    }
+    free(codeImage);
+    free(dataImage);
+    printf("membudget: %d of %d lines within their allocation budget\n", count - failed, count);
+    return (failed > 0) ? 1 : 0;
+}
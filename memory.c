@@ -0,0 +1,245 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "memory.h"
+#include "stats.h"
+#include "utils.h"
+#include "print.h"
+
+/* placed before every allocation to remember its size, aligned for any type */
+typedef union allocation_header {
+    size_t size;
+    long double alignLongDouble;
+    void *alignPointer;
+} allocation_header;
+
+char *subsystemNames[NUM_OF_SUBSYSTEMS] = {
+        "macros",
+        "labels",
+        "filenames",
+        "images",
+        "includes",
+        "sidecars"
+};
+
+boolean memoryReportEnabled = FALSE;
+boolean memoryLockEnabled = FALSE;
+
+static memory_usage usage[NUM_OF_SUBSYSTEMS];
+static memory_usage fileStart[NUM_OF_SUBSYSTEMS]; /* counters when the current file started */
+static long runPeakBytesLive[NUM_OF_SUBSYSTEMS];
+static long phaseRss[NUM_OF_PHASES];
+static pthread_mutex_t usageLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Counts a new allocation against a subsystem.
+ * @param size The number of bytes allocated.
+ * @param subsystem The subsystem that owns the memory.
+ */
+static void countAllocation (size_t size, memory_subsystem subsystem) {
+    if (memoryLockEnabled == TRUE)
+        pthread_mutex_lock(&usageLock);
+    usage[subsystem].allocations++;
+    usage[subsystem].bytesRequested += size;
+    usage[subsystem].bytesLive += size;
+    if (usage[subsystem].bytesLive > usage[subsystem].peakBytesLive)
+        usage[subsystem].peakBytesLive = usage[subsystem].bytesLive;
+    if (usage[subsystem].bytesLive > runPeakBytesLive[subsystem])
+        runPeakBytesLive[subsystem] = usage[subsystem].bytesLive;
+    if (memoryLockEnabled == TRUE)
+        pthread_mutex_unlock(&usageLock);
+}
+
+/**
+ * Prints the counters of every subsystem.
+ * @param current The counters to print.
+ * @param start The counters to subtract (for a single file), or NULL.
+ * @param peaks The peak live bytes of every subsystem.
+ */
+static void printUsage (memory_usage current[], memory_usage start[], long peaks[]) {
+    int i;
+    printMessage("  %-10s %12s %12s %16s %12s %12s\n", "subsystem", "allocations", "frees", "bytes requested", "bytes live", "peak live");
+    for (i = 0; i < NUM_OF_SUBSYSTEMS; i++) {
+        printMessage("  %-10s %12ld %12ld %16ld %12ld %12ld\n", subsystemNames[i],
+                     current[i].allocations - (start ? start[i].allocations : 0),
+                     current[i].frees - (start ? start[i].frees : 0),
+                     current[i].bytesRequested - (start ? start[i].bytesRequested : 0),
+                     current[i].bytesLive, peaks[i]);
+    }
+}
+
+/**
+ * Allocates memory and counts it against a subsystem (like malloc).
+ * @param size The number of bytes to allocate.
+ * @param subsystem The subsystem that owns the memory.
+ * @return A pointer to the memory, or NULL on failure.
+ */
+void *allocateMemory (size_t size, memory_subsystem subsystem) {
+    allocation_header *header = malloc(sizeof(allocation_header) + size);
+    if (header == NULL)
+        return NULL;
+    header->size = size;
+    countAllocation(size, subsystem);
+    return header + 1;
+}
+
+/**
+ * Allocates zeroed memory and counts it against a subsystem (like calloc).
+ * @param count The number of elements.
+ * @param size The size of every element.
+ * @param subsystem The subsystem that owns the memory.
+ * @return A pointer to the memory, or NULL on failure.
+ */
+void *allocateZeroedMemory (size_t count, size_t size, memory_subsystem subsystem) {
+    void *memory;
+    if (size != 0 && count > ((size_t) -1 - sizeof(allocation_header)) / size)
+        return NULL;
+    memory = allocateMemory(count * size, subsystem);
+    if (memory != NULL)
+        memset(memory, 0, count * size);
+    return memory;
+}
+
+/**
+ * Frees memory that was allocated with allocateMemory or allocateZeroedMemory.
+ * @param ptr The memory to free (NULL is ignored).
+ * @param subsystem The subsystem that owns the memory.
+ */
+void freeMemory (void *ptr, memory_subsystem subsystem) {
+    allocation_header *header;
+    if (ptr == NULL)
+        return;
+    header = (allocation_header *) ptr - 1;
+    if (memoryLockEnabled == TRUE)
+        pthread_mutex_lock(&usageLock);
+    usage[subsystem].frees++;
+    usage[subsystem].bytesLive -= header->size;
+    if (memoryLockEnabled == TRUE)
+        pthread_mutex_unlock(&usageLock);
+    free(header);
+}
+
+/**
+ * Returns the allocation counters of a subsystem. Tests use this to assert allocation budgets.
+ * @param subsystem The subsystem.
+ * @return A copy of its counters.
+ */
+memory_usage getMemoryUsage (memory_subsystem subsystem) {
+    return usage[subsystem];
+}
+
+/**
+ * Returns the allocation counters of all the subsystems together.
+ * @return The summed counters.
+ */
+memory_usage getTotalMemoryUsage (void) {
+    memory_usage total;
+    int i;
+    memset(&total, 0, sizeof(total));
+    for (i = 0; i < NUM_OF_SUBSYSTEMS; i++) {
+        total.allocations += usage[i].allocations;
+        total.frees += usage[i].frees;
+        total.bytesRequested += usage[i].bytesRequested;
+        total.bytesLive += usage[i].bytesLive;
+        total.peakBytesLive += usage[i].peakBytesLive;
+    }
+    return total;
+}
+
+/**
+ * Resets the counters of all subsystems (the live bytes are kept).
+ */
+void resetMemoryUsage (void) {
+    int i;
+    for (i = 0; i < NUM_OF_SUBSYSTEMS; i++) {
+        usage[i].allocations = 0;
+        usage[i].frees = 0;
+        usage[i].bytesRequested = 0;
+        usage[i].peakBytesLive = usage[i].bytesLive;
+    }
+}
+
+/**
+ * Reads the peak resident set size of the process.
+ * @return The peak resident set size in kB.
+ */
+long peakRssKb (void) {
+    struct rusage resources;
+    if (getrusage(RUSAGE_SELF, &resources) != 0)
+        return 0;
+    return resources.ru_maxrss;
+}
+
+/**
+ * Reads the current resident set size of the process (from /proc/self/statm, so only on Linux).
+ * @return The resident set size in kB, or 0 if it cannot be read.
+ */
+long currentRssKb (void) {
+    FILE *statm = fopen("/proc/self/statm", "r");
+    long size, resident = 0;
+
+    if (statm == NULL)
+        return 0;
+    if (fscanf(statm, "%ld %ld", &size, &resident) != 2)
+        resident = 0;
+    fclose(statm);
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * Records the resident set size at the end of a phase of the current file. The peak of ru_maxrss would only
+ * tell the high-water mark of the whole run, which after the first big file is the same for every phase.
+ * @param phase The phase that ended.
+ */
+void sampleMemoryPhase (phase_t phase) {
+    phaseRss[phase] = currentRssKb();
+}
+
+/**
+ * Starts counting the allocations of a new file.
+ */
+void memoryBeginFile (void) {
+    int i;
+    for (i = 0; i < NUM_OF_SUBSYSTEMS; i++) {
+        usage[i].peakBytesLive = usage[i].bytesLive;
+        fileStart[i] = usage[i];
+    }
+    for (i = 0; i < NUM_OF_PHASES; i++)
+        phaseRss[i] = 0;
+}
+
+/**
+ * Prints the allocations of the current file and the resident set size after each of its phases.
+ * @param fileName The base name of the file.
+ */
+void memoryEndFile (char *fileName) {
+    long peaks[NUM_OF_SUBSYSTEMS];
+    int i;
+
+    for (i = 0; i < NUM_OF_SUBSYSTEMS; i++)
+        peaks[i] = usage[i].peakBytesLive;
+    printMessage("Memory for file '%s':\n", fileName);
+    printUsage(usage, fileStart, peaks);
+    printMessage("  RSS (kB) after");
+    for (i = 0; i < NUM_OF_PHASES; i++) {
+        if (phaseRss[i] > 0)
+            printMessage(" %s %ld", phaseNames[i], phaseRss[i]);
+    }
+    printMessage("\n");
+}
+
+/**
+ * Prints the allocations of all the files assembled so far.
+ */
+void printMemoryTotal (void) {
+    printMessage("Memory for all files:\n");
+    printUsage(usage, NULL, runPeakBytesLive);
+    printMessage("  peak RSS %ld kB\n", peakRssKb());
+}
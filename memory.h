@@ -0,0 +1,115 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <stddef.h>
+
+#include "utils.h"
+#include "stats.h"
+
+/* Parts of the assembler whose heap allocations are counted separately */
+typedef enum {
+    MEMORY_MACROS, /* macro tables of the preprocessor */
+    MEMORY_LABELS, /* label tables */
+    MEMORY_FILENAMES, /* names of opened files */
+    MEMORY_IMAGES, /* code and data images */
+    MEMORY_INCLUDES, /* included files, cached for the whole run */
+    MEMORY_SIDECARS, /* parsed lines kept between runs by --incremental */
+    NUM_OF_SUBSYSTEMS
+} memory_subsystem;
+
+/* Allocation counters of a single subsystem */
+typedef struct memory_usage {
+    long allocations;
+    long frees;
+    long bytesRequested; /* total bytes ever requested */
+    long bytesLive; /* bytes currently allocated */
+    long peakBytesLive; /* most bytes allocated at the same time */
+} memory_usage;
+
+/* Names of the subsystems, as printed in reports */
+extern char *subsystemNames[NUM_OF_SUBSYSTEMS];
+
+/* TRUE when --memory was given */
+extern boolean memoryReportEnabled;
+
+/* TRUE when several threads allocate at once (like the stages of --pipeline), so the counters are locked */
+extern boolean memoryLockEnabled;
+
+/**
+ * Allocates memory and counts it against a subsystem (like malloc).
+ * @param size The number of bytes to allocate.
+ * @param subsystem The subsystem that owns the memory.
+ * @return A pointer to the memory, or NULL on failure.
+ */
+void *allocateMemory(size_t size, memory_subsystem subsystem);
+
+/**
+ * Allocates zeroed memory and counts it against a subsystem (like calloc).
+ * @param count The number of elements.
+ * @param size The size of every element.
+ * @param subsystem The subsystem that owns the memory.
+ * @return A pointer to the memory, or NULL on failure.
+ */
+void *allocateZeroedMemory(size_t count, size_t size, memory_subsystem subsystem);
+
+/**
+ * Frees memory that was allocated with allocateMemory or allocateZeroedMemory.
+ * @param ptr The memory to free (NULL is ignored).
+ * @param subsystem The subsystem that owns the memory.
+ */
+void freeMemory(void *ptr, memory_subsystem subsystem);
+
+/**
+ * Returns the allocation counters of a subsystem. Tests use this to assert allocation budgets.
+ * @param subsystem The subsystem.
+ * @return A copy of its counters.
+ */
+memory_usage getMemoryUsage(memory_subsystem subsystem);
+
+/**
+ * Returns the allocation counters of all the subsystems together.
+ * @return The summed counters.
+ */
+memory_usage getTotalMemoryUsage(void);
+
+/**
+ * Resets the counters of all subsystems (the live bytes are kept).
+ */
+void resetMemoryUsage(void);
+
+/**
+ * Reads the peak resident set size of the process.
+ * @return The peak resident set size in kB.
+ */
+long peakRssKb(void);
+
+/**
+ * Reads the current resident set size of the process (from /proc/self/statm, so only on Linux).
+ * @return The resident set size in kB, or 0 if it cannot be read.
+ */
+long currentRssKb(void);
+
+/**
+ * Records the resident set size at the end of a phase of the current file. The peak of ru_maxrss would only
+ * tell the high-water mark of the whole run, which after the first big file is the same for every phase.
+ * @param phase The phase that ended.
+ */
+void sampleMemoryPhase(phase_t phase);
+
+/**
+ * Starts counting the allocations of a new file.
+ */
+void memoryBeginFile(void);
+
+/**
+ * Prints the allocations of the current file and the resident set size after each of its phases.
+ * @param fileName The base name of the file.
+ */
+void memoryEndFile(char *fileName);
+
+/**
+ * Prints the allocations of all the files assembled so far.
+ */
+void printMemoryTotal(void);
+
+#endif /* MEMORY_H */
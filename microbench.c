@@ -0,0 +1,442 @@
+/*
+ * Times the hot functions of the assembler one at a time. Some of them (findMacro, machineWordToBase64) are static,
+ * so the files that hold them are compiled into this harness, and the makefile links the rest of the assembler.
+ */
+#include "generateOutput.c"
+#undef _POSIX_C_SOURCE
+#include "preprocessor.c"
+
+#include <time.h>
+
+#define WARMUP_SAMPLES 20
+#define SAMPLES 200
+#define TARGET_SAMPLE_NS 50000.0 /* every sample runs enough operations to take about 50 us */
+#define MAX_SAMPLE_OPERATIONS (1L << 24)
+#define MAX_TABLE_SIZE 4096
+
+/* Runs a number of operations of one case */
+typedef void (*bench_body)(void *context, long operations);
+
+/* A line for getNextToken and parseLine */
+typedef struct line_case {
+    const char *name;
+    const char *line;
+    boolean hasLabel; /* parseLine adds a label, which is removed again after every operation */
+} line_case;
+
+/* A label name for isValidLabel */
+typedef struct label_case {
+    const char *name;
+    char *label;
+    TokenType type;
+} label_case;
+
+/* A label table or macro table of a given size, and the names to look up in it */
+typedef struct table_context {
+    labels_tables labels;
+    macro_table macros;
+    char (*names)[MAX_LABEL_LENGTH + 1];
+    long size;
+    long next; /* the next name to look up */
+    char *missing; /* a name that is not in the table */
+} table_context;
+
+/* A line to parse, and the images and labels it is parsed into */
+typedef struct parse_context {
+    const line_case *lineCase;
+    machine_word *codeImage;
+    machine_word *dataImage;
+    labels_tables labels;
+} parse_context;
+
+/* results of the measured functions go here, so that the compiler cannot drop the calls */
+static volatile long sink;
+
+static const line_case tokenLines[] = {
+    {"label, register, register", "MAIN: mov @r3, @r4\n", TRUE},
+    {"immediate, register", " add -3, @r2\n", FALSE},
+    {"direct", " jmp LOOP\n", FALSE},
+    {".data", " .data 7, -57, 17, 9\n", FALSE},
+    {".string", " .string \"hello world\"\n", FALSE}
+};
+
+static const line_case parseLines[] = {
+    {"register, register", " mov @r3, @r4\n", FALSE},
+    {"immediate, register", " add -3, @r2\n", FALSE},
+    {"direct, register", " cmp W, @r1\n", FALSE},
+    {"immediate, direct", " mov 5, W\n", FALSE},
+    {"register", " inc @r1\n", FALSE},
+    {"direct", " jmp W\n", FALSE},
+    {"immediate", " prn +5\n", FALSE},
+    {"no operands", " rts\n", FALSE},
+    {"label, register, register", "MAIN: mov @r3, @r4\n", TRUE},
+    {".data", " .data 7, -57, 17, 9\n", FALSE},
+    {".string", " .string \"abcdef\"\n", FALSE},
+    {".fill", " .fill 10, 3\n", FALSE}
+};
+
+static const long tableSizes[] = {1, 16, 256, MAX_TABLE_SIZE};
+
+/**
+ * Reads the monotonic clock.
+ * @return The time in nanoseconds since an arbitrary fixed point.
+ */
+static double nowNs (void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/**
+ * Compares two sample times, for sorting.
+ * @param a The first time.
+ * @param b The second time.
+ * @return Negative if a is shorter than b, positive if longer, 0 otherwise.
+ */
+static int compareSamples (const void *a, const void *b) {
+    double first = *(const double *) a, second = *(const double *) b;
+    return (first > second) - (first < second);
+}
+
+/**
+ * Times one case: finds how many operations take about TARGET_SAMPLE_NS, warms up, then takes SAMPLES samples
+ * and writes their median and 99th percentile per operation.
+ * @param results The CSV file of the results.
+ * @param function The name of the measured function.
+ * @param name The name of the case.
+ * @param size The size of the table the case runs on, or 0.
+ * @param body Runs the operations of the case.
+ * @param context The context of body.
+ */
+static void runCase (FILE *results, const char *function, const char *name, long size, bench_body body, void *context) {
+    double samples[SAMPLES], start, elapsed;
+    long operations = 1;
+    int i;
+
+    do {
+        start = nowNs();
+        body(context, operations);
+        elapsed = nowNs() - start;
+        if (elapsed < TARGET_SAMPLE_NS)
+            operations *= 2;
+    } while (elapsed < TARGET_SAMPLE_NS && operations < MAX_SAMPLE_OPERATIONS);
+
+    for (i = 0; i < WARMUP_SAMPLES; i++)
+        body(context, operations);
+    for (i = 0; i < SAMPLES; i++) {
+        start = nowNs();
+        body(context, operations);
+        samples[i] = (nowNs() - start) / operations;
+    }
+    qsort(samples, SAMPLES, sizeof(double), compareSamples);
+
+    fprintf(results, "%s,\"%s\",%ld,%ld,%.2f,%.2f\n", function, name, size, operations,
+            samples[SAMPLES / 2], samples[SAMPLES * 99 / 100]);
+    printf("%-20s %-28s %6ld %10.2f %10.2f\n", function, name, size, samples[SAMPLES / 2], samples[SAMPLES * 99 / 100]);
+}
+
+/**
+ * Tokenizes a whole line per operation.
+ * @param context The line case.
+ * @param operations The number of operations.
+ */
+static void benchGetNextToken (void *context, long operations) {
+    const line_case *lineCase = context;
+    char *line;
+    Token token;
+    long i;
+
+    for (i = 0; i < operations; i++) {
+        line = (char *) lineCase->line;
+        do {
+            token = getNextToken(&line, 1);
+            sink += token.type;
+        } while (token.type != END && token.type != INVALID);
+    }
+}
+
+/**
+ * Checks a label name per operation.
+ * @param context The label case.
+ * @param operations The number of operations.
+ */
+static void benchIsValidLabel (void *context, long operations) {
+    label_case *labelCase = context;
+    long i;
+
+    for (i = 0; i < operations; i++)
+        sink += isValidLabel(labelCase->label, labelCase->type, 1);
+}
+
+/**
+ * Finds a label of the table per operation, going over the table in a fixed scattered order.
+ * @param context The table.
+ * @param operations The number of operations.
+ */
+static void benchFindLabel (void *context, long operations) {
+    table_context *table = context;
+    long i;
+
+    for (i = 0; i < operations; i++) {
+        sink += (findLabel(table->names[table->next], &table->labels, INTERNAL) != NULL);
+        table->next = (table->next + 7919) % table->size;
+    }
+}
+
+/**
+ * Looks up a label that is not in the table per operation, which walks all of it.
+ * @param context The table.
+ * @param operations The number of operations.
+ */
+static void benchFindLabelMissing (void *context, long operations) {
+    table_context *table = context;
+    long i;
+
+    for (i = 0; i < operations; i++)
+        sink += (findLabel(table->missing, &table->labels, INTERNAL) != NULL);
+}
+
+/**
+ * Adds a new label to the table per operation, and removes it again so that the table keeps its size.
+ * @param context The table.
+ * @param operations The number of operations.
+ */
+static void benchAddLabel (void *context, long operations) {
+    table_context *table = context;
+    table_entry *added;
+    int IC = 0, DC = 0;
+    long i;
+
+    for (i = 0; i < operations; i++) {
+        sink += addLabel(table->missing, &table->labels, INTERNAL, FALSE, &IC, &DC, 1);
+        added = table->labels.internal;
+        table->labels.internal = added->next;
+        freeMemory(added, MEMORY_LABELS);
+    }
+}
+
+/**
+ * Finds a macro of the table per operation, going over the table in a fixed scattered order.
+ * @param context The table.
+ * @param operations The number of operations.
+ */
+static void benchFindMacro (void *context, long operations) {
+    table_context *table = context;
+    long i;
+
+    for (i = 0; i < operations; i++) {
+        sink += (findMacro(&table->macros, table->names[table->next]) != NULL);
+        table->next = (table->next + 7919) % table->size;
+    }
+}
+
+/**
+ * Looks up a macro that is not in the table per operation, which is what every line that is not a macro call does.
+ * @param context The table.
+ * @param operations The number of operations.
+ */
+static void benchFindMacroMissing (void *context, long operations) {
+    table_context *table = context;
+    long i;
+
+    for (i = 0; i < operations; i++)
+        sink += (findMacro(&table->macros, table->missing) != NULL);
+}
+
+/**
+ * Encodes a machine word per operation.
+ * @param context The machine word.
+ * @param operations The number of operations.
+ */
+static void benchMachineWordToBase64 (void *context, long operations) {
+    base_64_word result;
+    long i;
+
+    for (i = 0; i < operations; i++) {
+        result = machineWordToBase64(context);
+        sink += result.data[0] + result.data[1];
+    }
+}
+
+/**
+ * Parses a line at the start of empty images per operation.
+ * @param context The parse context.
+ * @param operations The number of operations.
+ */
+static void benchParseLine (void *context, long operations) {
+    parse_context *parse = context;
+    table_entry *added;
+    int IC, DC;
+    long i;
+
+    for (i = 0; i < operations; i++) {
+        IC = 0;
+        DC = 0;
+        sink += parseLine((char *) parse->lineCase->line, parse->codeImage, parse->dataImage, &parse->labels, &IC, &DC, 1);
+        if (parse->lineCase->hasLabel == TRUE) {
+            added = parse->labels.internal;
+            parse->labels.internal = added->next;
+            freeMemory(added, MEMORY_LABELS);
+        }
+    }
+}
+
+/**
+ * Times the label and macro tables at every size in tableSizes, growing a single table of each kind.
+ * @param results The CSV file of the results.
+ * @return TRUE if the tables were built, FALSE if out of memory.
+ */
+static boolean runTableCases (FILE *results) {
+    table_context table;
+    char missing[] = "NOTINTABLE";
+    int IC = 0, DC = 0, i;
+    long count = 0;
+
+    table.names = malloc(MAX_TABLE_SIZE * sizeof(*table.names));
+    if (table.names == NULL)
+        return FALSE;
+    table.labels.internal = NULL;
+    table.labels.external = NULL;
+    table.labels.exportal = NULL;
+    table.labels.pooled = NULL;
+    table.labels.kept = NULL;
+    table.macros.macros = NULL;
+    table.missing = missing;
+
+    for (i = 0; i < (int) (sizeof(tableSizes) / sizeof(tableSizes[0])); i++) {
+        for (; count < tableSizes[i]; count++) {
+            sprintf(table.names[count], "LABEL%ld", count);
+            if (addLabel(table.names[count], &table.labels, INTERNAL, FALSE, &IC, &DC, 1) == FALSE ||
+                addMacro(&table.macros, table.names[count], 0, 0, NULL, 1) == FALSE) {
+                freeTables(table.labels);
+                freeTable(table.macros.macros);
+                free(table.names);
+                return FALSE;
+            }
+        }
+        table.size = count;
+        table.next = 0;
+        runCase(results, "findLabel", "found", count, benchFindLabel, &table);
+        runCase(results, "findLabel", "missing", count, benchFindLabelMissing, &table);
+        runCase(results, "addLabel", "new label", count, benchAddLabel, &table);
+        table.next = 0;
+        runCase(results, "findMacro", "found", count, benchFindMacro, &table);
+        runCase(results, "findMacro", "missing", count, benchFindMacroMissing, &table);
+    }
+    freeTables(table.labels);
+    freeTable(table.macros.macros);
+    free(table.names);
+    return TRUE;
+}
+
+/**
+ * Times parseLine on every line of parseLines, after checking that each of them parses.
+ * @param results The CSV file of the results.
+ * @return TRUE if every line parsed, FALSE otherwise.
+ */
+static boolean runParseCases (FILE *results) {
+    parse_context parse;
+    int i, IC, DC;
+    boolean parsed = TRUE;
+
+    parse.codeImage = malloc(MAX_MEMORY_SPACE * sizeof(machine_word));
+    parse.dataImage = malloc(MAX_MEMORY_SPACE * sizeof(machine_word));
+    parse.labels.internal = NULL;
+    parse.labels.external = NULL;
+    parse.labels.exportal = NULL;
+    parse.labels.pooled = NULL;
+    parse.labels.kept = NULL;
+    if (parse.codeImage == NULL || parse.dataImage == NULL) {
+        free(parse.codeImage);
+        free(parse.dataImage);
+        return FALSE;
+    }
+
+    for (i = 0; i < (int) (sizeof(parseLines) / sizeof(parseLines[0])); i++) {
+        parse.lineCase = &parseLines[i];
+        IC = 0;
+        DC = 0;
+        if (parseLine((char *) parseLines[i].line, parse.codeImage, parse.dataImage, &parse.labels, &IC, &DC, 1) == FALSE) {
+            fprintf(stderr, "microbench: the line '%s' does not parse\n", parseLines[i].name);
+            parsed = FALSE;
+            break;
+        }
+        freeTables(parse.labels);
+        parse.labels.internal = NULL;
+        runCase(results, "parseLine", parseLines[i].name, 0, benchParseLine, &parse);
+    }
+    free(parse.codeImage);
+    free(parse.dataImage);
+    return parsed;
+}
+
+int main (int argc, char *argv[]) {
+    char shortLabel[] = "X:", typicalLabel[] = "LOOP:", usedLabel[] = "LOOP";
+    char longLabel[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcd:";
+    label_case labelCases[4];
+    machine_word words[5];
+    const char *wordNames[] = {"first word", "immediate or direct", "data", "registers", "run of data"};
+    FILE *results;
+    int i;
+    boolean failed = FALSE;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: microbench <results.csv>\n");
+        return 1;
+    }
+    results = fopen(argv[1], "w");
+    if (results == NULL) {
+        fprintf(stderr, "microbench: cannot write '%s'\n", argv[1]);
+        return 1;
+    }
+    fprintf(results, "function,case,table_size,operations_per_sample,median_ns_per_op,p99_ns_per_op\n");
+    printf("%-20s %-28s %6s %10s %10s\n", "function", "case", "size", "median ns", "p99 ns");
+
+    for (i = 0; i < (int) (sizeof(tokenLines) / sizeof(tokenLines[0])); i++)
+        runCase(results, "getNextToken", tokenLines[i].name, 0, benchGetNextToken, (void *) &tokenLines[i]);
+
+    labelCases[0].name = "short declaration";
+    labelCases[0].label = shortLabel;
+    labelCases[0].type = LABEL_DECLARATION;
+    labelCases[1].name = "declaration";
+    labelCases[1].label = typicalLabel;
+    labelCases[1].type = LABEL_DECLARATION;
+    labelCases[2].name = "longest declaration";
+    labelCases[2].label = longLabel;
+    labelCases[2].type = LABEL_DECLARATION;
+    labelCases[3].name = "operand";
+    labelCases[3].label = usedLabel;
+    labelCases[3].type = LABEL;
+    for (i = 0; i < 4; i++)
+        runCase(results, "isValidLabel", labelCases[i].name, 0, benchIsValidLabel, &labelCases[i]);
+
+    if (runTableCases(results) == FALSE) {
+        fprintf(stderr, "microbench: not enough memory for the tables\n");
+        failed = TRUE;
+    }
+
+    memset(words, 0, sizeof(words));
+    words[0].type = WORD_TYPE_FIRST;
+    words[0].word.first_word.op_code = 2;
+    words[0].word.first_word.src_am = 1;
+    words[0].word.first_word.dst_am = 5;
+    words[1].type = WORD_TYPE_IMMDT_DRCT;
+    words[1].word.immdt_drct_word.operand = 117;
+    words[1].word.immdt_drct_word.ARE = ARE_RELOCATABLE;
+    words[2].type = WORD_TYPE_DATA;
+    words[2].word.data_word.data = 4039;
+    words[3].type = WORD_TYPE_REGISTER;
+    words[3].word.register_word.src = 3;
+    words[3].word.register_word.dest = 4;
+    words[4].type = WORD_TYPE_FILL;
+    words[4].word.fill_word.data = 3;
+    words[4].word.fill_word.count = 10;
+    for (i = 0; i < 5; i++)
+        runCase(results, "machineWordToBase64", wordNames[i], 0, benchMachineWordToBase64, &words[i]);
+
+    if (runParseCases(results) == FALSE)
+        failed = TRUE;
+
+    fclose(results);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "objfile.h"
+#include "utils.h"
+
+static const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/**
+ * Decodes a single base 64 character.
+ * @param c The character.
+ * @return Its 6-bit value, or -1 if it is not base 64.
+ */
+static int base64Value (char c) {
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    return -1;
+}
+
+/**
+ * Decodes two base 64 characters into a 12-bit word.
+ * @param chars The two characters.
+ * @return The word, or -1 if a character is not base 64.
+ */
+int base64ToWord (const char *chars) {
+    int high = base64Value(chars[0]);
+    int low = base64Value(chars[1]);
+    if (high < 0 || low < 0)
+        return -1;
+    return (high << 6) | low;
+}
+
+/**
+ * Encodes a 12-bit word as two base 64 characters.
+ * @param word The word.
+ * @param chars Receives the two characters.
+ */
+void wordToBase64 (unsigned int word, char *chars) {
+    chars[0] = base64Chars[(word >> 6) & 0x3F];
+    chars[1] = base64Chars[word & 0x3F];
+}
+
+/**
+ * Reads a whole '.obj' file.
+ * @param file The file to read.
+ * @param object Receives the words, which must be freed with freeObjectFile.
+ * @return TRUE if the file is a valid '.obj' file, FALSE otherwise.
+ */
+boolean readObjectFile (FILE *file, object_file *object) {
+    char chars[BASE64_WORD_LENGTH + 1];
+    int i, word;
+
+    object->words = NULL;
+    if (fscanf(file, "%d %d", &object->IC, &object->DC) != 2 || object->IC < 0 || object->DC < 0 ||
+        object->IC + object->DC > MAX_MEMORY_SPACE) {
+        object->IC = object->DC = 0;
+        return FALSE;
+    }
+    object->words = malloc((object->IC + object->DC + 1) * sizeof(unsigned short));
+    if (object->words == NULL) {
+        object->IC = object->DC = 0;
+        return FALSE;
+    }
+    for (i = 0; i < object->IC + object->DC; i++) {
+        if (fscanf(file, "%2s", chars) != 1 || strlen(chars) != BASE64_WORD_LENGTH ||
+            (word = base64ToWord(chars)) < 0) {
+            freeObjectFile(object);
+            object->IC = object->DC = 0;
+            return FALSE;
+        }
+        object->words[i] = (unsigned short) word;
+    }
+    return TRUE;
+}
+
+/**
+ * Writes a '.obj' file.
+ * @param file The file to write to.
+ * @param object The words to write.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeObjectFile (FILE *file, object_file *object) {
+    char chars[BASE64_WORD_LENGTH];
+    int i;
+
+    fprintf(file, "%d %d\n", object->IC, object->DC);
+    for (i = 0; i < object->IC + object->DC; i++) {
+        wordToBase64(object->words[i], chars);
+        fprintf(file, "%c%c\n", chars[0], chars[1]);
+    }
+    return (ferror(file) == 0);
+}
+
+/**
+ * Frees the words of an object file.
+ * @param object The object file.
+ */
+void freeObjectFile (object_file *object) {
+    free(object->words);
+    object->words = NULL;
+}
+
+/**
+ * Reads the next line of a '.ent' or '.ext' file.
+ * @param file The file to read.
+ * @param name Receives the label name, at least MAX_LABEL_LENGTH + 1 characters long.
+ * @param address Receives the address on the line.
+ * @return TRUE if a line was read, FALSE at the end of the file or on a malformed line.
+ */
+boolean readSymbolLine (FILE *file, char *name, int *address) {
+    return (fscanf(file, "%31s %d", name, address) == 2);
+}
+
+/**
+ * Reads the base address a module was assembled at from the first line of its '.rel' file.
+ * @param file The '.rel' file, or NULL if the module has none (it was assembled at BASE_ADDRESS).
+ * @param base Receives the base address.
+ * @return TRUE if the base was read, FALSE on a malformed file or a base outside memory.
+ */
+boolean readModuleBase (FILE *file, int *base) {
+    *base = BASE_ADDRESS;
+    if (file == NULL)
+        return TRUE;
+    return (fscanf(file, "%d", base) == 1 && *base >= 0 && *base <= MAX_ADDRESS);
+}
@@ -0,0 +1,84 @@
+#ifndef OBJFILE_H
+#define OBJFILE_H
+
+#include <stdio.h>
+
+#include "utils.h"
+
+#define BASE64_WORD_LENGTH 2
+
+/* Fields of an encoded 12-bit word with direct addressing */
+#define WORD_ARE(word) ((word) & 0x3)
+#define WORD_OPERAND(word) (((word) >> 2) & 0x3FF)
+#define MAKE_OPERAND_WORD(operand, ARE) ((((operand) & 0x3FF) << 2) | ((ARE) & 0x3))
+
+/* Fields of an encoded first word */
+#define WORD_SRC_AM(word) (((word) >> 9) & 0x7)
+#define WORD_OP_CODE(word) (((word) >> 5) & 0xF)
+#define WORD_DST_AM(word) (((word) >> 2) & 0x7)
+
+/* Fields of an encoded register word */
+#define WORD_SRC_REGISTER(word) (((word) >> 7) & 0x1F)
+#define WORD_DST_REGISTER(word) (((word) >> 2) & 0x1F)
+
+/* The contents of a '.obj' file: the code words followed by the data words, as 12-bit values */
+typedef struct object_file {
+    int IC;
+    int DC;
+    unsigned short *words;
+} object_file;
+
+/**
+ * Decodes two base 64 characters into a 12-bit word.
+ * @param chars The two characters.
+ * @return The word, or -1 if a character is not base 64.
+ */
+int base64ToWord(const char *chars);
+
+/**
+ * Encodes a 12-bit word as two base 64 characters.
+ * @param word The word.
+ * @param chars Receives the two characters.
+ */
+void wordToBase64(unsigned int word, char *chars);
+
+/**
+ * Reads a whole '.obj' file.
+ * @param file The file to read.
+ * @param object Receives the words, which must be freed with freeObjectFile.
+ * @return TRUE if the file is a valid '.obj' file, FALSE otherwise.
+ */
+boolean readObjectFile(FILE *file, object_file *object);
+
+/**
+ * Writes a '.obj' file.
+ * @param file The file to write to.
+ * @param object The words to write.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+boolean writeObjectFile(FILE *file, object_file *object);
+
+/**
+ * Frees the words of an object file.
+ * @param object The object file.
+ */
+void freeObjectFile(object_file *object);
+
+/**
+ * Reads the next line of a '.ent' or '.ext' file.
+ * @param file The file to read.
+ * @param name Receives the label name, at least MAX_LABEL_LENGTH + 1 characters long.
+ * @param address Receives the address on the line.
+ * @return TRUE if a line was read, FALSE at the end of the file or on a malformed line.
+ */
+boolean readSymbolLine(FILE *file, char *name, int *address);
+
+/**
+ * Reads the base address a module was assembled at from the first line of its '.rel' file.
+ * @param file The '.rel' file, or NULL if the module has none (it was assembled at BASE_ADDRESS).
+ * @param base Receives the base address.
+ * @return TRUE if the base was read, FALSE on a malformed file or a base outside memory.
+ */
+boolean readModuleBase(FILE *file, int *base);
+
+#endif /* OBJFILE_H */
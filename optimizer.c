@@ -0,0 +1,528 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "optimizer.h"
+#include "labels.h"
+#include "hash.h"
+#include "memory.h"
+#include "print.h"
+#include "utils.h"
+
+/* opcodes used by the rules, the location in instructions[] */
+#define OPCODE_MOV 0
+#define OPCODE_JMP 9
+#define OPCODE_BNE 10
+#define OPCODE_JSR 13
+#define OPCODE_RTS 14
+#define OPCODE_STOP 15
+
+boolean optimizeEnabled = FALSE;
+boolean poolEnabled = FALSE;
+boolean deadStripEnabled = FALSE;
+
+/**
+ * Marks a run of words for removal.
+ * @param removed The removal marks of the image.
+ * @param start The index of the first word.
+ * @param length The number of words.
+ */
+static void markRemoved (boolean removed[], int start, int length) {
+    int i;
+    for (i = start; i < start + length; i++)
+        removed[i] = TRUE;
+}
+
+/**
+ * Removes the marked words from an image and moves the rest down.
+ * @param image The code or data image.
+ * @param count Pointer to the number of words in the image, which is reduced by the words removed.
+ * @param removed The removal marks of the image.
+ * @param newAddress Receives the new address of every old address (up to and including the old count),
+ *                   a removed word gets the address of the next word that is kept.
+ * @return The number of words removed.
+ */
+static int compactImage (machine_word image[], int *count, boolean removed[], int newAddress[]) {
+    int i, kept = 0, dropped;
+    for (i = 0; i < *count; i++) {
+        newAddress[i] = kept;
+        if (removed[i] == FALSE)
+            image[kept++] = image[i];
+    }
+    newAddress[*count] = kept;
+    dropped = *count - kept;
+    *count = kept;
+    return dropped;
+}
+
+/**
+ * Moves the code labels or the data labels to their addresses after the image was compacted.
+ * @param labels Pointer to the various label tabels.
+ * @param isData TRUE to move the data labels, FALSE to move the code labels.
+ * @param newAddress The new address of every old address, from compactImage.
+ * @param oldCount The number of words in the image before it was compacted.
+ */
+static void moveLabels (labels_tables *labels, boolean isData, int newAddress[], int oldCount) {
+    table_entry *entry;
+    for (entry = labels->internal; entry != NULL; entry = entry->next)
+        if (entry->label.isData == isData && entry->label.address <= oldCount)
+            entry->label.address = newAddress[entry->label.address];
+}
+
+/**
+ * Returns the number of words of the instruction that starts with a first word.
+ * @param first The first word of the instruction.
+ * @return The size of the instruction in words.
+ */
+static int instructionSize (machine_word *first) {
+    int opcode = first->word.first_word.op_code;
+    if (opcode <= 3 || opcode == 6) /* two operands */
+        return (first->word.first_word.src_am == ADDRESSING_MODE_REGISTER &&
+                first->word.first_word.dst_am == ADDRESSING_MODE_REGISTER) ? 2 : 3;
+    if (opcode >= OPCODE_RTS) /* no operands */
+        return 1;
+    return 2;
+}
+
+/**
+ * Checks if an instruction is a jump whose target is only known at run time.
+ * @param first The first word of the instruction.
+ * @return TRUE for 'jmp', 'bne' or 'jsr' through a register, FALSE otherwise.
+ */
+static boolean isRegisterJump (machine_word *first) {
+    int opcode = first->word.first_word.op_code;
+    return ((opcode == OPCODE_JMP || opcode == OPCODE_BNE || opcode == OPCODE_JSR) &&
+            first->word.first_word.dst_am == ADDRESSING_MODE_REGISTER);
+}
+
+/**
+ * Checks if an instruction is a 'mov' of an operand to itself.
+ * @param codeImage The code image.
+ * @param i The index of the first word of the instruction.
+ * @return TRUE if the instruction does nothing, FALSE otherwise.
+ */
+static boolean isNoOpMove (machine_word codeImage[], int i) {
+    first_word *first = &codeImage[i].word.first_word;
+    if (first->op_code != OPCODE_MOV)
+        return FALSE;
+    if (first->src_am == ADDRESSING_MODE_REGISTER && first->dst_am == ADDRESSING_MODE_REGISTER)
+        return (codeImage[i + 1].word.register_word.src == codeImage[i + 1].word.register_word.dest);
+    if (first->src_am == ADDRESSING_MODE_DIRECT && first->dst_am == ADDRESSING_MODE_DIRECT)
+        return (strcmp(codeImage[i + 1].labelName, codeImage[i + 2].labelName) == 0);
+    return FALSE;
+}
+
+/**
+ * Checks if an instruction is a 'jmp' or 'bne' to the instruction right after it.
+ * @param codeImage The code image.
+ * @param i The index of the first word of the instruction.
+ * @param size The size of the instruction.
+ * @param labels Pointer to the various label tabels.
+ * @return TRUE if the jump goes where execution would continue anyway, FALSE otherwise.
+ */
+static boolean isJumpToNext (machine_word codeImage[], int i, int size, labels_tables *labels) {
+    first_word *first = &codeImage[i].word.first_word;
+    table_entry *target;
+
+    if ((first->op_code != OPCODE_JMP && first->op_code != OPCODE_BNE) || first->dst_am != ADDRESSING_MODE_DIRECT)
+        return FALSE;
+    target = findLabel(codeImage[i + 1].labelName, labels, INTERNAL);
+    return (target != NULL && target->label.isData == FALSE && target->label.address == i + size);
+}
+
+/**
+ * Runs the rules once over the code image and removes the words they mark.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param IC Pointer to the instruction counter.
+ * @param labels Pointer to the various label tabels.
+ * @param report Receives the number of words removed by every rule.
+ * @return The number of words removed.
+ */
+static int peepholePass (machine_word codeImage[], int *IC, labels_tables *labels, peephole_report *report) {
+    static boolean removed[MAX_MEMORY_SPACE];
+    static boolean labeled[MAX_MEMORY_SPACE];
+    static int newAddress[MAX_MEMORY_SPACE + 1];
+    table_entry *entry;
+    boolean unreachable = FALSE, registerJumps = FALSE;
+    int i, size, oldIC;
+
+    memset(removed, 0, sizeof(removed));
+    memset(labeled, 0, sizeof(labeled));
+    for (entry = labels->internal; entry != NULL; entry = entry->next)
+        if (entry->label.isData == FALSE && entry->label.address < *IC)
+            labeled[entry->label.address] = TRUE;
+    for (i = 0; i < *IC; i += instructionSize(&codeImage[i]))
+        registerJumps |= isRegisterJump(&codeImage[i]);
+
+    for (i = 0; i < *IC; i += size) {
+        size = instructionSize(&codeImage[i]);
+        if (labeled[i] == TRUE) /* a label can be jumped to, so the code after it is reachable again */
+            unreachable = FALSE;
+
+        if (unreachable == TRUE && registerJumps == FALSE) {
+            /* a jump through a register could land anywhere, so nothing is provably dead then */
+            markRemoved(removed, i, size);
+            report->deadWords += size;
+            continue;
+        }
+        /* the last instruction stays, so that no label is left pointing past the code */
+        if (i + size < *IC) {
+            if (isNoOpMove(codeImage, i) == TRUE) {
+                markRemoved(removed, i, size);
+                report->noOpMoves += size;
+                continue;
+            }
+            if (isJumpToNext(codeImage, i, size, labels) == TRUE) {
+                markRemoved(removed, i, size);
+                report->jumpsToNext += size;
+                continue;
+            }
+        }
+        switch (codeImage[i].word.first_word.op_code) {
+            case OPCODE_JMP:
+            case OPCODE_RTS:
+            case OPCODE_STOP:
+                unreachable = TRUE;
+        }
+    }
+
+    /* move every code label to where its instruction (or the next kept one) went */
+    oldIC = *IC;
+    size = compactImage(codeImage, IC, removed, newAddress);
+    moveLabels(labels, FALSE, newAddress, oldIC);
+    return size;
+}
+
+/**
+ * Removes no-op and unreachable instructions from the code image, compacts it and moves the code labels.
+ * Runs after parsing and before relocation, while label words still hold label names.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param IC Pointer to the instruction counter, which is reduced by the words removed.
+ * @param labels Pointer to the various label tabels.
+ * @param report Receives the number of words removed by every rule.
+ * @return The number of words removed.
+ */
+int peepholeOptimize (machine_word codeImage[], int *IC, labels_tables *labels, peephole_report *report) {
+    int saved = 0, pass;
+
+    memset(report, 0, sizeof(peephole_report));
+    /* removing code can make a jump go to the next instruction, so repeat until nothing changes */
+    do {
+        pass = peepholePass(codeImage, IC, labels, report);
+        saved += pass;
+    } while (pass > 0);
+    return saved;
+}
+
+/* A run of data words that starts at a data label */
+typedef struct data_block {
+    table_entry *entry; /* the label at the start of the block */
+    int start; /* the address of the block in the data image, before pooling */
+    int length;
+    boolean pooled; /* the label was marked with '.pool' */
+    struct data_block *copy; /* the identical earlier block the label moves to, NULL if kept */
+} data_block;
+
+/**
+ * Compares two data blocks by their address, for qsort.
+ * @param a Pointer to the first block.
+ * @param b Pointer to the second block.
+ * @return Negative, zero or positive like strcmp.
+ */
+static int compareBlocks (const void *a, const void *b) {
+    return ((const data_block *) a)->start - ((const data_block *) b)->start;
+}
+
+/**
+ * Reads the values of the words of a data block, expanding the runs of '.space' and '.fill'.
+ * @param dataImage The data image.
+ * @param block The data block.
+ * @param values Receives the values (room for the length of the block).
+ */
+static void readBlock (machine_word dataImage[], data_block *block, unsigned short values[]) {
+    int i, count;
+    unsigned short value;
+    machine_word *word;
+    for (i = 0; i < block->length; ) {
+        word = &dataImage[block->start + i];
+        count = (word->type == WORD_TYPE_FILL) ? (int) word->word.fill_word.count : 1;
+        value = (word->type == WORD_TYPE_FILL) ? word->word.fill_word.data : word->word.data_word.data;
+        for (; count > 0; count--)
+            values[i++] = value;
+    }
+}
+
+/**
+ * Returns the hash of the words of a data block.
+ * @param dataImage The data image.
+ * @param block The data block.
+ * @return The hash.
+ */
+static unsigned long hashBlock (machine_word dataImage[], data_block *block) {
+    static unsigned short values[MAX_MEMORY_SPACE];
+    readBlock(dataImage, block, values);
+    return hashBytes(values, block->length * sizeof(unsigned short));
+}
+
+/**
+ * Checks if two data blocks hold the same words.
+ * @param dataImage The data image.
+ * @param a The first data block.
+ * @param b The second data block.
+ * @return TRUE if the blocks are identical, FALSE otherwise.
+ */
+static boolean sameBlocks (machine_word dataImage[], data_block *a, data_block *b) {
+    static unsigned short first[MAX_MEMORY_SPACE], second[MAX_MEMORY_SPACE];
+    if (a->length != b->length)
+        return FALSE;
+    readBlock(dataImage, a, first);
+    readBlock(dataImage, b, second);
+    return (memcmp(first, second, a->length * sizeof(unsigned short)) == 0);
+}
+
+/**
+ * Moves every '.pool' label whose data is identical to that of an earlier '.pool' label onto the earlier copy,
+ * and removes its own copy from the data image. The data of a label runs up to the next data label.
+ * Runs after the labels are checked and before relocation.
+ * @param dataImage Array that stores the machine words for data.
+ * @param DC Pointer to the data counter, which is reduced by the words removed.
+ * @param labels Pointer to the various label tabels.
+ * @param report Receives the number of labels moved and words removed.
+ * @return TRUE if the data was pooled, FALSE if out of memory (the data is left unchanged).
+ */
+boolean poolData (machine_word dataImage[], int *DC, labels_tables *labels, pool_report *report) {
+    static boolean removed[MAX_MEMORY_SPACE];
+    static int newAddress[MAX_MEMORY_SPACE + 1];
+    data_block *blocks, **slots, *block;
+    table_entry *entry;
+    int count = 0, capacity = 1, i;
+    unsigned long slot;
+
+    memset(report, 0, sizeof(pool_report));
+    for (entry = labels->internal; entry != NULL; entry = entry->next)
+        count += entry->label.isData;
+    if (count == 0 || labels->pooled == NULL)
+        return TRUE;
+    while (capacity < 2 * count)
+        capacity *= 2;
+    blocks = allocateZeroedMemory(count, sizeof(data_block), MEMORY_LABELS);
+    slots = allocateZeroedMemory(capacity, sizeof(data_block *), MEMORY_LABELS);
+    if (blocks == NULL || slots == NULL) {
+        freeMemory(blocks, MEMORY_LABELS);
+        freeMemory(slots, MEMORY_LABELS);
+        return FALSE;
+    }
+
+    /* a block runs from its label to the next data label, so unlabeled data after a label stays with it */
+    count = 0;
+    for (entry = labels->internal; entry != NULL; entry = entry->next) {
+        if (entry->label.isData == FALSE)
+            continue;
+        blocks[count].entry = entry;
+        blocks[count].start = entry->label.address;
+        blocks[count].pooled = (findLabel(entry->label.name, labels, POOLED) != NULL);
+        count++;
+    }
+    qsort(blocks, count, sizeof(data_block), compareBlocks);
+    for (i = 0; i < count; i++)
+        blocks[i].length = ((i + 1 < count) ? blocks[i + 1].start : *DC) - blocks[i].start;
+
+    /* only '.pool' labels are shared, and only with each other, so data that the program changes stays its own */
+    memset(removed, 0, sizeof(removed));
+    for (i = 0; i < count; i++) {
+        block = &blocks[i];
+        /* the label of an empty block (like one whose data '--dead-strip' removed) has nothing to share */
+        if (block->pooled == FALSE || block->length == 0)
+            continue;
+        for (slot = hashBlock(dataImage, block) & (capacity - 1); slots[slot] != NULL; slot = (slot + 1) & (capacity - 1))
+            if (sameBlocks(dataImage, slots[slot], block) == TRUE)
+                break;
+        if (slots[slot] == NULL) {
+            slots[slot] = block;
+        } else {
+            block->copy = slots[slot];
+            markRemoved(removed, block->start, block->length);
+            report->pooledLabels++;
+            report->wordsSaved += block->length;
+        }
+    }
+
+    /* move every data label to its new address, or to the address of its copy */
+    compactImage(dataImage, DC, removed, newAddress);
+    for (i = 0; i < count; i++) {
+        block = &blocks[i];
+        block->entry->label.address = newAddress[(block->copy != NULL) ? block->copy->start : block->start];
+    }
+
+    freeMemory(blocks, MEMORY_LABELS);
+    freeMemory(slots, MEMORY_LABELS);
+    return TRUE;
+}
+
+/* A run of code or data words that starts at a label, or at the start of the image */
+typedef struct region {
+    table_entry *entry; /* the label at the start of the region, NULL for the start of the image */
+    int start;
+    int length;
+    boolean isData;
+    boolean reachable;
+} region;
+
+/**
+ * Compares two regions by image and then by address, for qsort and bsearch.
+ * @param a Pointer to the first region.
+ * @param b Pointer to the second region.
+ * @return Negative, zero or positive like strcmp.
+ */
+static int compareRegions (const void *a, const void *b) {
+    const region *first = a, *second = b;
+    if (first->isData != second->isData)
+        return (int) first->isData - (int) second->isData;
+    return first->start - second->start;
+}
+
+/**
+ * Marks the region of an internal label as reachable, and pushes it on the work stack the first time.
+ * @param name The name of the label.
+ * @param labels Pointer to the various label tabels.
+ * @param regions The regions, sorted by compareRegions.
+ * @param count The number of regions.
+ * @param stack The work stack.
+ * @param top Pointer to the number of regions on the stack.
+ */
+static void reachLabel (char *name, labels_tables *labels, region regions[], int count, region *stack[], int *top) {
+    table_entry *entry = findLabel(name, labels, INTERNAL);
+    region key, *found;
+
+    if (entry == NULL) /* an external label */
+        return;
+    key.isData = entry->label.isData;
+    key.start = entry->label.address;
+    found = bsearch(&key, regions, count, sizeof(region), compareRegions);
+    if (found != NULL && found->reachable == FALSE) {
+        found->reachable = TRUE;
+        stack[(*top)++] = found;
+    }
+}
+
+/**
+ * Removes the code and data that cannot be reached from the start of the code, the '.entry' labels and the
+ * '.keep' labels, through the labels that the code uses and the code that runs on into the next label.
+ * Every label starts a region that runs up to the next label of the same image. The removed labels are
+ * printed, and the images are compacted and the labels moved. Runs after the labels are checked and before relocation.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param dataImage Array that stores the machine words for data.
+ * @param IC Pointer to the instruction counter, which is reduced by the words removed.
+ * @param DC Pointer to the data counter, which is reduced by the words removed.
+ * @param labels Pointer to the various label tabels.
+ * @param report Receives the number of labels and words removed.
+ * @return TRUE if the unreachable regions were removed, FALSE if out of memory (the images are left unchanged).
+ */
+boolean removeUnreachable (machine_word codeImage[], machine_word dataImage[], int *IC, int *DC, labels_tables *labels, dead_report *report) {
+    static boolean removedCode[MAX_MEMORY_SPACE], removedData[MAX_MEMORY_SPACE];
+    static int newAddress[MAX_MEMORY_SPACE + 1];
+    region *regions, **stack, *current;
+    table_entry *entry;
+    boolean registerJumps = FALSE, codeAtStart, dataAtStart;
+    int count = 0, top = 0, i, last, oldCount;
+
+    memset(report, 0, sizeof(dead_report));
+    for (entry = labels->internal; entry != NULL; entry = entry->next)
+        count++;
+    regions = allocateZeroedMemory(count + 2, sizeof(region), MEMORY_LABELS);
+    stack = allocateMemory((count + 2) * sizeof(region *), MEMORY_LABELS);
+    if (regions == NULL || stack == NULL) {
+        freeMemory(regions, MEMORY_LABELS);
+        freeMemory(stack, MEMORY_LABELS);
+        return FALSE;
+    }
+
+    /* the words before the first label of an image are a region without a label */
+    count = 0;
+    codeAtStart = dataAtStart = FALSE;
+    for (entry = labels->internal; entry != NULL; entry = entry->next) {
+        regions[count].entry = entry;
+        regions[count].start = entry->label.address;
+        regions[count].isData = entry->label.isData;
+        if (entry->label.address == 0) {
+            codeAtStart |= (entry->label.isData == FALSE);
+            dataAtStart |= entry->label.isData;
+        }
+        count++;
+    }
+    if (codeAtStart == FALSE)
+        regions[count++].isData = FALSE;
+    if (dataAtStart == FALSE)
+        regions[count++].isData = TRUE;
+    qsort(regions, count, sizeof(region), compareRegions);
+    for (i = 0; i < count; i++) {
+        if (i + 1 < count && regions[i + 1].isData == regions[i].isData)
+            regions[i].length = regions[i + 1].start - regions[i].start;
+        else
+            regions[i].length = (regions[i].isData ? *DC : *IC) - regions[i].start;
+    }
+
+    /* the roots - a jump through a register could land anywhere, so then all of the code is a root */
+    for (i = 0; i < *IC; i += instructionSize(&codeImage[i]))
+        registerJumps |= isRegisterJump(&codeImage[i]);
+    for (i = 0; i < count; i++) {
+        if ((regions[i].start == 0 && regions[i].isData == FALSE) || (regions[i].entry == NULL && regions[i].isData) ||
+            (registerJumps == TRUE && regions[i].isData == FALSE)) {
+            regions[i].reachable = TRUE;
+            stack[top++] = &regions[i];
+        }
+    }
+    for (entry = labels->exportal; entry != NULL; entry = entry->next)
+        reachLabel(entry->label.name, labels, regions, count, stack, &top);
+    for (entry = labels->kept; entry != NULL; entry = entry->next)
+        reachLabel(entry->label.name, labels, regions, count, stack, &top);
+
+    /* follow the labels used by the reachable code, and the code that runs on into the next region */
+    while (top > 0) {
+        current = stack[--top];
+        if (current->isData == TRUE || current->length == 0)
+            continue;
+        for (i = current->start; i < current->start + current->length; i++)
+            if (codeImage[i].isLabel == TRUE)
+                reachLabel(codeImage[i].labelName, labels, regions, count, stack, &top);
+        for (i = last = current->start; i < current->start + current->length; i += instructionSize(&codeImage[i]))
+            last = i;
+        switch (codeImage[last].word.first_word.op_code) {
+            case OPCODE_JMP:
+            case OPCODE_RTS:
+            case OPCODE_STOP:
+                break;
+            default:
+                if (current + 1 < regions + count && current[1].isData == FALSE && current[1].reachable == FALSE) {
+                    current[1].reachable = TRUE;
+                    stack[top++] = &current[1];
+                }
+        }
+    }
+
+    memset(removedCode, 0, sizeof(removedCode));
+    memset(removedData, 0, sizeof(removedData));
+    for (i = 0; i < count; i++) {
+        if (regions[i].reachable == TRUE)
+            continue;
+        markRemoved(regions[i].isData ? removedData : removedCode, regions[i].start, regions[i].length);
+        printMessage("  removed %s label '%s' (%d words)\n", regions[i].isData ? "data" : "code",
+                     regions[i].entry->label.name, regions[i].length);
+        report->labels++;
+        if (regions[i].isData)
+            report->dataWords += regions[i].length;
+        else
+            report->codeWords += regions[i].length;
+    }
+
+    oldCount = *IC;
+    compactImage(codeImage, IC, removedCode, newAddress);
+    moveLabels(labels, FALSE, newAddress, oldCount);
+    oldCount = *DC;
+    compactImage(dataImage, DC, removedData, newAddress);
+    moveLabels(labels, TRUE, newAddress, oldCount);
+
+    freeMemory(regions, MEMORY_LABELS);
+    freeMemory(stack, MEMORY_LABELS);
+    return TRUE;
+}
@@ -0,0 +1,73 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include "utils.h"
+
+/* TRUE when --optimize was given */
+extern boolean optimizeEnabled;
+
+/* TRUE when --pool was given */
+extern boolean poolEnabled;
+
+/* TRUE when --dead-strip was given */
+extern boolean deadStripEnabled;
+
+/* Words removed from the code image of a file by the peephole pass */
+typedef struct peephole_report {
+    int noOpMoves; /* 'mov' of an operand to itself */
+    int jumpsToNext; /* 'jmp' or 'bne' to the instruction right after it */
+    int deadWords; /* unlabeled code after 'jmp', 'rts' or 'stop' */
+} peephole_report;
+
+/* Data shared between identical '.pool' labels */
+typedef struct pool_report {
+    int pooledLabels; /* labels that were moved onto an identical earlier copy */
+    int wordsSaved; /* data words those labels no longer take */
+} pool_report;
+
+/* Code and data removed because nothing reaches them */
+typedef struct dead_report {
+    int labels; /* labels whose regions were removed */
+    int codeWords;
+    int dataWords;
+} dead_report;
+
+/**
+ * Removes no-op and unreachable instructions from the code image, compacts it and moves the code labels.
+ * Runs after parsing and before relocation, while label words still hold label names.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param IC Pointer to the instruction counter, which is reduced by the words removed.
+ * @param labels Pointer to the various label tabels.
+ * @param report Receives the number of words removed by every rule.
+ * @return The number of words removed.
+ */
+int peepholeOptimize(machine_word codeImage[], int *IC, labels_tables *labels, peephole_report *report);
+
+/**
+ * Moves every '.pool' label whose data is identical to that of an earlier '.pool' label onto the earlier copy,
+ * and removes its own copy from the data image. The data of a label runs up to the next data label.
+ * Runs after the labels are checked and before relocation.
+ * @param dataImage Array that stores the machine words for data.
+ * @param DC Pointer to the data counter, which is reduced by the words removed.
+ * @param labels Pointer to the various label tabels.
+ * @param report Receives the number of labels moved and words removed.
+ * @return TRUE if the data was pooled, FALSE if out of memory (the data is left unchanged).
+ */
+boolean poolData(machine_word dataImage[], int *DC, labels_tables *labels, pool_report *report);
+
+/**
+ * Removes the code and data that cannot be reached from the start of the code, the '.entry' labels and the
+ * '.keep' labels, through the labels that the code uses and the code that runs on into the next label.
+ * Every label starts a region that runs up to the next label of the same image. The removed labels are
+ * printed, and the images are compacted and the labels moved. Runs after the labels are checked and before relocation.
+ * @param codeImage Array that stores the machine words for instructions.
+ * @param dataImage Array that stores the machine words for data.
+ * @param IC Pointer to the instruction counter, which is reduced by the words removed.
+ * @param DC Pointer to the data counter, which is reduced by the words removed.
+ * @param labels Pointer to the various label tabels.
+ * @param report Receives the number of labels and words removed.
+ * @return TRUE if the unreachable regions were removed, FALSE if out of memory (the images are left unchanged).
+ */
+boolean removeUnreachable(machine_word codeImage[], machine_word dataImage[], int *IC, int *DC, labels_tables *labels, dead_report *report);
+
+#endif /* OPTIMIZER_H */
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "options.h"
+#include "utils.h"
+#include "print.h"
+#include "generateOutput.h"
+#include "manifest.h"
+
+/**
+ * Returns the value of an option if the argument is that option.
+ * @param arg The command line argument.
+ * @param name The name of the option, including the '=' sign.
+ * @return A pointer to the value, or NULL if the argument is a different option.
+ */
+static char *optionValue (char *arg, const char *name) {
+    if (strncmp(arg, name, strlen(name)) == 0)
+        return arg + strlen(name);
+    return NULL;
+}
+
+/**
+ * Parses a positive size option.
+ * @param value The value of the option.
+ * @param size Receives the parsed size.
+ * @return TRUE if the value is a valid positive number, FALSE otherwise.
+ */
+static boolean parseSize (char *value, long *size) {
+    char *end;
+    *size = strtol(value, &end, 10);
+    return (end != value && *end == '\0' && *size > 0);
+}
+
+/**
+ * Checks if a command line argument is an option rather than a file name.
+ * @param arg The command line argument.
+ * @return TRUE if the argument is an option, FALSE otherwise.
+ */
+boolean isOption (char *arg) {
+    return (strncmp(arg, "--", 2) == 0);
+}
+
+/**
+ * Parses all the options in the command line.
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments.
+ * @param options Receives the parsed options.
+ * @return The number of file names in the command line, or -1 if an option is invalid.
+ */
+int parseOptions (int argc, char *argv[], options_t *options) {
+    int i, files = 0, count;
+    char *value, *end;
+
+    options->cacheDirectory = NULL;
+    options->cacheSize = DEFAULT_CACHE_SIZE;
+    options->streaming = FALSE;
+    options->frameDiagnostics = FALSE;
+    options->stats = FALSE;
+    options->memoryReport = FALSE;
+    options->perf = FALSE;
+    options->tracePath = NULL;
+    options->optimize = FALSE;
+    options->pool = FALSE;
+    options->deadStrip = FALSE;
+    options->watch = FALSE;
+    options->incremental = FALSE;
+    options->jobs = 1;
+    options->check = FALSE;
+    options->failFast = FAIL_FAST_NONE;
+    options->base = BASE_ADDRESS;
+    options->io = IO_BACKEND_STDIO;
+    options->pipeline = FALSE;
+    options->shard = 0;
+    options->shards = 0;
+    options->manifestPath = NULL;
+
+    for (i = 1; i < argc; i++) {
+        if (isOption(argv[i]) == FALSE) {
+            files++;
+            if (strcmp(argv[i], "-") == 0)
+                options->streaming = TRUE;
+        } else if (strcmp(argv[i], "--check") == 0) {
+            options->check = TRUE;
+        } else if (strcmp(argv[i], "--dead-strip") == 0) {
+            options->deadStrip = TRUE;
+        } else if (strcmp(argv[i], "--fail-fast") == 0 || strcmp(argv[i], "--fail-fast=file") == 0) {
+            options->failFast = FAIL_FAST_FILE;
+        } else if (strcmp(argv[i], "--fail-fast=batch") == 0) {
+            options->failFast = FAIL_FAST_BATCH;
+        } else if (strcmp(argv[i], "--frame-diagnostics") == 0) {
+            options->frameDiagnostics = TRUE;
+        } else if (strcmp(argv[i], "--incremental") == 0) {
+            options->incremental = TRUE;
+        } else if (strcmp(argv[i], "--io=stdio") == 0) {
+            options->io = IO_BACKEND_STDIO;
+        } else if (strcmp(argv[i], "--io=pread") == 0) {
+            options->io = IO_BACKEND_PREAD;
+        } else if (strcmp(argv[i], "--io=uring") == 0) {
+            options->io = IO_BACKEND_URING;
+        } else if (strcmp(argv[i], "--memory") == 0) {
+            options->memoryReport = TRUE;
+        } else if (strcmp(argv[i], "--optimize") == 0) {
+            options->optimize = TRUE;
+        } else if (strcmp(argv[i], "--pipeline") == 0) {
+            options->pipeline = TRUE;
+        } else if (strcmp(argv[i], "--pool") == 0) {
+            options->pool = TRUE;
+        } else if (strcmp(argv[i], "--perf") == 0) {
+            options->perf = TRUE;
+        } else if (strcmp(argv[i], "--watch") == 0) {
+            options->watch = TRUE;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+#ifdef NO_STATS
+            printWarningGeneral("This assembler was built without statistics, ignoring '--stats'.\n");
+#else
+            options->stats = TRUE;
+#endif
+        } else if ((value = optionValue(argv[i], "--cache=")) != NULL && *value != '\0') {
+            options->cacheDirectory = value;
+        } else if ((value = optionValue(argv[i], "--trace=")) != NULL && *value != '\0') {
+            options->tracePath = value;
+        } else if ((value = optionValue(argv[i], "--jobs=")) != NULL) {
+            if (parseSize(value, &options->jobs) == FALSE || options->jobs > MAX_OUTPUT_JOBS) {
+                printErrorGeneral("Invalid number of jobs ");
+                printMessage("'%s' (1 to %d).\n", value, MAX_OUTPUT_JOBS);
+                return -1;
+            }
+        } else if ((value = optionValue(argv[i], "--base=")) != NULL) {
+            options->base = strtol(value, &end, 10);
+            if (end == value || *end != '\0' || options->base < 0 || options->base > MAX_ADDRESS) {
+                printErrorGeneral("Invalid base address ");
+                printMessage("'%s' (0 to %d).\n", value, MAX_ADDRESS);
+                return -1;
+            }
+        } else if ((value = optionValue(argv[i], "--cache-size=")) != NULL) {
+            if (parseSize(value, &options->cacheSize) == FALSE) {
+                printErrorGeneral("Invalid cache size ");
+                printMessage("'%s'.\n", value);
+                return -1;
+            }
+        } else if ((value = optionValue(argv[i], "--manifest=")) != NULL && *value != '\0') {
+            options->manifestPath = value;
+        } else if ((value = optionValue(argv[i], "--shard=")) != NULL) {
+            if (sscanf(value, "%d/%d%n", &options->shard, &options->shards, &count) != 2 || value[count] != '\0' ||
+                options->shard < 1 || options->shard > options->shards || options->shards > MAX_SHARDS) {
+                printErrorGeneral("Invalid shard ");
+                printMessage("'%s' (i/N with 1 <= i <= N <= %d).\n", value, MAX_SHARDS);
+                return -1;
+            }
+        } else if ((value = optionValue(argv[i], "--io=")) != NULL) {
+            printErrorGeneral("Invalid I/O backend ");
+            printMessage("'%s' (stdio, pread or uring).\n", value);
+            return -1;
+        } else {
+            printErrorGeneral("Unknown option ");
+            printMessage("'%s'.\n", argv[i]);
+            return -1;
+        }
+    }
+    return files;
+}
+
+/**
+ * Writes a short string describing every option that changes the generated output.
+ * @param options The parsed options.
+ * @param key Buffer of at least MAX_OPTIONS_KEY_LENGTH characters.
+ */
+void writeOptionsKey (options_t *options, char *key) {
+    key[0] = '\0';
+    if (options->optimize == TRUE)
+        strcat(key, "optimize;");
+    if (options->pool == TRUE)
+        strcat(key, "pool;");
+    if (options->deadStrip == TRUE)
+        strcat(key, "dead-strip;");
+    if (options->base != BASE_ADDRESS)
+        sprintf(key + strlen(key), "base=%ld;", options->base);
+}
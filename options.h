@@ -0,0 +1,66 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include "utils.h"
+#include "batchio.h"
+
+#define MAX_OPTIONS_KEY_LENGTH 128
+#define DEFAULT_CACHE_SIZE (64L * 1024 * 1024)
+
+/* Where '--fail-fast' stops after an error */
+typedef enum fail_fast_t {
+    FAIL_FAST_NONE = 0, /* every line of every file is checked */
+    FAIL_FAST_FILE, /* the rest of a file is skipped after its first error */
+    FAIL_FAST_BATCH /* the rest of the files are skipped too */
+} fail_fast_t;
+
+/* Command line options - every option starts with "--" and carries its value after a '=' */
+typedef struct options_t {
+    char *cacheDirectory; /* directory of the build cache, NULL if caching is disabled */
+    long cacheSize; /* maximum number of bytes the build cache may hold */
+    boolean streaming; /* a file named "-" is read from stdin and its outputs are framed into stdout */
+    boolean frameDiagnostics; /* diagnostics of the stdin file go into the stream rather than stderr */
+    boolean stats; /* print the time spent in every phase and the work done */
+    boolean memoryReport; /* print the heap allocations of every subsystem and the peak memory */
+    boolean perf; /* count cycles, instructions and misses of every phase with the hardware counters */
+    char *tracePath; /* write a Chrome trace of every file and phase here, NULL if not tracing */
+    boolean optimize; /* remove no-op and unreachable instructions before relocation */
+    boolean pool; /* share the data of identical '.pool' labels */
+    boolean deadStrip; /* remove the code and data that nothing reaches */
+    boolean watch; /* assemble the files again whenever they change, until Ctrl-C */
+    boolean incremental; /* reuse the lines parsed by the previous run, kept in a sidecar next to the file */
+    long jobs; /* threads that relocate and encode the images of a file */
+    boolean check; /* only preprocess, parse and check the labels in memory, write nothing and set the exit status */
+    fail_fast_t failFast; /* stop at the first error of a file, or of the whole batch */
+    long base; /* the address the code is loaded at */
+    io_backend_t io; /* how the source files are read and the outputs written */
+    boolean pipeline; /* read, preprocess, parse and write the files on a thread per stage */
+    int shard; /* assemble only the files of this shard, counted from 1, 0 if not sharding */
+    int shards; /* the number of shards the files are split into */
+    char *manifestPath; /* write the manifest of the shard here, NULL for 'shard-<i>-of-<N>.manifest' */
+} options_t;
+
+/**
+ * Checks if a command line argument is an option rather than a file name.
+ * @param arg The command line argument.
+ * @return TRUE if the argument is an option, FALSE otherwise.
+ */
+boolean isOption(char *arg);
+
+/**
+ * Parses all the options in the command line.
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments.
+ * @param options Receives the parsed options.
+ * @return The number of file names in the command line, or -1 if an option is invalid.
+ */
+int parseOptions(int argc, char *argv[], options_t *options);
+
+/**
+ * Writes a short string describing every option that changes the generated output.
+ * @param options The parsed options.
+ * @param key Buffer of at least MAX_OPTIONS_KEY_LENGTH characters.
+ */
+void writeOptionsKey(options_t *options, char *key);
+
+#endif /* OPTIONS_H */
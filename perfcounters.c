@@ -0,0 +1,239 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "perfcounters.h"
+#include "stats.h"
+#include "utils.h"
+#include "print.h"
+
+/* counts of one file, or of all the files together */
+typedef struct perf_counts {
+    double events[NUM_OF_PHASES][NUM_OF_PERF_EVENTS];
+    long lines;
+    long words;
+    int files;
+} perf_counts;
+
+static char *eventNames[NUM_OF_PERF_EVENTS] = {
+        "cycles",
+        "instructions",
+        "branch-misses",
+        "L1D misses",
+        "LLC misses"
+};
+
+boolean perfEnabled = FALSE;
+
+static int eventFds[NUM_OF_PERF_EVENTS];
+static double phaseStart[NUM_OF_PHASES][NUM_OF_PERF_EVENTS];
+static perf_counts currentFile;
+static perf_counts total;
+static stats_counters fileStartCounters; /* work counters when the current file started */
+
+/**
+ * Computes a ratio, guarding against a zero divisor.
+ * @param amount The dividend.
+ * @param per The divisor.
+ * @return The ratio, or 0 if the divisor is 0.
+ */
+static double ratio (double amount, double per) {
+    return (per > 0) ? amount / per : 0;
+}
+
+#ifdef __linux__
+/**
+ * Opens a single counter of the calling thread and of the threads it starts later (like the workers of --jobs),
+ * on any CPU, in user space only. A read of an inherited counter includes the counts of those threads.
+ * @param type The perf event type.
+ * @param config The perf event config.
+ * @return The file descriptor of the counter, or -1 if it is unavailable.
+ */
+static int openCounter (unsigned int type, unsigned long config) {
+    struct perf_event_attr attributes;
+
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = type;
+    attributes.config = config;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.inherit = 1;
+    /* the counters may be multiplexed, so read the times to scale them */
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+/**
+ * Reads a counter, scaled up for the time it was not running.
+ * @param fd The file descriptor of the counter.
+ * @return The estimated count, or 0 if it could not be read.
+ */
+static double readCounter (int fd) {
+    __u64 values[3]; /* value, time enabled, time running */
+    if (read(fd, values, sizeof(values)) != (long) sizeof(values) || values[2] == 0)
+        return 0;
+    return (double) values[0] * ((double) values[1] / values[2]);
+}
+#endif
+
+/**
+ * Reads all the open counters.
+ * @param values Receives the count of every event (0 for those not open).
+ */
+static void readCounters (double values[NUM_OF_PERF_EVENTS]) {
+    int event;
+    for (event = 0; event < NUM_OF_PERF_EVENTS; event++) {
+        values[event] = 0;
+#ifdef __linux__
+        if (eventFds[event] >= 0)
+            values[event] = readCounter(eventFds[event]);
+#endif
+    }
+}
+
+/**
+ * Prints the counts of a file, or of the totals.
+ * @param counts The counts to print.
+ */
+static void printCounts (perf_counts *counts) {
+    double sum[NUM_OF_PERF_EVENTS];
+    int phase, event;
+
+    printMessage("  %-12s", "phase");
+    for (event = 0; event < NUM_OF_PERF_EVENTS; event++)
+        if (eventFds[event] >= 0)
+            printMessage(" %14s", eventNames[event]);
+    printMessage(" %8s\n", "IPC");
+    memset(sum, 0, sizeof(sum));
+    for (phase = 0; phase < NUM_OF_PHASES; phase++) {
+        printMessage("  %-12s", phaseNames[phase]);
+        for (event = 0; event < NUM_OF_PERF_EVENTS; event++) {
+            if (eventFds[event] >= 0)
+                printMessage(" %14.0f", counts->events[phase][event]);
+            sum[event] += counts->events[phase][event];
+        }
+        printMessage(" %8.2f\n", ratio(counts->events[phase][PERF_INSTRUCTIONS], counts->events[phase][PERF_CYCLES]));
+    }
+    printMessage("  %-12s", "total");
+    for (event = 0; event < NUM_OF_PERF_EVENTS; event++)
+        if (eventFds[event] >= 0)
+            printMessage(" %14.0f", sum[event]);
+    printMessage(" %8.2f\n", ratio(sum[PERF_INSTRUCTIONS], sum[PERF_CYCLES]));
+
+    /* the work counters are compiled out with NO_STATS, and then there is nothing to divide by */
+    if (counts->lines > 0 && counts->words > 0) {
+        for (event = 0; event < NUM_OF_PERF_EVENTS; event++) {
+            if (eventFds[event] >= 0 && event != PERF_CYCLES && event != PERF_INSTRUCTIONS)
+                printMessage("  %s: %.3f per line, %.3f per word\n", eventNames[event],
+                             ratio(sum[event], counts->lines), ratio(sum[event], counts->words));
+        }
+    }
+}
+
+/**
+ * Opens the hardware counters of the calling thread, inherited by the threads it starts. Only supported on Linux.
+ * @return TRUE if at least one counter was opened, FALSE if none are available.
+ */
+boolean startPerfCounters (void) {
+    int event;
+
+    for (event = 0; event < NUM_OF_PERF_EVENTS; event++)
+        eventFds[event] = -1;
+#ifdef __linux__
+    eventFds[PERF_CYCLES] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    eventFds[PERF_INSTRUCTIONS] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    eventFds[PERF_BRANCH_MISSES] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    eventFds[PERF_L1D_MISSES] = openCounter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    eventFds[PERF_LLC_MISSES] = openCounter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+                                            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    for (event = 0; event < NUM_OF_PERF_EVENTS; event++)
+        if (eventFds[event] >= 0)
+            perfEnabled = TRUE;
+#endif
+    return perfEnabled;
+}
+
+/**
+ * Closes the hardware counters.
+ */
+void stopPerfCounters (void) {
+    int event;
+    for (event = 0; event < NUM_OF_PERF_EVENTS; event++) {
+#ifdef __linux__
+        if (eventFds[event] >= 0)
+            close(eventFds[event]);
+#endif
+        eventFds[event] = -1;
+    }
+    perfEnabled = FALSE;
+}
+
+/**
+ * Reads the counters at the start of a phase of the current file.
+ * @param phase The phase that starts.
+ */
+void perfPhaseBegin (phase_t phase) {
+    readCounters(phaseStart[phase]);
+}
+
+/**
+ * Reads the counters at the end of a phase of the current file and adds the difference to it.
+ * @param phase The phase that ends.
+ */
+void perfPhaseEnd (phase_t phase) {
+    double now[NUM_OF_PERF_EVENTS];
+    int event;
+
+    readCounters(now);
+    for (event = 0; event < NUM_OF_PERF_EVENTS; event++)
+        if (now[event] > phaseStart[phase][event])
+            currentFile.events[phase][event] += now[event] - phaseStart[phase][event];
+}
+
+/**
+ * Resets the counts before assembling a new file.
+ */
+void perfBeginFile (void) {
+    memset(&currentFile, 0, sizeof(currentFile));
+    fileStartCounters = statsCounters;
+}
+
+/**
+ * Prints the counts of the current file and adds them to the totals.
+ * @param fileName The base name of the file.
+ */
+void perfEndFile (char *fileName) {
+    int phase, event;
+
+    currentFile.lines = statsCounters.lines - fileStartCounters.lines;
+    currentFile.words = statsCounters.words - fileStartCounters.words;
+    currentFile.files = 1;
+    printMessage("Hardware counters for file '%s':\n", fileName);
+    printCounts(&currentFile);
+
+    for (phase = 0; phase < NUM_OF_PHASES; phase++)
+        for (event = 0; event < NUM_OF_PERF_EVENTS; event++)
+            total.events[phase][event] += currentFile.events[phase][event];
+    total.lines += currentFile.lines;
+    total.words += currentFile.words;
+    total.files++;
+}
+
+/**
+ * Prints the counts of all the files assembled so far.
+ */
+void printPerfTotal (void) {
+    printMessage("Hardware counters for all %d files:\n", total.files);
+    printCounts(&total);
+}
@@ -0,0 +1,59 @@
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include "utils.h"
+#include "stats.h"
+
+/* Hardware events counted around every phase */
+typedef enum {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_BRANCH_MISSES,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    NUM_OF_PERF_EVENTS
+} perf_event_t;
+
+/* TRUE when --perf was given and at least one hardware counter could be opened */
+extern boolean perfEnabled;
+
+/**
+ * Opens the hardware counters of the calling thread, inherited by the threads it starts. Only supported on Linux.
+ * @return TRUE if at least one counter was opened, FALSE if none are available.
+ */
+boolean startPerfCounters(void);
+
+/**
+ * Closes the hardware counters.
+ */
+void stopPerfCounters(void);
+
+/**
+ * Reads the counters at the start of a phase of the current file.
+ * @param phase The phase that starts.
+ */
+void perfPhaseBegin(phase_t phase);
+
+/**
+ * Reads the counters at the end of a phase of the current file and adds the difference to it.
+ * @param phase The phase that ends.
+ */
+void perfPhaseEnd(phase_t phase);
+
+/**
+ * Resets the counts before assembling a new file.
+ */
+void perfBeginFile(void);
+
+/**
+ * Prints the counts of the current file and adds them to the totals.
+ * @param fileName The base name of the file.
+ */
+void perfEndFile(char *fileName);
+
+/**
+ * Prints the counts of all the files assembled so far.
+ */
+void printPerfTotal(void);
+
+#endif /* PERFCOUNTERS_H */
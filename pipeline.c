@@ -0,0 +1,84 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "pipeline.h"
+#include "utils.h"
+
+/**
+ * Initializes an empty queue.
+ * @param queue The queue to initialize.
+ * @param capacity The number of items it holds at most.
+ * @return TRUE if the queue was initialized, FALSE if there is not enough memory.
+ */
+boolean initQueue (job_queue *queue, int capacity) {
+    queue->items = malloc(capacity * sizeof(void *));
+    if (queue->items == NULL)
+        return FALSE;
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->count = 0;
+    queue->closed = FALSE;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->notEmpty, NULL);
+    pthread_cond_init(&queue->notFull, NULL);
+    return TRUE;
+}
+
+/**
+ * Adds an item at the end of a queue, waiting while the queue is full.
+ * @param queue The queue.
+ * @param item The item (not NULL).
+ */
+void pushQueue (job_queue *queue, void *item) {
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == queue->capacity)
+        pthread_cond_wait(&queue->notFull, &queue->lock);
+    queue->items[(queue->head + queue->count) % queue->capacity] = item;
+    queue->count++;
+    pthread_cond_signal(&queue->notEmpty);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/**
+ * Takes the oldest item of a queue, waiting while the queue is empty.
+ * @param queue The queue.
+ * @return The item, or NULL once the queue is closed and empty.
+ */
+void *popQueue (job_queue *queue) {
+    void *item = NULL;
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == 0 && queue->closed == FALSE)
+        pthread_cond_wait(&queue->notEmpty, &queue->lock);
+    if (queue->count > 0) {
+        item = queue->items[queue->head];
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count--;
+        pthread_cond_signal(&queue->notFull);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return item;
+}
+
+/**
+ * Marks the end of the items of a queue, which wakes up its consumer once it is empty.
+ * @param queue The queue.
+ */
+void closeQueue (job_queue *queue) {
+    pthread_mutex_lock(&queue->lock);
+    queue->closed = TRUE;
+    pthread_cond_broadcast(&queue->notEmpty);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/**
+ * Frees a queue (but not the items left in it).
+ * @param queue The queue.
+ */
+void destroyQueue (job_queue *queue) {
+    pthread_cond_destroy(&queue->notEmpty);
+    pthread_cond_destroy(&queue->notFull);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue->items);
+}
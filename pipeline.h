@@ -0,0 +1,57 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <pthread.h>
+
+#include "utils.h"
+
+#define PIPELINE_QUEUE_DEPTH 4 /* files waiting between two stages, which bounds the files held in memory */
+
+/* A bounded first in, first out queue between two threads: the producer waits while it is full,
+ * and the consumer waits while it is empty */
+typedef struct job_queue {
+    void **items;
+    int capacity;
+    int head; /* the index of the oldest item */
+    int count;
+    boolean closed; /* the producer is done, so an empty queue stays empty */
+    pthread_mutex_t lock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+} job_queue;
+
+/**
+ * Initializes an empty queue.
+ * @param queue The queue to initialize.
+ * @param capacity The number of items it holds at most.
+ * @return TRUE if the queue was initialized, FALSE if there is not enough memory.
+ */
+boolean initQueue(job_queue *queue, int capacity);
+
+/**
+ * Adds an item at the end of a queue, waiting while the queue is full.
+ * @param queue The queue.
+ * @param item The item (not NULL).
+ */
+void pushQueue(job_queue *queue, void *item);
+
+/**
+ * Takes the oldest item of a queue, waiting while the queue is empty.
+ * @param queue The queue.
+ * @return The item, or NULL once the queue is closed and empty.
+ */
+void *popQueue(job_queue *queue);
+
+/**
+ * Marks the end of the items of a queue, which wakes up its consumer once it is empty.
+ * @param queue The queue.
+ */
+void closeQueue(job_queue *queue);
+
+/**
+ * Frees a queue (but not the items left in it).
+ * @param queue The queue.
+ */
+void destroyQueue(job_queue *queue);
+
+#endif /* PIPELINE_H */
@@ -1,264 +1,777 @@
-#include <stdlib.h>
-#include <stdio.h>
-#include <string.h>
-#include <ctype.h>
-
-#include "preprocessor.h"
-#include "print.h"
-#include "utils.h"
-#include "instructions.h"
-#include "directives.h"
-
-#define MACRO_START "mcro "
-#define MACRO_END "endmcro"
-
-/* macro has name 'name', and it's contents lie in the file from 'offset_start' to 'offset_end' including */
-typedef struct macro_t {
-    char name[MAX_LINE_LENGTH+1]; /*adding one extra space for NULL ending*/
-    long int offset_start;
-    long int offset_end;
-} macro_t;
-
-/* macro table entry */
-typedef struct macro_entry {
-    macro_t macro;
-    struct macro_entry *next;
-} macro_entry;
-
-/*macro table*/
-typedef struct macro_table {
-    macro_entry *macros;
-} macro_table;
-
-/**
- * Frees a linked list of macro_entry nodes (which represent a macro table).
- * @param head The head of the linked list.
- */
-static void freeTable (macro_entry *head) {
-    macro_entry *next;
-    while (head != NULL) {
-        next = head->next;
-        free(head);
-        head = next;
-    }
-}
-
-/**
- * Trims leading and trailing whitespace characters from a string.
- * @param str The string to trim.
- * @return A pointer to the trimmed string.
- */
-static char* strtrim (char* str) {
-    size_t start = 0, end, i, len = strlen(str);
-
-    if (len == 0)
-      return str;
-
-    end = len - 1;
-
-    while (isspace(str[start])) start++;
-    while (isspace(str[end])) end--;
-
-    for (i = 0; i <= end - start; i++)
-      str[i] = str[start + i];
-
-    str[i] = '\0';
-    return str;
-}
-
-/**
- * Checks if a given string is a valid macro name.
- * @param name The macro name to check.
- * @return TRUE if the string is a valid macro name, FALSE otherwise.
- */
-static boolean isValidMacroName (char * name) {
-    int i = 0;
-    char *c = name;
-    boolean isSpaceFlag = FALSE;
-    
-    /* no spaces are allowed in macro name */
-    while (*c != '\0') {
-        if (isspace(*c))
-            isSpaceFlag = TRUE;
-        if (!isspace(*c) && isSpaceFlag == TRUE)
-            return FALSE;
-        c++;
-    }  
-
-    /* check if the macro name is an instruction's name */
-    for (i=0; i<NUM_OF_INSTRUCTIONS; i++) {
-        if (strcmp(name, instructions[i]) == 0)
-            return FALSE;
-    }
-    
-    /* check if the macro name is a directive's name */
-    for (i=0; i<NUM_OF_DIRECTIVES; i++) {
-        if (strcmp(name, directives[i]) == 0)
-            return FALSE;
-    }
-    return TRUE;
-}
-
-/**
- * Checks if a given string is a valid 'endmacro' statement.
- * @param name The string to check.
- * @return TRUE if the string is a valid 'endmacro' statement, FALSE otherwise.
- */
-static boolean isValidMacroEnd (char* name) {
-    char* c = name + strlen(MACRO_END);  
-    /* check that there are no characters after 'endmcro' */
-    while (*c != '\0') {
-        if (!isspace(*c))
-            return FALSE;
-        c++;
-    }
-    return TRUE;
-}
-
-/**
- * Finds a macro in the macro table.
- * @param macroTable Pointer to the macro table.
- * @param name The macro name to find.
- * @return A pointer to the found label, or NULL if not found.
- */
-static macro_entry *findMacro (macro_table *macroTable, char *name) {
-    macro_entry *entry = macroTable->macros;
-
-    while (entry != NULL) {
-        /* check if the macro exists in the table */
-        if (strcmp(entry->macro.name, name) == 0) {
-            break;
-        }
-        entry = entry->next;
-    }
-    return entry;
-}
-
-/**
- * Adds a new macro entry to the macro_table.
- * @param macroTable Pointer to the macro table.
- * @param name The macro name.
- * @param offset_start The start offset of the macro in the source file.
- * @param offset_end The end offset of the macro in the source file.
- * @param lineNumber The number of the current line being processed.
- * @return TRUE if the macro is added successfully, FALSE otherwise.
- */
-static boolean addMacro (macro_table *macroTable, char* name, long int offset_start, long int offset_end, int lineNumber) {
-    macro_entry *new_entry;
-
-    /* allocate space for new macro */
-    new_entry = (macro_entry *) calloc(MAX_LINE_LENGTH, sizeof(macro_entry));
-    if (new_entry == NULL) {
-        printError("Could not allocate space for macro.", lineNumber);
-        return FALSE;
-    }
-    strcpy(new_entry->macro.name, name);
-    new_entry->macro.offset_start = offset_start;
-    new_entry->macro.offset_end = offset_end;
-
-    /* add macro to table*/
-    new_entry->next = macroTable->macros;
-    macroTable->macros = new_entry;
-    return TRUE;
-}
-
-/**
- * Preprocesses a source file, expanding macros and removing comment lines.
- * @param fileAs Pointer to the source file.
- * @param fileAm Pointer to the output file.
- * @param as_offset_start The start offset in the source file.
- * @param as_offset_end The end offset in the source file.
- * @return TRUE if preprocessing is successful, FALSE otherwise.
- */
-boolean preprocessFile(FILE* fileAs, FILE* fileAm, long int as_offset_start, long int as_offset_end) {
-    char buffer[MAX_LINE_LENGTH+1]; /* add one extra space for NULL ending */
-    char *current; /* index of current char in buffer */
-    int lineLength, lineNumber = 0;
-    boolean insideMacro = FALSE;
-    boolean errorFlag = FALSE;
-    char macroName[MAX_LINE_LENGTH+1];
-    char macroToSearch[MAX_LINE_LENGTH+1];
-    long int offset_start, offset_end, asOffsetOriginal;
-    macro_table macros_table;
-    macro_entry *entry;
-    macros_table.macros = NULL;
-    
-    asOffsetOriginal = ftell(fileAs);
-    fseek(fileAs, as_offset_start, SEEK_SET);
-    /* loop over every line in source file */
-    while (fgets(buffer, sizeof(buffer), fileAs) != NULL && ftell(fileAs) <= as_offset_end) {
-        lineNumber++;
-        
-        /* skip all spaces */
-        current = buffer;
-        while (isspace(*current)) {
-            current++;
-        }
-
-        lineLength = strlen(current); /* length with \n */
-        
-        if ((lineLength == 1) && (*current == '\n')) { /* check if is an empty line */
-            continue;
-        }
-
-        if ((lineLength >= 2) && (*current == ';')) { /* comment line, or at least ';\n' */
-            continue;
-        }       
-
-        /* remove trailing \n and whitespaces */
-        strcpy(macroToSearch, current); 
-        strtrim(macroToSearch);
-
-        /* check if line is a macro */
-        entry = findMacro(&macros_table, macroToSearch);
-
-        if (entry != NULL) { /* if macro is found */
-            /* write macro contents into file instead of continuing to read the line */
-            preprocessFile(fileAs, fileAm, entry->macro.offset_start, entry->macro.offset_end);
-        } else if (insideMacro == TRUE) { /* if is inside macro */
-            /* if found 'endmcro' */
-            if (strncmp(current, MACRO_END, strlen(MACRO_END)) == 0)  { 
-                if (isValidMacroEnd(current) == FALSE) { /* check if there are other characters on the line */
-                    printError("No characters allowed on line after 'endmcro' flag.", lineNumber);
-                    errorFlag = TRUE;
-                    break;
-                }
-                insideMacro = FALSE;
-                if (addMacro(&macros_table, macroName, offset_start, offset_end, lineNumber) == FALSE) { /* error trying to add macro */
-                    errorFlag = TRUE;
-                    break;
-                }
-
-            }
-        } else { /* if is outside macro */
-            /* if line starts with MACRO_START flag */
-            if ((lineLength - 1 >= strlen(MACRO_START)) && (strncmp(current, MACRO_START, strlen(MACRO_START)) == 0)) {
-                insideMacro = TRUE;
-                strcpy(macroName, strtrim(current + strlen(MACRO_START)));
-
-                /* check if macro name is valid, and if its not already defined */
-                if (isValidMacroName(macroName) == FALSE) {
-                    printError ("Macro name is invalid (keywords are not allowed).", lineNumber);
-                    errorFlag = TRUE;
-                    break;
-                }
-     
-                /* check if macro is already defiend */
-                if (findMacro(&macros_table, macroName) != NULL) {
-                    printError("Macro is already defined.", lineNumber);
-                    errorFlag = TRUE;
-                    break;
-                }
-                
-                offset_start = ftell(fileAs);
-            } else { /* if is a regular line */
-                fputs(buffer, fileAm); /* copy line as it is to .am */
-            }
-        }
-        offset_end = ftell(fileAs);
-    }
-    
-    fseek(fileAs, asOffsetOriginal, SEEK_SET);
-    freeTable(macros_table.macros);
-    return errorFlag;
-}
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <pthread.h>
+
+#include "preprocessor.h"
+#include "print.h"
+#include "utils.h"
+#include "instructions.h"
+#include "directives.h"
+#include "stats.h"
+#include "memory.h"
+#include "trace.h"
+#include "hash.h"
+
+#define MACRO_START "mcro "
+#define MACRO_END "endmcro"
+#define INCLUDE_DIRECTIVE ".include"
+#define MAX_INCLUDED_FILES 64
+#define INCLUDE_CACHE_BUCKETS 64
+#define INITIAL_TEXT_CAPACITY 256
+
+/* macro has name 'name', and it's contents lie in the file from 'offset_start' to 'offset_end' including */
+typedef struct macro_t {
+    char name[MAX_LINE_LENGTH+1]; /*adding one extra space for NULL ending*/
+    long int offset_start;
+    long int offset_end;
+    const char *body; /* the preprocessed contents of a macro from an included file, NULL for a macro of the file itself */
+} macro_t;
+
+/* macro table entry */
+typedef struct macro_entry {
+    macro_t macro;
+    struct macro_entry *next;
+} macro_entry;
+
+/*macro table*/
+typedef struct macro_table {
+    macro_entry *macros;
+} macro_table;
+
+/* A growing piece of text */
+typedef struct text_buffer {
+    char *data;
+    size_t length;
+    size_t capacity;
+} text_buffer;
+
+/* A part of an included file: either lines to copy as they are, or another file to include */
+typedef struct include_segment {
+    char *text; /* NULL for an '.include' */
+    char *path; /* NULL for lines */
+    struct include_segment *next;
+} include_segment;
+
+/* A macro of an included file */
+typedef struct included_macro {
+    char name[MAX_LINE_LENGTH+1]; /*adding one extra space for NULL ending*/
+    char *body;
+    struct included_macro *next;
+} included_macro;
+
+/* An included file, read, comment-stripped and macro-indexed once per run, and never changed after */
+typedef struct included_file {
+    char path[MAX_INCLUDE_PATH_LENGTH+1]; /* resolved against the directory of the file that includes it */
+    boolean valid;
+    boolean reading; /* TRUE until it is read, so that an include cycle does not read it again */
+    include_segment *segments;
+    included_macro *macros;
+    struct included_file *imports[MAX_INCLUDED_FILES]; /* the files it includes, whose macros it can call */
+    int importCount;
+    struct included_file *next;
+} included_file;
+
+/* The files included by the source file being preprocessed */
+typedef struct include_state {
+    const char *sourcePath; /* the names in its '.include' lines are relative to its directory */
+    const char *included[MAX_INCLUDED_FILES]; /* every file included so far - each one is included only once */
+    int includedCount;
+    const char *stack[MAX_INCLUDED_FILES]; /* the files being included right now, to find cycles */
+    int depth;
+} include_state;
+
+/* included files of the whole run, shared by every source file (and thread) */
+static included_file *includeCache[INCLUDE_CACHE_BUCKETS];
+static pthread_mutex_t includeCacheLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Frees a linked list of macro_entry nodes (which represent a macro table).
+ * @param head The head of the linked list.
+ */
+static void freeTable (macro_entry *head) {
+    macro_entry *next;
+    while (head != NULL) {
+        next = head->next;
+        freeMemory(head, MEMORY_MACROS);
+        head = next;
+    }
+}
+
+/**
+ * Trims leading and trailing whitespace characters from a string.
+ * @param str The string to trim.
+ * @return A pointer to the trimmed string.
+ */
+static char* strtrim (char* str) {
+    size_t start = 0, end, i, len = strlen(str);
+
+    if (len == 0)
+      return str;
+
+    end = len - 1;
+
+    while (isspace(str[start])) start++;
+    if (str[start] == '\0') { /* only whitespace - without this, end would run back past the start */
+        str[0] = '\0';
+        return str;
+    }
+    while (isspace(str[end])) end--;
+
+    for (i = 0; i <= end - start; i++)
+      str[i] = str[start + i];
+
+    str[i] = '\0';
+    return str;
+}
+
+/**
+ * Checks if a given string is a valid macro name.
+ * @param name The macro name to check.
+ * @return TRUE if the string is a valid macro name, FALSE otherwise.
+ */
+static boolean isValidMacroName (char * name) {
+    int i = 0;
+    char *c = name;
+    boolean isSpaceFlag = FALSE;
+    
+    /* no spaces are allowed in macro name */
+    while (*c != '\0') {
+        if (isspace(*c))
+            isSpaceFlag = TRUE;
+        if (!isspace(*c) && isSpaceFlag == TRUE)
+            return FALSE;
+        c++;
+    }  
+
+    /* check if the macro name is an instruction's name */
+    for (i=0; i<NUM_OF_INSTRUCTIONS; i++) {
+        if (strcmp(name, instructions[i]) == 0)
+            return FALSE;
+    }
+    
+    /* check if the macro name is a directive's name */
+    for (i=0; i<NUM_OF_DIRECTIVES; i++) {
+        if (strcmp(name, directives[i]) == 0)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * Checks if a given string is a valid 'endmacro' statement.
+ * @param name The string to check.
+ * @return TRUE if the string is a valid 'endmacro' statement, FALSE otherwise.
+ */
+static boolean isValidMacroEnd (char* name) {
+    char* c = name + strlen(MACRO_END);  
+    /* check that there are no characters after 'endmcro' */
+    while (*c != '\0') {
+        if (!isspace(*c))
+            return FALSE;
+        c++;
+    }
+    return TRUE;
+}
+
+/**
+ * Finds a macro in the macro table.
+ * @param macroTable Pointer to the macro table.
+ * @param name The macro name to find.
+ * @return A pointer to the found label, or NULL if not found.
+ */
+static macro_entry *findMacro (macro_table *macroTable, char *name) {
+    macro_entry *entry = macroTable->macros;
+
+    while (entry != NULL) {
+        /* check if the macro exists in the table */
+        if (strcmp(entry->macro.name, name) == 0) {
+            break;
+        }
+        entry = entry->next;
+    }
+    return entry;
+}
+
+/**
+ * Adds a new macro entry to the macro_table.
+ * @param macroTable Pointer to the macro table.
+ * @param name The macro name.
+ * @param offset_start The start offset of the macro in the source file.
+ * @param offset_end The end offset of the macro in the source file.
+ * @param body The contents of a macro from an included file, or NULL for a macro of the source file.
+ * @param lineNumber The number of the current line being processed.
+ * @return TRUE if the macro is added successfully, FALSE otherwise.
+ */
+static boolean addMacro (macro_table *macroTable, char* name, long int offset_start, long int offset_end, const char *body, int lineNumber) {
+    macro_entry *new_entry;
+
+    /* allocate space for new macro */
+    new_entry = (macro_entry *) allocateZeroedMemory(1, sizeof(macro_entry), MEMORY_MACROS);
+    if (new_entry == NULL) {
+        printError("Could not allocate space for macro.", lineNumber);
+        return FALSE;
+    }
+    strcpy(new_entry->macro.name, name);
+    new_entry->macro.offset_start = offset_start;
+    new_entry->macro.offset_end = offset_end;
+    new_entry->macro.body = body;
+
+    /* add macro to table*/
+    new_entry->next = macroTable->macros;
+    macroTable->macros = new_entry;
+    return TRUE;
+}
+
+/**
+ * Checks if a line is an '.include "file"' line, and reads the name of the included file.
+ * @param line The line to check.
+ * @param path Receives the name of the included file (at least MAX_LINE_LENGTH + 1 characters), empty if it is malformed.
+ * @return TRUE if the line is an '.include' line, FALSE otherwise.
+ */
+boolean parseInclude (const char *line, char *path) {
+    const char *end;
+    size_t length = strlen(INCLUDE_DIRECTIVE);
+
+    path[0] = '\0';
+    while (isspace(*line))
+        line++;
+    if (strncmp(line, INCLUDE_DIRECTIVE, length) != 0 || !(isspace(line[length]) || line[length] == '\0'))
+        return FALSE;
+    line += length;
+    while (isspace(*line))
+        line++;
+
+    /* the name must be in quotes, with nothing after it */
+    if (*line != '"' || (end = strchr(line + 1, '"')) == NULL || end == line + 1)
+        return TRUE;
+    for (length = 1; end[length] != '\0'; length++) {
+        if (!isspace(end[length]))
+            return TRUE;
+    }
+    memcpy(path, line + 1, end - line - 1);
+    path[end - line - 1] = '\0';
+    return TRUE;
+}
+
+/**
+ * Appends a string to a growing piece of text.
+ * @param buffer The text to append to.
+ * @param str The string to append.
+ * @return TRUE if successful, FALSE if out of memory.
+ */
+static boolean appendText (text_buffer *buffer, const char *str) {
+    size_t length = strlen(str), capacity;
+    char *bigger;
+
+    if (buffer->length + length + 1 > buffer->capacity) {
+        capacity = (buffer->capacity == 0) ? INITIAL_TEXT_CAPACITY : buffer->capacity;
+        while (capacity < buffer->length + length + 1)
+            capacity *= 2;
+        bigger = allocateMemory(capacity, MEMORY_INCLUDES);
+        if (bigger == NULL)
+            return FALSE;
+        if (buffer->data != NULL)
+            memcpy(bigger, buffer->data, buffer->length);
+        freeMemory(buffer->data, MEMORY_INCLUDES);
+        buffer->data = bigger;
+        buffer->capacity = capacity;
+    }
+    memcpy(buffer->data + buffer->length, str, length + 1);
+    buffer->length += length;
+    return TRUE;
+}
+
+/**
+ * Prints an error in an included file.
+ * @param path The name of the included file.
+ * @param lineNumber The number of the line in the included file.
+ * @param str The error message.
+ */
+static void printIncludeError (const char *path, int lineNumber, char *str) {
+    printErrorGeneral("In included file ");
+    printMessage("'%s', line #%d: %s\n", path, lineNumber, str);
+}
+
+/**
+ * Adds a part to the end of an included file.
+ * @param file The included file.
+ * @param text Lines to copy (taken over only if successful), or NULL.
+ * @param path A file to include, or NULL.
+ * @return TRUE if successful, FALSE if out of memory.
+ */
+static boolean addSegment (included_file *file, char *text, const char *path) {
+    include_segment **last = &file->segments;
+    include_segment *segment = allocateZeroedMemory(1, sizeof(include_segment), MEMORY_INCLUDES);
+
+    if (segment == NULL)
+        return FALSE;
+    segment->text = text;
+    if (path != NULL) {
+        segment->path = allocateMemory(strlen(path) + 1, MEMORY_INCLUDES);
+        if (segment->path == NULL) {
+            freeMemory(segment, MEMORY_INCLUDES);
+            return FALSE;
+        }
+        strcpy(segment->path, path);
+    }
+    while (*last != NULL)
+        last = &(*last)->next;
+    *last = segment;
+    return TRUE;
+}
+
+/**
+ * Finds a macro of an included file, or of a file it includes.
+ * @param file The included file.
+ * @param name The macro name to find.
+ * @return The macro, or NULL if not found.
+ */
+static included_macro *findIncludedMacro (included_file *file, char *name) {
+    included_macro *macro = file->macros;
+    int i;
+
+    while (macro != NULL && strcmp(macro->name, name) != 0)
+        macro = macro->next;
+    for (i = 0; i < file->importCount && macro == NULL; i++)
+        macro = findIncludedMacro(file->imports[i], name);
+    return macro;
+}
+
+/**
+ * Resolves the name in an '.include' line against the directory of the file that has the line.
+ * @param includer The path (or base name) of the including file.
+ * @param path The name in the '.include' line.
+ * @param resolved Receives the path of the included file (at least MAX_INCLUDE_PATH_LENGTH + 1 characters).
+ * @return TRUE if successful, FALSE if the path is longer than MAX_INCLUDE_PATH_LENGTH.
+ */
+boolean resolveIncludePath (const char *includer, const char *path, char *resolved) {
+    const char *slash = strrchr(includer, '/');
+    size_t directoryLength = (path[0] == '/' || slash == NULL) ? 0 : (size_t) (slash - includer + 1);
+
+    if (directoryLength + strlen(path) > MAX_INCLUDE_PATH_LENGTH)
+        return FALSE;
+    memcpy(resolved, includer, directoryLength);
+    strcpy(resolved + directoryLength, path);
+    return TRUE;
+}
+
+static included_file *loadIncludedFile(const char *path);
+
+/**
+ * Reads an included file once: removes its comment lines, indexes its macros and expands the calls to them (and to
+ * the macros of the files it includes, which are read first), and splits it into the lines to copy and the files
+ * it includes. Must be called with the included files locked.
+ * @param file The included file, with only its path set.
+ * @return TRUE if the file is valid, FALSE otherwise.
+ */
+static boolean readIncludedFile (included_file *file) {
+    char buffer[MAX_LINE_LENGTH+1]; /* add one extra space for NULL ending */
+    char trimmed[MAX_LINE_LENGTH+1], path[MAX_LINE_LENGTH+1], resolved[MAX_INCLUDE_PATH_LENGTH+1];
+    char *current;
+    int lineNumber = 0, macroLine = 0;
+    text_buffer text, body;
+    included_macro *macro = NULL, *found;
+    included_file *nested;
+    FILE *input = fopen(file->path, "r");
+
+    if (input == NULL) {
+        printErrorGeneral("Could not open included file ");
+        printMessage("'%s'.\n", file->path);
+        return FALSE;
+    }
+    text.data = body.data = NULL;
+    text.length = body.length = text.capacity = body.capacity = 0;
+
+    while (fgets(buffer, sizeof(buffer), input) != NULL) {
+        lineNumber++;
+        current = buffer;
+        while (isspace(*current))
+            current++;
+        if (*current == '\0' || *current == ';') /* empty or comment line */
+            continue;
+        strcpy(trimmed, current);
+        strtrim(trimmed);
+
+        if (macro != NULL) { /* inside a macro */
+            if (strncmp(current, MACRO_END, strlen(MACRO_END)) == 0) {
+                if (isValidMacroEnd(current) == FALSE) {
+                    printIncludeError(file->path, lineNumber, "No characters allowed on line after 'endmcro' flag.");
+                    break;
+                }
+                macro->body = (body.data != NULL) ? body.data : "";
+                macro->next = file->macros;
+                file->macros = macro;
+                macro = NULL;
+                body.data = NULL;
+                body.length = body.capacity = 0;
+            } else if (parseInclude(current, path) == TRUE) {
+                printIncludeError(file->path, lineNumber, "'.include' is not allowed inside a macro.");
+                break;
+            } else if ((found = findIncludedMacro(file, trimmed)) != NULL) {
+                if (appendText(&body, found->body) == FALSE)
+                    break;
+            } else if (appendText(&body, buffer) == FALSE) {
+                break;
+            }
+        } else if (parseInclude(current, path) == TRUE) {
+            if (path[0] == '\0') {
+                printIncludeError(file->path, lineNumber, "Invalid '.include', expecting a file name in quotes.");
+                break;
+            }
+            if (resolveIncludePath(file->path, path, resolved) == FALSE) {
+                printIncludeError(file->path, lineNumber, "The path of the included file is too long.");
+                break;
+            }
+            /* the lines so far come before the included file */
+            if (text.data != NULL) {
+                if (addSegment(file, text.data, NULL) == FALSE)
+                    break;
+                text.data = NULL;
+                text.length = text.capacity = 0;
+            }
+            if (addSegment(file, NULL, resolved) == FALSE)
+                break;
+            /* the rest of the file can call the macros of the included file (a cycle is reported when included) */
+            nested = loadIncludedFile(resolved);
+            if (nested != NULL && nested->valid == TRUE && nested->reading == FALSE && file->importCount < MAX_INCLUDED_FILES)
+                file->imports[file->importCount++] = nested;
+        } else if ((found = findIncludedMacro(file, trimmed)) != NULL) {
+            STATS_COUNT(macrosExpanded);
+            if (appendText(&text, found->body) == FALSE)
+                break;
+        } else if (strncmp(current, MACRO_START, strlen(MACRO_START)) == 0) {
+            macro = allocateZeroedMemory(1, sizeof(included_macro), MEMORY_INCLUDES);
+            if (macro == NULL)
+                break;
+            macroLine = lineNumber;
+            strcpy(macro->name, strtrim(current + strlen(MACRO_START)));
+            if (isValidMacroName(macro->name) == FALSE || findIncludedMacro(file, macro->name) != NULL) {
+                printIncludeError(file->path, lineNumber, "Macro name is invalid or already defined.");
+                break;
+            }
+        } else if (appendText(&text, buffer) == FALSE) {
+            break;
+        }
+    }
+
+    /* reaching the end of the file means every line was read without an error */
+    if (feof(input) && macro != NULL)
+        printIncludeError(file->path, macroLine, "Macro has no 'endmcro' before the end of the file.");
+    else if (feof(input) && (text.data == NULL || addSegment(file, text.data, NULL) == TRUE)) {
+        fclose(input);
+        return TRUE;
+    }
+    /* the file keeps only what was added to it: the macro being defined and the lines after the last part are freed */
+    fclose(input);
+    freeMemory(body.data, MEMORY_INCLUDES);
+    freeMemory(text.data, MEMORY_INCLUDES);
+    freeMemory(macro, MEMORY_INCLUDES);
+    return FALSE;
+}
+
+/**
+ * Returns an included file, reading it on its first use in the run. Must be called with the included files locked.
+ * @param path The resolved path of the included file.
+ * @return The included file, or NULL if out of memory.
+ */
+static included_file *loadIncludedFile (const char *path) {
+    unsigned long bucket = hashString(path) % INCLUDE_CACHE_BUCKETS;
+    included_file *file = includeCache[bucket];
+
+    while (file != NULL && strcmp(file->path, path) != 0)
+        file = file->next;
+    if (file == NULL) {
+        file = allocateZeroedMemory(1, sizeof(included_file), MEMORY_INCLUDES);
+        if (file != NULL) {
+            strcpy(file->path, path);
+            file->reading = TRUE;
+            file->next = includeCache[bucket];
+            includeCache[bucket] = file;
+            file->valid = readIncludedFile(file);
+            file->reading = FALSE;
+        }
+    }
+    return file;
+}
+
+/**
+ * Returns an included file, reading it on its first use in the run.
+ * @param path The resolved path of the included file.
+ * @return The included file, or NULL if out of memory.
+ */
+static included_file *getIncludedFile (const char *path) {
+    included_file *file;
+
+    pthread_mutex_lock(&includeCacheLock);
+    file = loadIncludedFile(path);
+    pthread_mutex_unlock(&includeCacheLock);
+    return file;
+}
+
+/**
+ * Drops an included file, and every file that includes it, from the included files of the run.
+ * Must be called with the included files locked.
+ * @param path The resolved path of the included file.
+ */
+static void dropIncludedFile (const char *path) {
+    unsigned long bucket = hashString(path) % INCLUDE_CACHE_BUCKETS;
+    char importer[MAX_INCLUDE_PATH_LENGTH+1];
+    included_file **link, *file, *other;
+    include_segment *segment, *nextSegment;
+    included_macro *macro, *nextMacro;
+    boolean found = TRUE;
+    int i, j;
+
+    for (link = &includeCache[bucket]; *link != NULL && strcmp((*link)->path, path) != 0; link = &(*link)->next)
+        ;
+    file = *link;
+    if (file == NULL)
+        return;
+    *link = file->next;
+
+    /* the files that include it hold its macros, so they are read again too */
+    while (found == TRUE) {
+        found = FALSE;
+        for (i = 0; i < INCLUDE_CACHE_BUCKETS && found == FALSE; i++) {
+            for (other = includeCache[i]; other != NULL && found == FALSE; other = other->next) {
+                for (j = 0; j < other->importCount && other->imports[j] != file; j++)
+                    ;
+                if (j < other->importCount) {
+                    strcpy(importer, other->path);
+                    dropIncludedFile(importer);
+                    found = TRUE;
+                }
+            }
+        }
+    }
+
+    for (segment = file->segments; segment != NULL; segment = nextSegment) {
+        nextSegment = segment->next;
+        freeMemory(segment->text, MEMORY_INCLUDES);
+        freeMemory(segment->path, MEMORY_INCLUDES);
+        freeMemory(segment, MEMORY_INCLUDES);
+    }
+    for (macro = file->macros; macro != NULL; macro = nextMacro) {
+        nextMacro = macro->next;
+        if (macro->body[0] != '\0') /* an empty macro has a static body */
+            freeMemory(macro->body, MEMORY_INCLUDES);
+        freeMemory(macro, MEMORY_INCLUDES);
+    }
+    freeMemory(file, MEMORY_INCLUDES);
+}
+
+/**
+ * Drops an included file from the included files of the run, so that its next use reads it again.
+ * The files that include it are dropped too, since they hold its macros.
+ * Must not be called while a source file is being preprocessed.
+ * @param path The resolved path of the included file.
+ */
+void forgetIncludedFile (const char *path) {
+    pthread_mutex_lock(&includeCacheLock);
+    dropIncludedFile(path);
+    pthread_mutex_unlock(&includeCacheLock);
+}
+
+/**
+ * Writes the lines of an included file (and the files it includes) into the output, and adds its macros.
+ * @param path The resolved path of the included file.
+ * @param fileAm Pointer to the output file.
+ * @param macroTable The macros of the source file.
+ * @param state The files included by the source file.
+ * @param lineNumber The number of the '.include' line in the source file.
+ * @return TRUE if successful, FALSE otherwise.
+ */
+static boolean includeFile (const char *path, FILE *fileAm, macro_table *macroTable, include_state *state, int lineNumber) {
+    included_file *file;
+    include_segment *segment;
+    included_macro *macro;
+    boolean success = TRUE;
+    int i;
+
+    for (i = 0; i < state->depth; i++) {
+        if (strcmp(state->stack[i], path) == 0) {
+            printError("Include cycle: the file includes itself.", lineNumber);
+            return FALSE;
+        }
+    }
+    for (i = 0; i < state->includedCount; i++) {
+        if (strcmp(state->included[i], path) == 0) /* include guard: a file is included once */
+            return TRUE;
+    }
+    if (state->includedCount == MAX_INCLUDED_FILES) {
+        printError("Too many included files.", lineNumber);
+        return FALSE;
+    }
+    file = getIncludedFile(path);
+    if (file == NULL || file->valid == FALSE) {
+        printError("Could not include file.", lineNumber);
+        return FALSE;
+    }
+
+    TRACE_BEGIN("include", file->path);
+    state->included[state->includedCount++] = file->path;
+    state->stack[state->depth++] = file->path;
+    for (segment = file->segments; segment != NULL && success == TRUE; segment = segment->next) {
+        if (segment->path != NULL)
+            success = includeFile(segment->path, fileAm, macroTable, state, lineNumber);
+        else
+            fputs(segment->text, fileAm);
+    }
+    state->depth--;
+
+    for (macro = file->macros; macro != NULL && success == TRUE; macro = macro->next) {
+        if (findMacro(macroTable, macro->name) != NULL) {
+            printError("Macro of included file is already defined.", lineNumber);
+            success = FALSE;
+        } else {
+            success = addMacro(macroTable, macro->name, 0, 0, macro->body, lineNumber);
+        }
+    }
+    TRACE_END("include");
+    return success;
+}
+
+/**
+ * Preprocesses a range of a source file, expanding macros and included files and removing comment lines.
+ * @param fileAs Pointer to the source file.
+ * @param fileAm Pointer to the output file.
+ * @param as_offset_start The start offset in the source file.
+ * @param as_offset_end The end offset in the source file.
+ * @param includes The files included by the source file.
+ * @return TRUE if an error was found, FALSE otherwise.
+ */
+static boolean preprocessLines (FILE* fileAs, FILE* fileAm, long int as_offset_start, long int as_offset_end, include_state *includes) {
+    char buffer[MAX_LINE_LENGTH+1]; /* add one extra space for NULL ending */
+    char *current; /* index of current char in buffer */
+    int lineLength, lineNumber = 0;
+    boolean insideMacro = FALSE;
+    boolean errorFlag = FALSE;
+    char macroName[MAX_LINE_LENGTH+1];
+    char macroToSearch[MAX_LINE_LENGTH+1];
+    char includePath[MAX_LINE_LENGTH+1], resolvedPath[MAX_INCLUDE_PATH_LENGTH+1];
+    long int offset_start, offset_end, asOffsetOriginal;
+    macro_table macros_table;
+    macro_entry *entry;
+    macros_table.macros = NULL;
+    
+    asOffsetOriginal = ftell(fileAs);
+    fseek(fileAs, as_offset_start, SEEK_SET);
+    /* loop over every line in source file */
+    while (fgets(buffer, sizeof(buffer), fileAs) != NULL && ftell(fileAs) <= as_offset_end) {
+        lineNumber++;
+        
+        /* skip all spaces */
+        current = buffer;
+        while (isspace(*current)) {
+            current++;
+        }
+
+        lineLength = strlen(current); /* length with \n */
+        
+        if ((lineLength == 1) && (*current == '\n')) { /* check if is an empty line */
+            continue;
+        }
+
+        if ((lineLength >= 2) && (*current == ';')) { /* comment line, or at least ';\n' */
+            continue;
+        }       
+
+        /* remove trailing \n and whitespaces */
+        strcpy(macroToSearch, current); 
+        strtrim(macroToSearch);
+
+        /* check if line is a macro */
+        entry = findMacro(&macros_table, macroToSearch);
+
+        if (entry != NULL) { /* if macro is found */
+            STATS_COUNT(macrosExpanded);
+            /* write macro contents into file instead of continuing to read the line */
+            TRACE_BEGIN("macro expansion", entry->macro.name);
+            if (entry->macro.body != NULL) /* a macro of an included file is already preprocessed */
+                fputs(entry->macro.body, fileAm);
+            else
+                preprocessLines(fileAs, fileAm, entry->macro.offset_start, entry->macro.offset_end, includes);
+            TRACE_END("macro expansion");
+        } else if (insideMacro == TRUE) { /* if is inside macro */
+            /* if found 'endmcro' */
+            if (strncmp(current, MACRO_END, strlen(MACRO_END)) == 0)  { 
+                if (isValidMacroEnd(current) == FALSE) { /* check if there are other characters on the line */
+                    printError("No characters allowed on line after 'endmcro' flag.", lineNumber);
+                    errorFlag = TRUE;
+                    break;
+                }
+                insideMacro = FALSE;
+                if (addMacro(&macros_table, macroName, offset_start, offset_end, NULL, lineNumber) == FALSE) { /* error trying to add macro */
+                    errorFlag = TRUE;
+                    break;
+                }
+
+            }
+        } else { /* if is outside macro */
+            if (parseInclude(current, includePath) == TRUE) { /* '.include "file"' */
+                if (includePath[0] == '\0') {
+                    printError("Invalid '.include', expecting a file name in quotes.", lineNumber);
+                    errorFlag = TRUE;
+                    break;
+                }
+                if (resolveIncludePath(includes->sourcePath, includePath, resolvedPath) == FALSE) {
+                    printError("The path of the included file is too long.", lineNumber);
+                    errorFlag = TRUE;
+                    break;
+                }
+                if (includeFile(resolvedPath, fileAm, &macros_table, includes, lineNumber) == FALSE) {
+                    errorFlag = TRUE;
+                    break;
+                }
+            /* if line starts with MACRO_START flag */
+            } else if ((lineLength - 1 >= strlen(MACRO_START)) && (strncmp(current, MACRO_START, strlen(MACRO_START)) == 0)) {
+                insideMacro = TRUE;
+                strcpy(macroName, strtrim(current + strlen(MACRO_START)));
+
+                /* check if macro name is valid, and if its not already defined */
+                if (isValidMacroName(macroName) == FALSE) {
+                    printError ("Macro name is invalid (keywords are not allowed).", lineNumber);
+                    errorFlag = TRUE;
+                    break;
+                }
+     
+                /* check if macro is already defiend */
+                if (findMacro(&macros_table, macroName) != NULL) {
+                    printError("Macro is already defined.", lineNumber);
+                    errorFlag = TRUE;
+                    break;
+                }
+                
+                offset_start = ftell(fileAs);
+            } else { /* if is a regular line */
+                fputs(buffer, fileAm); /* copy line as it is to .am */
+            }
+        }
+        offset_end = ftell(fileAs);
+    }
+    
+    fseek(fileAs, asOffsetOriginal, SEEK_SET);
+    freeTable(macros_table.macros);
+    return errorFlag;
+}
+
+/**
+ * Preprocesses a source file, expanding macros and included files and removing comment lines.
+ * @param fileAs Pointer to the source file.
+ * @param fileAm Pointer to the output file.
+ * @param as_offset_start The start offset in the source file.
+ * @param as_offset_end The end offset in the source file.
+ * @param sourcePath The path (or base name) of the source file, whose directory the included files are relative to.
+ * @return TRUE if preprocessing is successful, FALSE otherwise.
+ */
+boolean preprocessFile(FILE* fileAs, FILE* fileAm, long int as_offset_start, long int as_offset_end, const char *sourcePath) {
+    include_state includes;
+    includes.sourcePath = sourcePath;
+    includes.includedCount = 0;
+    includes.depth = 0;
+    return preprocessLines(fileAs, fileAm, as_offset_start, as_offset_end, &includes);
+}
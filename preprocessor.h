@@ -1,17 +1,45 @@
-#ifndef PREPROCESSOR_H
-#define PREPROCESSOR_H
-
-#include "utils.h"
-#include <stdio.h>
-
-/**
- * Preprocesses a source file, expanding macros and removing comment lines.
- * @param fileAs Pointer to the source file.
- * @param fileAm Pointer to the output file.
- * @param as_offset_start The start offset in the source file.
- * @param as_offset_end The end offset in the source file.
- * @return TRUE if preprocessing is successful, FALSE otherwise.
- */
-boolean preprocessFile(FILE* fileAs, FILE* fileAm, long int as_offset_start, long int as_offset_end);
-
+#ifndef PREPROCESSOR_H
+#define PREPROCESSOR_H
+
+#include "utils.h"
+#include <stdio.h>
+
+#define MAX_INCLUDE_PATH_LENGTH 255 /* an included file's path, after adding the directory of the file that includes it */
+
+/**
+ * Preprocesses a source file, expanding macros and included files and removing comment lines.
+ * @param fileAs Pointer to the source file.
+ * @param fileAm Pointer to the output file.
+ * @param as_offset_start The start offset in the source file.
+ * @param as_offset_end The end offset in the source file.
+ * @param sourcePath The path (or base name) of the source file, whose directory the included files are relative to.
+ * @return TRUE if preprocessing is successful, FALSE otherwise.
+ */
+boolean preprocessFile(FILE* fileAs, FILE* fileAm, long int as_offset_start, long int as_offset_end, const char *sourcePath);
+
+/**
+ * Checks if a line is an '.include "file"' line, and reads the name of the included file.
+ * @param line The line to check.
+ * @param path Receives the name of the included file (at least MAX_LINE_LENGTH + 1 characters), empty if it is malformed.
+ * @return TRUE if the line is an '.include' line, FALSE otherwise.
+ */
+boolean parseInclude(const char *line, char *path);
+
+/**
+ * Resolves the name in an '.include' line against the directory of the file that has the line.
+ * @param includer The path (or base name) of the including file.
+ * @param path The name in the '.include' line.
+ * @param resolved Receives the path of the included file (at least MAX_INCLUDE_PATH_LENGTH + 1 characters).
+ * @return TRUE if successful, FALSE if the path is longer than MAX_INCLUDE_PATH_LENGTH.
+ */
+boolean resolveIncludePath(const char *includer, const char *path, char *resolved);
+
+/**
+ * Drops an included file from the included files of the run, so that its next use reads it again.
+ * The files that include it are dropped too, since they hold its macros.
+ * Must not be called while a source file is being preprocessed.
+ * @param path The resolved path of the included file.
+ */
+void forgetIncludedFile(const char *path);
+
 #endif /* PREPROCESSOR_H */
\ No newline at end of file
@@ -1,37 +1,75 @@
-#include <stdio.h>
-#include <stdarg.h>
-
-#include "print.h"
-int counter = 0;
-
- /*prints a message to a specified file along with the line number and additional formatted arguments*/
-void printDebug (char *fileName, int lineNumber, const char *format, ...) {
-    va_list args;
-    printf("%02d: \033[1;35mDEBUG  \033[0m - \033[1;36m%s:%d\033[0m: ", counter, fileName, lineNumber); 
-    va_start(args, format);
-    vprintf(format, args);
-    va_end(args);
-    counter++;
-}
-
-/*prints a general warning message*/
-void printWarningGeneral (char *str) {
-    printf("\033[1;33mWARNING\033[0m - %s", str);
-}
-
-/*prints a general error message*/
-void printErrorGeneral(char *str) {
-    printf("\033[1;31mERROR  \033[0m - %s", str);
-}
-
-/*prints a warning message with a line number*/
-void printWarning (char *str, int lineNumber) {
-    printf("\033[1;33mWARNING\033[0m - \033[1;32mline #%d\033[0m: %s\n", lineNumber, str); 
-}
-
-/*prints an error message with a line number*/
-void printError (char *str, int lineNumber) {
-    printf("\033[1;31mERROR  \033[0m - \033[1;34mline #%d\033[0m: %s\n", lineNumber, str);
-}
-
-
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <pthread.h>
+
+#include "print.h"
+int counter = 0;
+static FILE *printStream = NULL; /* NULL stands for stdout, which is not a constant expression */
+static pthread_key_t threadStreamKey; /* a stream of the calling thread only, which overrides printStream */
+static pthread_once_t threadStreamOnce = PTHREAD_ONCE_INIT;
+
+/*creates the key of the per thread streams*/
+static void createThreadStreamKey (void) {
+    pthread_key_create(&threadStreamKey, NULL);
+}
+
+/*returns the stream that messages are printed to*/
+static FILE *getPrintStream (void) {
+    FILE *stream;
+    pthread_once(&threadStreamOnce, createThreadStreamKey);
+    stream = pthread_getspecific(threadStreamKey);
+    if (stream != NULL)
+        return stream;
+    return (printStream == NULL) ? stdout : printStream;
+}
+
+ /*prints a message to a specified file along with the line number and additional formatted arguments*/
+void printDebug (char *fileName, int lineNumber, const char *format, ...) {
+    va_list args;
+    fprintf(getPrintStream(), "%02d: \033[1;35mDEBUG  \033[0m - \033[1;36m%s:%d\033[0m: ", counter, fileName, lineNumber); 
+    va_start(args, format);
+    vfprintf(getPrintStream(), format, args);
+    va_end(args);
+    counter++;
+}
+
+/*prints a general warning message*/
+void printWarningGeneral (char *str) {
+    fprintf(getPrintStream(), "\033[1;33mWARNING\033[0m - %s", str);
+}
+
+/*prints a general error message*/
+void printErrorGeneral(char *str) {
+    fprintf(getPrintStream(), "\033[1;31mERROR  \033[0m - %s", str);
+}
+
+/*prints a warning message with a line number*/
+void printWarning (char *str, int lineNumber) {
+    fprintf(getPrintStream(), "\033[1;33mWARNING\033[0m - \033[1;32mline #%d\033[0m: %s\n", lineNumber, str); 
+}
+
+/*prints an error message with a line number*/
+void printError (char *str, int lineNumber) {
+    fprintf(getPrintStream(), "\033[1;31mERROR  \033[0m - \033[1;34mline #%d\033[0m: %s\n", lineNumber, str);
+}
+
+/*prints a plain formatted message*/
+void printMessage (const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    vfprintf(getPrintStream(), format, args);
+    va_end(args);
+}
+
+/*sets the stream that all messages are printed to*/
+void setPrintStream (FILE *stream) {
+    printStream = stream;
+}
+
+/*sets the stream that the messages of the calling thread are printed to*/
+void setThreadPrintStream (FILE *stream) {
+    pthread_once(&threadStreamOnce, createThreadStreamKey);
+    pthread_setspecific(threadStreamKey, stream);
+}
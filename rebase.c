@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "objfile.h"
+
+#define MAX_PATH_LENGTH 1024
+#define OBJ_LINE_LENGTH (BASE64_WORD_LENGTH + 1) /* every word of a '.obj' file is on a line of its own */
+
+/* The relocation table of a module: the base it was relocated for and the offsets of its relocatable words */
+typedef struct relocations {
+    int base;
+    int *offsets;
+    int count;
+} relocations;
+
+/**
+ * Builds the path of a file of a module.
+ * @param path Receives the path, at least MAX_PATH_LENGTH + 8 characters long.
+ * @param name The base name of the module.
+ * @param extension The extension of the file.
+ * @return path.
+ */
+static char *modulePath (char *path, const char *name, const char *extension) {
+    sprintf(path, "%.1000s%s", name, extension);
+    return path;
+}
+
+/**
+ * Reads the '.rel' file of a module.
+ * @param name The base name of the module.
+ * @param table Receives the relocations, whose offsets must be freed.
+ * @return TRUE if the file was read, FALSE otherwise.
+ */
+static boolean readRelocations (const char *name, relocations *table) {
+    char path[MAX_PATH_LENGTH + 8];
+    int capacity = 64, offset, *bigger;
+    FILE *file = fopen(modulePath(path, name, ".rel"), "r");
+
+    table->offsets = NULL;
+    table->count = 0;
+    if (file == NULL) {
+        fprintf(stderr, "rebase: cannot read '%s', was '%s' assembled by a version without relocation tables?\n", path, name);
+        return FALSE;
+    }
+    if (fscanf(file, "%d", &table->base) != 1 || (table->offsets = malloc(capacity * sizeof(int))) == NULL) {
+        fprintf(stderr, "rebase: '%s' is not a relocation table\n", path);
+        fclose(file);
+        return FALSE;
+    }
+    while (fscanf(file, "%d", &offset) == 1) {
+        if (table->count == capacity) {
+            capacity *= 2;
+            bigger = realloc(table->offsets, capacity * sizeof(int));
+            if (bigger == NULL) {
+                fprintf(stderr, "rebase: out of memory\n");
+                free(table->offsets);
+                fclose(file);
+                return FALSE;
+            }
+            table->offsets = bigger;
+        }
+        table->offsets[table->count++] = offset;
+    }
+    fclose(file);
+    return TRUE;
+}
+
+/**
+ * Writes the '.rel' file of a module.
+ * @param name The base name of the module.
+ * @param table The relocations.
+ * @return TRUE if the file was written, FALSE otherwise.
+ */
+static boolean writeRelocations (const char *name, relocations *table) {
+    char path[MAX_PATH_LENGTH + 8];
+    int i;
+    boolean written;
+    FILE *file = fopen(modulePath(path, name, ".rel"), "w");
+
+    if (file == NULL)
+        return FALSE;
+    fprintf(file, "%d\n", table->base);
+    for (i = 0; i < table->count; i++)
+        fprintf(file, "%d\n", table->offsets[i]);
+    written = (ferror(file) == 0);
+    return (fclose(file) == 0 && written);
+}
+
+/**
+ * Moves every address of a '.ent' or '.ext' file by the same amount.
+ * @param name The base name of the module.
+ * @param extension The extension of the file.
+ * @param separator What is written between the label and the address, as the assembler writes it.
+ * @param delta The amount to move the addresses by.
+ * @return TRUE if the file was rewritten or does not exist, FALSE otherwise.
+ */
+static boolean rebaseSymbolFile (const char *name, const char *extension, const char *separator, int delta) {
+    char path[MAX_PATH_LENGTH + 8], tempPath[MAX_PATH_LENGTH + 16], label[MAX_LABEL_LENGTH+1];
+    int address;
+    boolean written;
+    FILE *file = fopen(modulePath(path, name, extension), "r"), *temp;
+
+    if (file == NULL) /* a module without '.entry' labels, or that uses no external labels */
+        return TRUE;
+    sprintf(tempPath, "%s.tmp", path);
+    temp = fopen(tempPath, "w");
+    if (temp == NULL) {
+        fclose(file);
+        return FALSE;
+    }
+    while (readSymbolLine(file, label, &address) == TRUE)
+        fprintf(temp, "%s%s%d\n", label, separator, address + delta);
+    written = (ferror(temp) == 0);
+    fclose(file);
+    if (fclose(temp) != 0 || written == FALSE || rename(tempPath, path) != 0) {
+        remove(tempPath);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * Reads the relocatable word at an offset of the code of an open '.obj' file.
+ * @param file The '.obj' file.
+ * @param header The length of the header line.
+ * @param offset The offset of the word from the start of the code.
+ * @return The word, or -1 if it cannot be read.
+ */
+static int readWordAt (FILE *file, long header, int offset) {
+    char chars[BASE64_WORD_LENGTH];
+    if (fseek(file, header + (long) offset * OBJ_LINE_LENGTH, SEEK_SET) != 0 ||
+        fread(chars, 1, BASE64_WORD_LENGTH, file) != BASE64_WORD_LENGTH)
+        return -1;
+    return base64ToWord(chars);
+}
+
+/**
+ * Moves a module to a new base: patches the relocatable words of its '.obj' file in place, and moves the addresses
+ * of its '.rel', '.ent' and '.ext' files. All the relocations are checked before anything is written.
+ * @param name The base name of the module.
+ * @param base The new base address.
+ * @return TRUE if the module was moved, FALSE otherwise.
+ */
+static boolean rebaseModule (const char *name, int base) {
+    char path[MAX_PATH_LENGTH + 8], chars[BASE64_WORD_LENGTH];
+    relocations table;
+    int IC, DC, i, word, delta, c;
+    long header;
+    boolean success = TRUE;
+    FILE *file;
+
+    if (readRelocations(name, &table) == FALSE)
+        return FALSE;
+    delta = base - table.base;
+    file = fopen(modulePath(path, name, ".obj"), "r+b");
+    if (file == NULL || fscanf(file, "%d %d", &IC, &DC) != 2) {
+        fprintf(stderr, "rebase: cannot read '%s'\n", path);
+        if (file != NULL)
+            fclose(file);
+        free(table.offsets);
+        return FALSE;
+    }
+    while ((c = fgetc(file)) != EOF && c != '\n')
+        ;
+    header = ftell(file);
+    if (base + IC + DC > MAX_ADDRESS + 1) {
+        fprintf(stderr, "rebase: the %d words of '%s' do not fit in memory at %d\n", IC + DC, name, base);
+        success = FALSE;
+    }
+
+    /* every relocation must be a relocatable word of the code that stays in range, or nothing is changed */
+    for (i = 0; i < table.count && success == TRUE; i++) {
+        word = (table.offsets[i] >= 0 && table.offsets[i] < IC) ? readWordAt(file, header, table.offsets[i]) : -1;
+        if (word < 0 || WORD_ARE(word) != ARE_RELOCATABLE) {
+            fprintf(stderr, "rebase: relocation %d of '%s' is not a relocatable word of the code\n", table.offsets[i], name);
+            success = FALSE;
+        } else if ((int) WORD_OPERAND(word) + delta < 0 || (int) WORD_OPERAND(word) + delta > MAX_ADDRESS) {
+            fprintf(stderr, "rebase: the address at %d of '%s' does not fit at %d\n", table.offsets[i], name, base);
+            success = FALSE;
+        }
+    }
+
+    for (i = 0; i < table.count && success == TRUE && delta != 0; i++) {
+        word = readWordAt(file, header, table.offsets[i]);
+        wordToBase64(MAKE_OPERAND_WORD(WORD_OPERAND(word) + delta, ARE_RELOCATABLE), chars);
+        if (fseek(file, header + (long) table.offsets[i] * OBJ_LINE_LENGTH, SEEK_SET) != 0 ||
+            fwrite(chars, 1, BASE64_WORD_LENGTH, file) != BASE64_WORD_LENGTH)
+            success = FALSE;
+    }
+    if (fclose(file) != 0)
+        success = FALSE;
+
+    if (success == TRUE && delta != 0) {
+        table.base = base;
+        success = writeRelocations(name, &table) && rebaseSymbolFile(name, ".ent", "\t", delta) &&
+                  rebaseSymbolFile(name, ".ext", "\t ", delta);
+        if (success == FALSE)
+            fprintf(stderr, "rebase: writing the files of '%s' failed\n", name);
+    }
+    free(table.offsets);
+    return success;
+}
+
+int main (int argc, char *argv[]) {
+    char *end;
+    long base;
+    int i, failed = 0;
+
+    if (argc < 4 || strcmp(argv[1], "-b") != 0) {
+        fprintf(stderr, "usage: rebase -b <base address> <module>...\n");
+        return 1;
+    }
+    base = strtol(argv[2], &end, 10);
+    if (end == argv[2] || *end != '\0' || base < 0 || base > MAX_ADDRESS) {
+        fprintf(stderr, "rebase: invalid base address '%s' (0 to %d)\n", argv[2], MAX_ADDRESS);
+        return 1;
+    }
+    for (i = 3; i < argc; i++) {
+        if (rebaseModule(argv[i], (int) base) == FALSE)
+            failed++;
+    }
+    return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,608 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "utils.h"
+#include "objfile.h"
+
+#define MEMORY_SIZE 1024 /* addresses are 10 bits */
+#define NUM_OF_REGISTERS 8
+#define MAX_STACK_DEPTH 1024
+#define WORD_MASK 0xFFF
+#define DEFAULT_INSTRUCTION_LIMIT 100000000L
+#define MAX_PATH_LENGTH 1024
+
+/* the fast loop jumps straight from one instruction to the next where the compiler supports it */
+#if defined(__GNUC__) && !defined(NO_COMPUTED_GOTO)
+#define USE_COMPUTED_GOTO
+#endif
+
+/* opcodes, in the order of instructions[] */
+enum {
+    OP_MOV, OP_CMP, OP_ADD, OP_SUB, OP_NOT, OP_CLR, OP_LEA, OP_INC,
+    OP_DEC, OP_JMP, OP_BNE, OP_RED, OP_PRN, OP_JSR, OP_RTS, OP_STOP,
+    OP_END_OF_CODE /* placed after the last decoded instruction */
+};
+
+/* How a run of the program ended */
+typedef enum {
+    RUN_STOPPED, /* reached 'stop' */
+    RUN_LIMIT, /* executed the maximum number of instructions */
+    RUN_ERROR /* jumped outside the code, overflowed the stack, etc. */
+} run_result;
+
+/* The registers, memory and I/O of the machine */
+typedef struct machine_state {
+    int registers[NUM_OF_REGISTERS]; /* 12-bit values */
+    int memory[MEMORY_SIZE]; /* 12-bit values */
+    int base; /* the address the code was loaded at */
+    boolean zero; /* set by 'cmp' when both operands are equal, tested by 'bne' */
+    int stack[MAX_STACK_DEPTH]; /* return addresses of 'jsr' */
+    int stackDepth;
+    long executed; /* instructions executed so far */
+    FILE *input; /* read by 'red', NULL for end of file */
+    FILE *output; /* written by 'prn' */
+} machine_state;
+
+/* An instruction decoded once before the program runs */
+typedef struct decoded_instruction {
+    int opcode;
+    int *src; /* the source operand: a register, a memory word, or srcValue */
+    int *dst; /* the destination operand: a register, a memory word, or dstValue */
+    int srcValue; /* an immediate source, or the address loaded by 'lea' */
+    int dstValue; /* an immediate destination */
+    int jumpAddress; /* the address a direct jump goes to, -1 for a register jump */
+    int target; /* index of the instruction at jumpAddress, -1 for a register jump */
+    int address;
+    int size; /* in words */
+} decoded_instruction;
+
+/* A program decoded for the fast loop */
+typedef struct decoded_program {
+    decoded_instruction *instructions; /* followed by an OP_END_OF_CODE instruction */
+    int count;
+    int instructionAt[MEMORY_SIZE]; /* index of the instruction that starts at an address, -1 if none */
+} decoded_program;
+
+/**
+ * Reads the monotonic clock.
+ * @return The time in seconds since an arbitrary fixed point.
+ */
+static double now (void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Sign extends a 12-bit word.
+ * @param value The word.
+ * @return Its value as a signed number.
+ */
+static int toSigned (int value) {
+    return (value & 0x800) ? (value | ~WORD_MASK) : value;
+}
+
+/**
+ * Returns the number of operands of an opcode.
+ * @param opcode The opcode.
+ * @return 0, 1 or 2.
+ */
+static int operandCount (int opcode) {
+    if (opcode <= OP_SUB || opcode == OP_LEA)
+        return 2;
+    if (opcode >= OP_RTS)
+        return 0;
+    return 1;
+}
+
+/**
+ * Loads a '.obj' file into memory at the base it was assembled at: the code first, then the data.
+ * @param state The machine to load into, which is reset first.
+ * @param object The contents of the '.obj' file.
+ * @param base The base address of the program, which must leave room for all its words.
+ */
+static void loadProgram (machine_state *state, object_file *object, int base) {
+    int i;
+    memset(state, 0, sizeof(machine_state));
+    state->base = base;
+    for (i = 0; i < object->IC + object->DC; i++)
+        state->memory[base + i] = object->words[i];
+}
+
+/**
+ * Converts a 10-bit immediate operand to a 12-bit word.
+ * @param operand The operand, in two's complement.
+ * @return The sign extended word.
+ */
+static int immediateToWord (int operand) {
+    return ((operand & 0x200) ? (operand | ~0x3FF) : operand) & WORD_MASK;
+}
+
+/**
+ * Finds an operand of an instruction.
+ * @param state The machine.
+ * @param mode The addressing mode of the operand.
+ * @param word The extra word that holds the operand.
+ * @param isSource TRUE for the source operand, whose register is in the high bits of a register word.
+ * @param value Where an immediate operand is kept.
+ * @return A pointer to the operand, or NULL if the word cannot be an operand.
+ */
+static int *findOperand (machine_state *state, int mode, int word, boolean isSource, int *value) {
+    switch (mode) {
+        case ADDRESSING_MODE_IMMEDIATE:
+            *value = immediateToWord(WORD_OPERAND(word));
+            return value;
+        case ADDRESSING_MODE_DIRECT:
+            if (WORD_ARE(word) == ARE_EXTERNAL) /* the program was not linked */
+                return NULL;
+            return &state->memory[WORD_OPERAND(word)];
+        case ADDRESSING_MODE_REGISTER:
+            return &state->registers[(isSource ? WORD_SRC_REGISTER(word) : WORD_DST_REGISTER(word)) % NUM_OF_REGISTERS];
+    }
+    return NULL;
+}
+
+/**
+ * Decodes the instruction at an address of the memory.
+ * @param state The machine.
+ * @param address The address of the first word of the instruction.
+ * @param codeEnd The address after the last code word.
+ * @param instruction Receives the decoded instruction, whose operands point into state.
+ * @return TRUE if the words are a valid instruction, FALSE otherwise.
+ */
+static boolean decodeAt (machine_state *state, int address, int codeEnd, decoded_instruction *instruction) {
+    int first = state->memory[address];
+    int srcMode = WORD_SRC_AM(first), dstMode = WORD_DST_AM(first);
+    int next = address + 1;
+
+    instruction->opcode = WORD_OP_CODE(first);
+    instruction->address = address;
+    instruction->src = instruction->dst = NULL;
+    instruction->jumpAddress = instruction->target = -1;
+
+    if (operandCount(instruction->opcode) == 2) {
+        if (next >= codeEnd)
+            return FALSE;
+        instruction->src = findOperand(state, srcMode, state->memory[next], TRUE, &instruction->srcValue);
+        if (instruction->opcode == OP_LEA && srcMode == ADDRESSING_MODE_DIRECT && instruction->src != NULL) {
+            instruction->srcValue = WORD_OPERAND(state->memory[next]); /* 'lea' loads the address itself */
+            instruction->src = &instruction->srcValue;
+        }
+        /* two register operands share a single word */
+        if (!(srcMode == ADDRESSING_MODE_REGISTER && dstMode == ADDRESSING_MODE_REGISTER))
+            next++;
+        if (instruction->src == NULL)
+            return FALSE;
+    }
+    if (operandCount(instruction->opcode) >= 1) {
+        if (next >= codeEnd)
+            return FALSE;
+        instruction->dst = findOperand(state, dstMode, state->memory[next], FALSE, &instruction->dstValue);
+        if (instruction->dst == NULL)
+            return FALSE;
+        if (dstMode == ADDRESSING_MODE_DIRECT && (instruction->opcode == OP_JMP || instruction->opcode == OP_BNE ||
+                                                  instruction->opcode == OP_JSR))
+            instruction->jumpAddress = WORD_OPERAND(state->memory[next]);
+        next++;
+    }
+    instruction->size = next - address;
+    return TRUE;
+}
+
+/**
+ * Decodes every instruction of the loaded code once.
+ * @param state The loaded machine.
+ * @param IC The number of code words.
+ * @param program Receives the decoded instructions, which must be freed.
+ * @return TRUE if all the code is valid, FALSE otherwise.
+ */
+static boolean predecode (machine_state *state, int IC, decoded_program *program) {
+    int i, address, codeEnd = state->base + IC;
+    decoded_instruction *instruction;
+
+    program->instructions = malloc((IC + 1) * sizeof(decoded_instruction));
+    if (program->instructions == NULL) {
+        fprintf(stderr, "simulator: out of memory\n");
+        return FALSE;
+    }
+    for (i = 0; i < MEMORY_SIZE; i++)
+        program->instructionAt[i] = -1;
+    program->count = 0;
+    for (address = state->base; address < codeEnd; address += instruction->size) {
+        instruction = &program->instructions[program->count];
+        if (decodeAt(state, address, codeEnd, instruction) == FALSE) {
+            fprintf(stderr, "simulator: invalid or unlinked instruction at address %d\n", address);
+            free(program->instructions);
+            return FALSE;
+        }
+        program->instructionAt[address] = program->count++;
+    }
+    program->instructions[program->count].opcode = OP_END_OF_CODE;
+    program->instructions[program->count].address = codeEnd;
+
+    /* direct jumps go straight to the decoded instruction */
+    for (i = 0; i < program->count; i++) {
+        instruction = &program->instructions[i];
+        if (instruction->jumpAddress < 0)
+            continue;
+        instruction->target = program->instructionAt[instruction->jumpAddress];
+        if (instruction->target < 0) {
+            fprintf(stderr, "simulator: jump at address %d to %d, which is not an instruction\n",
+                    instruction->address, instruction->jumpAddress);
+            free(program->instructions);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * Reads the next input character for 'red'.
+ * @param state The machine.
+ * @return The character as a word, or -1 as a word at the end of the input.
+ */
+static int readInput (machine_state *state) {
+    int c = (state->input != NULL) ? getc(state->input) : EOF;
+    return (c == EOF) ? WORD_MASK : (c & WORD_MASK);
+}
+
+#ifdef USE_COMPUTED_GOTO
+/* labels as values and 'goto *' are GNU extensions, allowed in runDecoded only */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+/**
+ * Runs a decoded program from its first instruction, dispatching each instruction straight to the next.
+ * @param state The loaded machine the program was decoded from.
+ * @param program The decoded program.
+ * @param limit The maximum number of instructions to execute.
+ * @return How the run ended.
+ */
+static run_result runDecoded (machine_state *state, decoded_program *program, long limit) {
+    decoded_instruction *instruction = NULL;
+    long remaining = limit;
+    int pc = 0, address;
+#ifdef USE_COMPUTED_GOTO
+    static void *dispatchTable[] = {
+        &&OP_MOV_LABEL, &&OP_CMP_LABEL, &&OP_ADD_LABEL, &&OP_SUB_LABEL, &&OP_NOT_LABEL, &&OP_CLR_LABEL,
+        &&OP_LEA_LABEL, &&OP_INC_LABEL, &&OP_DEC_LABEL, &&OP_JMP_LABEL, &&OP_BNE_LABEL, &&OP_RED_LABEL,
+        &&OP_PRN_LABEL, &&OP_JSR_LABEL, &&OP_RTS_LABEL, &&OP_STOP_LABEL, &&OP_END_OF_CODE_LABEL
+    };
+#define OPERATION(op) op##_LABEL
+#define DISPATCH() do { \
+        if (remaining-- == 0) goto limitReached; \
+        instruction = &program->instructions[pc]; \
+        goto *dispatchTable[instruction->opcode]; \
+    } while (0)
+#else
+#define OPERATION(op) case op
+#define DISPATCH() goto dispatch
+#endif
+#define NEXT() do { pc++; DISPATCH(); } while (0)
+#define JUMP_TO_ADDRESS(value) do { \
+        address = (value); \
+        pc = (address < MEMORY_SIZE) ? program->instructionAt[address] : -1; \
+        if (pc < 0) goto badJump; \
+        DISPATCH(); \
+    } while (0)
+
+#ifdef USE_COMPUTED_GOTO
+    DISPATCH();
+#else
+dispatch:
+    if (remaining-- == 0)
+        goto limitReached;
+    instruction = &program->instructions[pc];
+    switch (instruction->opcode) {
+#endif
+    OPERATION(OP_MOV):
+    OPERATION(OP_LEA):
+        *instruction->dst = *instruction->src;
+        NEXT();
+    OPERATION(OP_CMP):
+        state->zero = (*instruction->src == *instruction->dst);
+        NEXT();
+    OPERATION(OP_ADD):
+        *instruction->dst = (*instruction->dst + *instruction->src) & WORD_MASK;
+        NEXT();
+    OPERATION(OP_SUB):
+        *instruction->dst = (*instruction->dst - *instruction->src) & WORD_MASK;
+        NEXT();
+    OPERATION(OP_NOT):
+        *instruction->dst = ~*instruction->dst & WORD_MASK;
+        NEXT();
+    OPERATION(OP_CLR):
+        *instruction->dst = 0;
+        NEXT();
+    OPERATION(OP_INC):
+        *instruction->dst = (*instruction->dst + 1) & WORD_MASK;
+        NEXT();
+    OPERATION(OP_DEC):
+        *instruction->dst = (*instruction->dst - 1) & WORD_MASK;
+        NEXT();
+    OPERATION(OP_BNE):
+        if (state->zero == TRUE)
+            NEXT();
+        /* fall through */
+    OPERATION(OP_JMP):
+        if (instruction->target >= 0) {
+            pc = instruction->target;
+            DISPATCH();
+        }
+        JUMP_TO_ADDRESS(*instruction->dst);
+    OPERATION(OP_RED):
+        *instruction->dst = readInput(state);
+        NEXT();
+    OPERATION(OP_PRN):
+        fprintf(state->output, "%d\n", toSigned(*instruction->dst));
+        NEXT();
+    OPERATION(OP_JSR):
+        if (state->stackDepth == MAX_STACK_DEPTH) {
+            fprintf(stderr, "simulator: stack overflow at address %d\n", instruction->address);
+            goto failed;
+        }
+        state->stack[state->stackDepth++] = instruction->address + instruction->size;
+        if (instruction->target >= 0) {
+            pc = instruction->target;
+            DISPATCH();
+        }
+        JUMP_TO_ADDRESS(*instruction->dst);
+    OPERATION(OP_RTS):
+        if (state->stackDepth == 0) {
+            fprintf(stderr, "simulator: 'rts' with an empty stack at address %d\n", instruction->address);
+            goto failed;
+        }
+        JUMP_TO_ADDRESS(state->stack[--state->stackDepth]);
+    OPERATION(OP_STOP):
+        state->executed += limit - remaining;
+        return RUN_STOPPED;
+    OPERATION(OP_END_OF_CODE):
+        fprintf(stderr, "simulator: ran past the end of the code\n");
+        goto failed;
+#ifndef USE_COMPUTED_GOTO
+    }
+#endif
+
+badJump:
+    fprintf(stderr, "simulator: jump at address %d to %d, which is not an instruction\n", instruction->address, address);
+failed:
+    state->executed += limit - remaining;
+    return RUN_ERROR;
+limitReached:
+    state->executed += limit;
+    return RUN_LIMIT;
+#undef OPERATION
+#undef DISPATCH
+#undef NEXT
+#undef JUMP_TO_ADDRESS
+}
+#ifdef USE_COMPUTED_GOTO
+#pragma GCC diagnostic pop
+#endif
+
+/**
+ * Runs a loaded program by decoding every instruction again each time it executes.
+ * This is the straightforward loop that the decoded loop is measured against.
+ * @param state The loaded machine.
+ * @param IC The number of code words.
+ * @param limit The maximum number of instructions to execute.
+ * @return How the run ended.
+ */
+static run_result runNaive (machine_state *state, int IC, long limit) {
+    decoded_instruction instruction;
+    int pc = state->base, codeEnd = state->base + IC;
+
+    for (; state->executed < limit; state->executed++) {
+        if (pc < state->base || pc >= codeEnd || decodeAt(state, pc, codeEnd, &instruction) == FALSE) {
+            fprintf(stderr, "simulator: no valid instruction at address %d\n", pc);
+            return RUN_ERROR;
+        }
+        pc += instruction.size;
+        switch (instruction.opcode) {
+            case OP_MOV:
+            case OP_LEA:
+                *instruction.dst = *instruction.src;
+                break;
+            case OP_CMP:
+                state->zero = (*instruction.src == *instruction.dst);
+                break;
+            case OP_ADD:
+                *instruction.dst = (*instruction.dst + *instruction.src) & WORD_MASK;
+                break;
+            case OP_SUB:
+                *instruction.dst = (*instruction.dst - *instruction.src) & WORD_MASK;
+                break;
+            case OP_NOT:
+                *instruction.dst = ~*instruction.dst & WORD_MASK;
+                break;
+            case OP_CLR:
+                *instruction.dst = 0;
+                break;
+            case OP_INC:
+                *instruction.dst = (*instruction.dst + 1) & WORD_MASK;
+                break;
+            case OP_DEC:
+                *instruction.dst = (*instruction.dst - 1) & WORD_MASK;
+                break;
+            case OP_BNE:
+                if (state->zero == TRUE)
+                    break;
+                /* fall through */
+            case OP_JMP:
+                pc = (instruction.jumpAddress >= 0) ? instruction.jumpAddress : *instruction.dst;
+                break;
+            case OP_RED:
+                *instruction.dst = readInput(state);
+                break;
+            case OP_PRN:
+                fprintf(state->output, "%d\n", toSigned(*instruction.dst));
+                break;
+            case OP_JSR:
+                if (state->stackDepth == MAX_STACK_DEPTH) {
+                    fprintf(stderr, "simulator: stack overflow at address %d\n", instruction.address);
+                    return RUN_ERROR;
+                }
+                state->stack[state->stackDepth++] = pc;
+                pc = (instruction.jumpAddress >= 0) ? instruction.jumpAddress : *instruction.dst;
+                break;
+            case OP_RTS:
+                if (state->stackDepth == 0) {
+                    fprintf(stderr, "simulator: 'rts' with an empty stack at address %d\n", instruction.address);
+                    return RUN_ERROR;
+                }
+                pc = state->stack[--state->stackDepth];
+                break;
+            case OP_STOP:
+                state->executed++;
+                return RUN_STOPPED;
+        }
+    }
+    return RUN_LIMIT;
+}
+
+/**
+ * Runs a program many times with both loops, checks that they end in the same state, and prints their speed.
+ * @param object The contents of the '.obj' file.
+ * @param base The base address of the program.
+ * @param repetitions The number of runs of every loop.
+ * @param limit The maximum number of instructions of every run.
+ * @return TRUE if both loops agree, FALSE otherwise.
+ */
+static boolean benchmark (object_file *object, int base, int repetitions, long limit) {
+    static machine_state decodedState, naiveState;
+    decoded_program program;
+    run_result decodedResult = RUN_ERROR, naiveResult = RUN_ERROR;
+    double start, decodeSeconds, decodedSeconds = 0, naiveSeconds = 0;
+    long decodedCount = 0, naiveCount = 0;
+    FILE *output = fopen("/dev/null", "w");
+    int i;
+
+    if (output == NULL)
+        output = stdout;
+    loadProgram(&decodedState, object, base);
+    start = now();
+    if (predecode(&decodedState, object->IC, &program) == FALSE)
+        return FALSE;
+    decodeSeconds = now() - start;
+
+    for (i = 0; i < repetitions; i++) {
+        /* reload in place: the decoded operands point into this state */
+        loadProgram(&decodedState, object, base);
+        decodedState.output = output;
+        start = now();
+        decodedResult = runDecoded(&decodedState, &program, limit);
+        decodedSeconds += now() - start;
+        decodedCount += decodedState.executed;
+
+        loadProgram(&naiveState, object, base);
+        naiveState.output = output;
+        start = now();
+        naiveResult = runNaive(&naiveState, object->IC, limit);
+        naiveSeconds += now() - start;
+        naiveCount += naiveState.executed;
+    }
+    free(program.instructions);
+    if (output != stdout)
+        fclose(output);
+
+    printf("%-10s %14s %10s %16s\n", "loop", "instructions", "seconds", "instructions/sec");
+    printf("%-10s %14ld %10.4f %16.0f\n", "decoded", decodedCount, decodedSeconds,
+           decodedSeconds > 0 ? decodedCount / decodedSeconds : 0);
+    printf("%-10s %14ld %10.4f %16.0f\n", "naive", naiveCount, naiveSeconds,
+           naiveSeconds > 0 ? naiveCount / naiveSeconds : 0);
+    printf("predecode %.6f seconds, speedup %.2fx\n", decodeSeconds,
+           decodedSeconds > 0 ? naiveSeconds / decodedSeconds : 0);
+
+    if (decodedResult != naiveResult || decodedCount != naiveCount || decodedState.zero != naiveState.zero ||
+        memcmp(decodedState.registers, naiveState.registers, sizeof(decodedState.registers)) != 0 ||
+        memcmp(decodedState.memory, naiveState.memory, sizeof(decodedState.memory)) != 0) {
+        fprintf(stderr, "simulator: the decoded and naive loops ended in different states\n");
+        return FALSE;
+    }
+    return TRUE;
+}
+
+int main (int argc, char *argv[]) {
+    static machine_state state;
+    char path[MAX_PATH_LENGTH + 8];
+    object_file object;
+    decoded_program program;
+    run_result result;
+    long limit = DEFAULT_INSTRUCTION_LIMIT;
+    int i, base, repetitions = 0;
+    boolean quiet = FALSE, valid = TRUE;
+    char *name = NULL;
+    double start, seconds;
+    FILE *file;
+
+    for (i = 1; i < argc && valid == TRUE; i++) {
+        if (strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+            limit = atol(argv[++i]);
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+            repetitions = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-q") == 0)
+            quiet = TRUE;
+        else if (name == NULL && argv[i][0] != '-')
+            name = argv[i];
+        else
+            valid = FALSE;
+    }
+    if (valid == FALSE || name == NULL || limit <= 0) {
+        fprintf(stderr, "usage: simulator [-l max instructions] [-b repetitions] [-q] <program>\n");
+        fprintf(stderr, "  runs <program>.obj, -b compares the decoded loop with a naive one\n");
+        return 1;
+    }
+
+    sprintf(path, "%.1000s.obj", name);
+    file = fopen(path, "r");
+    if (file == NULL || readObjectFile(file, &object) == FALSE) {
+        fprintf(stderr, "simulator: cannot read '%s'\n", path);
+        if (file != NULL)
+            fclose(file);
+        return 1;
+    }
+    fclose(file);
+
+    /* a program without a '.rel' file was assembled at the default base */
+    sprintf(path, "%.1000s.rel", name);
+    file = fopen(path, "r");
+    valid = readModuleBase(file, &base);
+    if (file != NULL)
+        fclose(file);
+    if (valid == FALSE || base + object.IC + object.DC > MEMORY_SIZE) {
+        fprintf(stderr, "simulator: '%s' does not hold a base address that fits the program\n", path);
+        freeObjectFile(&object);
+        return 1;
+    }
+
+    if (repetitions > 0) {
+        result = benchmark(&object, base, repetitions, limit) ? RUN_STOPPED : RUN_ERROR;
+        freeObjectFile(&object);
+        return (result == RUN_STOPPED) ? 0 : 1;
+    }
+
+    loadProgram(&state, &object, base);
+    state.input = stdin;
+    state.output = stdout;
+    start = now();
+    if (predecode(&state, object.IC, &program) == FALSE) {
+        freeObjectFile(&object);
+        return 1;
+    }
+    result = runDecoded(&state, &program, limit);
+    seconds = now() - start;
+    fflush(stdout);
+
+    if (result == RUN_LIMIT)
+        fprintf(stderr, "simulator: stopped after %ld instructions\n", limit);
+    if (quiet == FALSE)
+        fprintf(stderr, "Executed %ld instructions in %.6f seconds (%.0f instructions/sec)\n",
+                state.executed, seconds, seconds > 0 ? state.executed / seconds : 0);
+    free(program.instructions);
+    freeObjectFile(&object);
+    return (result == RUN_STOPPED) ? 0 : (result == RUN_LIMIT) ? 2 : 1;
+}
@@ -0,0 +1,152 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "stats.h"
+#include "utils.h"
+#include "print.h"
+
+/* time and counters of one file, or of all the files together */
+typedef struct file_stats {
+    double wall[NUM_OF_PHASES];
+    double cpu[NUM_OF_PHASES];
+    stats_counters counters;
+    int files;
+} file_stats;
+
+char *phaseNames[NUM_OF_PHASES] = {
+        "preprocess",
+        "parse",
+        "labels",
+        "optimize",
+        "relocate",
+        "write"
+};
+
+boolean statsEnabled = FALSE;
+stats_counters statsCounters;
+
+static file_stats currentFile;
+static file_stats total;
+static double phaseWallStart[NUM_OF_PHASES];
+static double phaseCpuStart[NUM_OF_PHASES];
+
+/**
+ * Reads a clock of the system.
+ * @param clock The clock to read.
+ * @return The time in seconds.
+ */
+static double readClock (clockid_t clock) {
+    struct timespec now;
+    if (clock_gettime(clock, &now) != 0)
+        return 0;
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Computes a rate, guarding against a zero time.
+ * @param amount The amount of work done.
+ * @param seconds The time it took.
+ * @return The amount per second, or 0 if no time was measured.
+ */
+static double perSecond (long amount, double seconds) {
+    return (seconds > 0) ? amount / seconds : 0;
+}
+
+/**
+ * Prints the times and counters of a file, or of the totals.
+ * @param stats The statistics to print.
+ */
+static void printStats (file_stats *stats) {
+    int phase;
+    double wall = 0, cpu = 0;
+
+    printMessage("  %-12s %12s %12s\n", "phase", "wall (ms)", "cpu (ms)");
+    for (phase = 0; phase < NUM_OF_PHASES; phase++) {
+        printMessage("  %-12s %12.3f %12.3f\n", phaseNames[phase], stats->wall[phase] * 1000, stats->cpu[phase] * 1000);
+        wall += stats->wall[phase];
+        cpu += stats->cpu[phase];
+    }
+    printMessage("  %-12s %12.3f %12.3f\n", "total", wall * 1000, cpu * 1000);
+    printMessage("  lines %ld, tokens %ld, macros expanded %ld, labels %ld, words %ld\n",
+                 stats->counters.lines, stats->counters.tokens, stats->counters.macrosExpanded,
+                 stats->counters.labels, stats->counters.words);
+    printMessage("  %.0f lines/sec, %.0f words/sec\n",
+                 perSecond(stats->counters.lines, wall), perSecond(stats->counters.words, wall));
+}
+
+/**
+ * Reads the monotonic clock.
+ * @return The time in seconds since an arbitrary fixed point.
+ */
+double monotonicSeconds (void) {
+    return readClock(CLOCK_MONOTONIC);
+}
+
+/**
+ * Reads the CPU time used by the calling thread.
+ * @return The CPU time in seconds.
+ */
+double cpuSeconds (void) {
+    return readClock(CLOCK_THREAD_CPUTIME_ID);
+}
+
+/**
+ * Starts timing a phase of the current file.
+ * @param phase The phase that starts.
+ */
+void statsPhaseBegin (phase_t phase) {
+    phaseWallStart[phase] = monotonicSeconds();
+    phaseCpuStart[phase] = cpuSeconds();
+}
+
+/**
+ * Stops timing a phase of the current file and adds the time to it.
+ * @param phase The phase that ends.
+ */
+void statsPhaseEnd (phase_t phase) {
+    currentFile.wall[phase] += monotonicSeconds() - phaseWallStart[phase];
+    currentFile.cpu[phase] += cpuSeconds() - phaseCpuStart[phase];
+}
+
+/**
+ * Resets the timers and counters before assembling a new file.
+ */
+void statsBeginFile (void) {
+    memset(&currentFile, 0, sizeof(currentFile));
+    memset(&statsCounters, 0, sizeof(statsCounters));
+}
+
+/**
+ * Prints the statistics of the current file and adds them to the totals.
+ * @param fileName The base name of the file.
+ */
+void statsEndFile (char *fileName) {
+    int phase;
+
+    currentFile.counters = statsCounters;
+    currentFile.files = 1;
+    printMessage("Statistics for file '%s':\n", fileName);
+    printStats(&currentFile);
+
+    for (phase = 0; phase < NUM_OF_PHASES; phase++) {
+        total.wall[phase] += currentFile.wall[phase];
+        total.cpu[phase] += currentFile.cpu[phase];
+    }
+    total.counters.lines += currentFile.counters.lines;
+    total.counters.tokens += currentFile.counters.tokens;
+    total.counters.macrosExpanded += currentFile.counters.macrosExpanded;
+    total.counters.labels += currentFile.counters.labels;
+    total.counters.words += currentFile.counters.words;
+    total.files++;
+}
+
+/**
+ * Prints the statistics of all the files assembled so far.
+ */
+void printStatsTotal (void) {
+    printMessage("Statistics for all %d files:\n", total.files);
+    printStats(&total);
+}
@@ -0,0 +1,91 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "utils.h"
+
+/* Phases of assembling a single file */
+typedef enum {
+    PHASE_PREPROCESS, /* preprocessFile */
+    PHASE_PARSE, /* the parseLine loop */
+    PHASE_LABELS, /* checkValidLabelsTables and checkAllLabelsDefined */
+    PHASE_OPTIMIZE, /* removeUnreachable, peepholeOptimize and poolData, only with their options */
+    PHASE_RELOCATE, /* updateAdressesAndWriteExtFile */
+    PHASE_WRITE, /* writeObjFile and writeEntFile */
+    NUM_OF_PHASES
+} phase_t;
+
+/* Counters of the work done while assembling a file */
+typedef struct stats_counters {
+    long lines;
+    long tokens;
+    long macrosExpanded;
+    long labels;
+    long words;
+} stats_counters;
+
+/* Names of the phases, as printed in reports */
+extern char *phaseNames[NUM_OF_PHASES];
+
+/* TRUE when --stats was given */
+extern boolean statsEnabled;
+
+/* Counters of the file currently being assembled */
+extern stats_counters statsCounters;
+
+/*
+ * The timers and counters are compiled out entirely when NO_STATS is defined.
+ * Otherwise the counters are always updated, and the timers only run when statsEnabled is TRUE.
+ */
+#ifdef NO_STATS
+#define STATS_BEGIN(phase)
+#define STATS_END(phase)
+#define STATS_COUNT(counter)
+#define STATS_ADD(counter, amount)
+#else
+#define STATS_BEGIN(phase) do { if (statsEnabled) statsPhaseBegin(phase); } while (0)
+#define STATS_END(phase) do { if (statsEnabled) statsPhaseEnd(phase); } while (0)
+#define STATS_COUNT(counter) (statsCounters.counter++)
+#define STATS_ADD(counter, amount) (statsCounters.counter += (amount))
+#endif
+
+/**
+ * Reads the monotonic clock.
+ * @return The time in seconds since an arbitrary fixed point.
+ */
+double monotonicSeconds(void);
+
+/**
+ * Reads the CPU time used by the calling thread.
+ * @return The CPU time in seconds.
+ */
+double cpuSeconds(void);
+
+/**
+ * Starts timing a phase of the current file.
+ * @param phase The phase that starts.
+ */
+void statsPhaseBegin(phase_t phase);
+
+/**
+ * Stops timing a phase of the current file and adds the time to it.
+ * @param phase The phase that ends.
+ */
+void statsPhaseEnd(phase_t phase);
+
+/**
+ * Resets the timers and counters before assembling a new file.
+ */
+void statsBeginFile(void);
+
+/**
+ * Prints the statistics of the current file and adds them to the totals.
+ * @param fileName The base name of the file.
+ */
+void statsEndFile(char *fileName);
+
+/**
+ * Prints the statistics of all the files assembled so far.
+ */
+void printStatsTotal(void);
+
+#endif /* STATS_H */
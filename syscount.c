@@ -0,0 +1,88 @@
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <signal.h>
+#include <unistd.h>
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#endif
+
+#define SYSCALL_STOP (SIGTRAP | 0x80) /* the stop signal of a system call with PTRACE_O_TRACESYSGOOD */
+
+/**
+ * Runs a command under ptrace and counts the system calls of all of its threads.
+ * @param argv The command and its arguments.
+ * @param calls Receives the number of system calls.
+ * @return The exit status of the command, or -1 if it could not be traced.
+ */
+static int countSystemCalls (char *argv[], long *calls) {
+#ifdef __linux__
+    pid_t child, pid;
+    int status, signal, exitStatus = -1;
+    long stops = 0;
+
+    child = fork();
+    if (child < 0)
+        return -1;
+    if (child == 0) {
+        ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+    /* the child stops at its exec, before its first system call of its own */
+    if (waitpid(child, &status, 0) < 0 || WIFSTOPPED(status) == 0 ||
+        ptrace(PTRACE_SETOPTIONS, child, NULL, (void *) (PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACECLONE | PTRACE_O_EXITKILL)) < 0)
+        return -1;
+    ptrace(PTRACE_SYSCALL, child, NULL, NULL);
+
+    while ((pid = waitpid(-1, &status, __WALL)) > 0) {
+        if (WIFEXITED(status) || WIFSIGNALED(status)) {
+            if (pid == child)
+                exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            continue;
+        }
+        signal = WSTOPSIG(status);
+        if (signal == SYSCALL_STOP)
+            stops++;
+        /* the events of new threads and their first stop are not passed on */
+        if (signal == SYSCALL_STOP || signal == SIGTRAP || signal == SIGSTOP)
+            signal = 0;
+        ptrace(PTRACE_SYSCALL, pid, NULL, (void *) (long) signal);
+    }
+    /* every system call stops on its way in and out, except the one that ends the process */
+    *calls = (stops + 1) / 2;
+    return exitStatus;
+#else
+    (void) argv;
+    *calls = 0;
+    return -1;
+#endif
+}
+
+int main (int argc, char *argv[]) {
+    long calls, files = 0;
+    int first = 1, status;
+
+    if (argc > 3 && strcmp(argv[1], "-n") == 0) {
+        files = atol(argv[2]);
+        first = 3;
+    }
+    if (first >= argc) {
+        fprintf(stderr, "usage: syscount [-n files] <command> [arguments]...\n");
+        return 1;
+    }
+    status = countSystemCalls(argv + first, &calls);
+    if (status < 0) {
+        fprintf(stderr, "syscount: cannot trace '%s' (ptrace is only supported on Linux)\n", argv[first]);
+        return 1;
+    }
+    if (files > 0)
+        fprintf(stderr, "%ld system calls, %.1f per file\n", calls, (double) calls / files);
+    else
+        fprintf(stderr, "%ld system calls\n", calls);
+    return status;
+}
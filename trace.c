@@ -0,0 +1,209 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "trace.h"
+#include "stats.h"
+#include "utils.h"
+#include "print.h"
+
+#define INITIAL_TRACE_EVENTS 256
+
+/* A single begin or end of a span */
+typedef struct trace_event {
+    const char *name;
+    char argument[MAX_TRACE_ARGUMENT_LENGTH+1]; /* adding one extra space for NULL ending */
+    char type; /* 'B' for begin, 'E' for end */
+    double timestamp; /* seconds since the trace started */
+} trace_event;
+
+/* The events of one thread - only that thread writes to it, so recording takes no lock */
+typedef struct trace_buffer {
+    trace_event *events;
+    int count;
+    int capacity;
+    int threadId;
+    const char *threadName;
+    struct trace_buffer *next;
+} trace_buffer;
+
+boolean traceEnabled = FALSE;
+
+static pthread_key_t bufferKey;
+static pthread_mutex_t buffersLock = PTHREAD_MUTEX_INITIALIZER;
+static trace_buffer *buffers = NULL; /* every buffer ever created, for writing them at exit */
+static int threadCount = 0;
+static double traceStart;
+
+/**
+ * Returns the buffer of the calling thread, creating it on first use.
+ * @return The buffer, or NULL if out of memory.
+ */
+static trace_buffer *getThreadBuffer (void) {
+    trace_buffer *buffer = pthread_getspecific(bufferKey);
+    if (buffer != NULL)
+        return buffer;
+
+    buffer = calloc(1, sizeof(trace_buffer));
+    if (buffer == NULL)
+        return NULL;
+    pthread_mutex_lock(&buffersLock);
+    buffer->threadId = ++threadCount;
+    buffer->next = buffers;
+    buffers = buffer;
+    pthread_mutex_unlock(&buffersLock);
+    pthread_setspecific(bufferKey, buffer);
+    return buffer;
+}
+
+/**
+ * Appends an event to the buffer of the calling thread.
+ * @param type 'B' for the begin of a span, 'E' for its end.
+ * @param name The name of the span.
+ * @param argument A file or macro name shown with the span, or NULL.
+ */
+static void recordEvent (char type, const char *name, const char *argument) {
+    trace_buffer *buffer = getThreadBuffer();
+    trace_event *event, *bigger;
+
+    if (buffer == NULL)
+        return;
+    if (buffer->count == buffer->capacity) {
+        buffer->capacity = (buffer->capacity == 0) ? INITIAL_TRACE_EVENTS : buffer->capacity * 2;
+        bigger = realloc(buffer->events, buffer->capacity * sizeof(trace_event));
+        if (bigger == NULL) {
+            buffer->capacity = buffer->count;
+            return;
+        }
+        buffer->events = bigger;
+    }
+    event = &buffer->events[buffer->count++];
+    event->type = type;
+    event->name = name;
+    event->timestamp = monotonicSeconds() - traceStart;
+    event->argument[0] = '\0';
+    if (argument != NULL) {
+        strncpy(event->argument, argument, MAX_TRACE_ARGUMENT_LENGTH);
+        event->argument[MAX_TRACE_ARGUMENT_LENGTH] = '\0';
+    }
+}
+
+/**
+ * Writes a string as a JSON string literal.
+ * @param file The file to write to.
+ * @param str The string to write.
+ */
+static void writeJsonString (FILE *file, const char *str) {
+    fputc('"', file);
+    for (; *str != '\0'; str++) {
+        if (*str == '"' || *str == '\\')
+            fprintf(file, "\\%c", *str);
+        else if ((unsigned char) *str < 0x20)
+            fprintf(file, "\\u%04x", *str);
+        else
+            fputc(*str, file);
+    }
+    fputc('"', file);
+}
+
+/**
+ * Starts recording spans. Must be called before any thread records a span.
+ * @return TRUE if tracing started, FALSE otherwise.
+ */
+boolean startTrace (void) {
+    if (pthread_key_create(&bufferKey, NULL) != 0)
+        return FALSE;
+    traceStart = monotonicSeconds();
+    traceEnabled = TRUE;
+    return TRUE;
+}
+
+/**
+ * Opens a span on the track of the calling thread.
+ * @param name The name of the span (must stay valid until the trace is written).
+ * @param argument A file or macro name shown with the span, or NULL.
+ */
+void traceBegin (const char *name, const char *argument) {
+    recordEvent('B', name, argument);
+}
+
+/**
+ * Closes the innermost open span on the track of the calling thread.
+ * @param name The name of the span.
+ */
+void traceEnd (const char *name) {
+    recordEvent('E', name, NULL);
+}
+
+/**
+ * Names the track of the calling thread in the trace.
+ * @param name The name of the track (must stay valid until the trace is written).
+ */
+void traceNameThread (const char *name) {
+    trace_buffer *buffer;
+    if (traceEnabled == FALSE)
+        return;
+    buffer = getThreadBuffer();
+    if (buffer != NULL)
+        buffer->threadName = name;
+}
+
+/**
+ * Writes all the recorded spans of all the threads as Chrome trace-event JSON, and frees them.
+ * @param path The path of the JSON file.
+ * @return TRUE if the trace was written, FALSE otherwise.
+ */
+boolean writeTrace (const char *path) {
+    FILE *file;
+    trace_buffer *buffer, *next;
+    trace_event *event;
+    boolean first = TRUE;
+    int i;
+
+    traceEnabled = FALSE;
+    file = fopen(path, "w");
+    if (file == NULL) {
+        printErrorGeneral("Could not write trace ");
+        printMessage("'%s'.\n", path);
+    } else {
+        fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    }
+
+    pthread_mutex_lock(&buffersLock);
+    for (buffer = buffers; buffer != NULL; buffer = next) {
+        next = buffer->next;
+        if (file != NULL && buffer->threadName != NULL) {
+            fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":",
+                    first ? "" : ",\n", buffer->threadId);
+            writeJsonString(file, buffer->threadName);
+            fprintf(file, "}}");
+            first = FALSE;
+        }
+        for (i = 0; file != NULL && i < buffer->count; i++) {
+            event = &buffer->events[i];
+            fprintf(file, "%s{\"name\":", first ? "" : ",\n");
+            writeJsonString(file, event->name);
+            fprintf(file, ",\"cat\":\"assembler\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d",
+                    event->type, event->timestamp * 1e6, buffer->threadId);
+            if (event->argument[0] != '\0') {
+                fprintf(file, ",\"args\":{\"name\":");
+                writeJsonString(file, event->argument);
+                fprintf(file, "}");
+            }
+            fprintf(file, "}");
+            first = FALSE;
+        }
+        free(buffer->events);
+        free(buffer);
+    }
+    buffers = NULL;
+    pthread_mutex_unlock(&buffersLock);
+
+    if (file == NULL)
+        return FALSE;
+    fprintf(file, "\n]}\n");
+    return (fclose(file) == 0);
+}
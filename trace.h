@@ -0,0 +1,47 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "utils.h"
+
+#define MAX_TRACE_ARGUMENT_LENGTH 63
+
+/* TRUE when --trace was given */
+extern boolean traceEnabled;
+
+/* Records spans only when tracing is enabled, so that a disabled trace costs a single test */
+#define TRACE_BEGIN(name, argument) do { if (traceEnabled) traceBegin(name, argument); } while (0)
+#define TRACE_END(name) do { if (traceEnabled) traceEnd(name); } while (0)
+
+/**
+ * Starts recording spans. Must be called before any thread records a span.
+ * @return TRUE if tracing started, FALSE otherwise.
+ */
+boolean startTrace(void);
+
+/**
+ * Opens a span on the track of the calling thread.
+ * @param name The name of the span (must stay valid until the trace is written).
+ * @param argument A file or macro name shown with the span, or NULL.
+ */
+void traceBegin(const char *name, const char *argument);
+
+/**
+ * Closes the innermost open span on the track of the calling thread.
+ * @param name The name of the span.
+ */
+void traceEnd(const char *name);
+
+/**
+ * Names the track of the calling thread in the trace.
+ * @param name The name of the track (must stay valid until the trace is written).
+ */
+void traceNameThread(const char *name);
+
+/**
+ * Writes all the recorded spans of all the threads as Chrome trace-event JSON, and frees them.
+ * @param path The path of the JSON file.
+ * @return TRUE if the trace was written, FALSE otherwise.
+ */
+boolean writeTrace(const char *path);
+
+#endif /* TRACE_H */
@@ -0,0 +1,286 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+#include "watch.h"
+#include "preprocessor.h"
+#include "utils.h"
+#include "print.h"
+
+#define MAX_INCLUDE_DEPTH 16
+#define WATCH_EVENTS_SIZE 4096
+
+static volatile sig_atomic_t stopRequested = 0;
+
+/**
+ * Asks the watch loop to stop.
+ * @param signalNumber The signal received.
+ */
+static void requestStop (int signalNumber) {
+    stopRequested = 1;
+}
+
+/**
+ * Splits a path into its directory and its file name.
+ * @param path The path.
+ * @param directory Receives the directory, "." if the path has none (at least MAX_WATCH_PATH_LENGTH + 1 characters).
+ * @param name Receives a pointer to the file name inside the path.
+ */
+static void splitPath (const char *path, char *directory, const char **name) {
+    const char *slash = strrchr(path, '/');
+    if (slash == NULL) {
+        strcpy(directory, ".");
+        *name = path;
+    } else if (slash == path) {
+        strcpy(directory, "/");
+        *name = slash + 1;
+    } else {
+        memcpy(directory, path, slash - path);
+        directory[slash - path] = '\0';
+        *name = slash + 1;
+    }
+}
+
+/**
+ * Adds a path to the files a source depends on, unless it is already there.
+ * @param source The source file.
+ * @param path The path to add.
+ * @return TRUE if the path was added, FALSE if it was already there or there is no room.
+ */
+static boolean addDependency (watched_source *source, const char *path) {
+    int i;
+    if (strlen(path) > MAX_WATCH_PATH_LENGTH || source->pathCount == MAX_WATCH_DEPENDENCIES)
+        return FALSE;
+    for (i = 0; i < source->pathCount; i++)
+        if (strcmp(source->paths[i], path) == 0)
+            return FALSE;
+    strcpy(source->paths[source->pathCount++], path);
+    return TRUE;
+}
+
+/**
+ * Adds the files included by a file to the files a source depends on, and those of the files they include.
+ * A file that cannot be read is still watched, so that creating it is noticed.
+ * @param source The source file.
+ * @param path The file to read.
+ * @param depth How deep the file is included, to stop at include cycles.
+ */
+static void addIncludes (watched_source *source, const char *path, int depth) {
+    char line[MAX_LINE_LENGTH+1], name[MAX_LINE_LENGTH+1], included[MAX_INCLUDE_PATH_LENGTH+1];
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL || depth == MAX_INCLUDE_DEPTH) {
+        if (file != NULL)
+            fclose(file);
+        return;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        /* an included file is relative to the directory of the file that includes it */
+        if (parseInclude(line, name) == TRUE && name[0] != '\0' && resolveIncludePath(path, name, included) == TRUE &&
+            addDependency(source, included) == TRUE)
+            addIncludes(source, included, depth + 1);
+    }
+    fclose(file);
+}
+
+#ifdef __linux__
+/**
+ * Watches the directory of a file, unless it is already watched. Directories are watched rather than
+ * files, so that editors that save by writing a new file and renaming it over the old one are noticed.
+ * @param watch The watch.
+ * @param path The path of the file.
+ */
+static void watchDirectory (watch_t *watch, const char *path) {
+    char directory[MAX_WATCH_PATH_LENGTH+1];
+    const char *name;
+    int i, descriptor;
+
+    splitPath(path, directory, &name);
+    for (i = 0; i < watch->directoryCount; i++)
+        if (strcmp(watch->directories[i].path, directory) == 0)
+            return;
+    if (watch->directoryCount == MAX_WATCH_DIRECTORIES) {
+        printWarningGeneral("Too many directories to watch, not watching ");
+        printMessage("'%s'.\n", directory);
+        return;
+    }
+    descriptor = inotify_add_watch(watch->fd, directory, IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE);
+    if (descriptor < 0) {
+        printWarningGeneral("Could not watch directory ");
+        printMessage("'%s'.\n", directory);
+        return;
+    }
+    watch->directories[watch->directoryCount].descriptor = descriptor;
+    strcpy(watch->directories[watch->directoryCount].path, directory);
+    watch->directoryCount++;
+}
+
+/**
+ * Marks the source files that depend on a file that changed.
+ * @param watch The watch.
+ * @param directory The directory of the file.
+ * @param fileName The name of the file in the directory.
+ * @param changed The changed marks of the source files.
+ * @return The number of source files that were newly marked.
+ */
+static int markChanged (watch_t *watch, const char *directory, const char *fileName, boolean changed[]) {
+    char pathDirectory[MAX_WATCH_PATH_LENGTH+1];
+    const char *name;
+    int i, j, marked = 0;
+
+    for (i = 0; i < watch->count; i++) {
+        for (j = 0; j < watch->sources[i].pathCount; j++) {
+            splitPath(watch->sources[i].paths[j], pathDirectory, &name);
+            if (strcmp(pathDirectory, directory) != 0 || strcmp(name, fileName) != 0)
+                continue;
+            if (j > 0) /* an included file is read again on its next use */
+                forgetIncludedFile(watch->sources[i].paths[j]);
+            if (changed[i] == FALSE) {
+                changed[i] = TRUE;
+                marked++;
+            }
+        }
+    }
+    return marked;
+}
+#endif
+
+/**
+ * Reads the files a source includes again, after it was assembled, and watches their directories.
+ * @param watch The watch.
+ * @param index The index of the source file.
+ */
+void refreshWatch (watch_t *watch, int index) {
+    watched_source *source = &watch->sources[index];
+    char path[MAX_WATCH_PATH_LENGTH+1];
+
+    source->pathCount = 0;
+    if (strlen(source->name) + strlen(".as") > MAX_WATCH_PATH_LENGTH)
+        return;
+    sprintf(path, "%s.as", source->name);
+    addDependency(source, path);
+    addIncludes(source, path, 0);
+#ifdef __linux__
+    {
+        int i;
+        for (i = 0; i < source->pathCount; i++)
+            watchDirectory(watch, source->paths[i]);
+    }
+#endif
+}
+
+/**
+ * Starts watching source files and the files they include. Only supported on Linux.
+ * Ctrl-C (or SIGTERM) makes waitForChanges return instead of ending the program.
+ * @param watch The watch to start.
+ * @param names The base names of the source files (without the '.as' extension), which must stay valid.
+ * @param count The number of source files.
+ * @return TRUE if watching started, FALSE otherwise.
+ */
+boolean initWatch (watch_t *watch, char *names[], int count) {
+#ifdef __linux__
+    struct sigaction action;
+    int i;
+
+    watch->count = count;
+    watch->directoryCount = 0;
+    watch->fd = inotify_init();
+    watch->sources = calloc(count, sizeof(watched_source));
+    if (watch->fd < 0 || watch->sources == NULL) {
+        printErrorGeneral("Could not start watching the files\n");
+        if (watch->fd >= 0)
+            close(watch->fd);
+        free(watch->sources);
+        return FALSE;
+    }
+    for (i = 0; i < count; i++) {
+        watch->sources[i].name = names[i];
+        refreshWatch(watch, i);
+    }
+
+    /* without SA_RESTART, a signal wakes up the poll so the caller can finish its reports */
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = requestStop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    return TRUE;
+#else
+    printErrorGeneral("'--watch' is only supported on Linux\n");
+    return FALSE;
+#endif
+}
+
+/**
+ * Waits until at least one watched source file or a file it includes changes, and then until no more
+ * changes come for WATCH_DEBOUNCE_MS. A changed included file is dropped from the included files of the run.
+ * @param watch The watch.
+ * @param changed Receives TRUE for every source file that changed (room for the number of source files).
+ * @return The number of source files that changed, or -1 when stopped by a signal or an error.
+ */
+int waitForChanges (watch_t *watch, boolean changed[]) {
+#ifdef __linux__
+    union {
+        struct inotify_event event; /* aligns the buffer for the events */
+        char bytes[WATCH_EVENTS_SIZE];
+    } buffer;
+    struct inotify_event *event;
+    struct pollfd poller;
+    ssize_t length, offset;
+    int i, ready, found = 0;
+
+    for (i = 0; i < watch->count; i++)
+        changed[i] = FALSE;
+    poller.fd = watch->fd;
+    poller.events = POLLIN;
+    while (stopRequested == 0) {
+        /* after the first change, wait only until the saves stop coming */
+        ready = poll(&poller, 1, (found > 0) ? WATCH_DEBOUNCE_MS : -1);
+        if (ready < 0 && errno == EINTR)
+            continue;
+        if (ready < 0)
+            return -1;
+        if (ready == 0)
+            return found;
+
+        length = read(watch->fd, buffer.bytes, sizeof(buffer.bytes));
+        if (length <= 0)
+            return -1;
+        for (offset = 0; offset < length; offset += sizeof(struct inotify_event) + event->len) {
+            event = (struct inotify_event *) (buffer.bytes + offset);
+            if (event->len == 0)
+                continue;
+            for (i = 0; i < watch->directoryCount; i++) {
+                if (watch->directories[i].descriptor == event->wd) {
+                    found += markChanged(watch, watch->directories[i].path, event->name, changed);
+                    break;
+                }
+            }
+        }
+    }
+#endif
+    return -1;
+}
+
+/**
+ * Stops watching and frees the watch.
+ * @param watch The watch.
+ */
+void closeWatch (watch_t *watch) {
+#ifdef __linux__
+    close(watch->fd);
+#endif
+    free(watch->sources);
+    watch->sources = NULL;
+    watch->count = 0;
+}
@@ -0,0 +1,65 @@
+#ifndef WATCH_H
+#define WATCH_H
+
+#include "utils.h"
+
+#define MAX_WATCH_PATH_LENGTH 255
+#define MAX_WATCH_DEPENDENCIES 64
+#define MAX_WATCH_DIRECTORIES 64
+#define WATCH_DEBOUNCE_MS 5
+
+/* A source file given in the command line and the files it depends on */
+typedef struct watched_source {
+    char *name; /* the base name of the file (without the '.as' extension) */
+    char paths[MAX_WATCH_DEPENDENCIES][MAX_WATCH_PATH_LENGTH+1]; /* the '.as' file first, then the files it includes */
+    int pathCount;
+} watched_source;
+
+/* A directory that holds at least one watched file */
+typedef struct watched_directory {
+    int descriptor; /* the inotify watch descriptor */
+    char path[MAX_WATCH_PATH_LENGTH+1];
+} watched_directory;
+
+/* The source files being watched */
+typedef struct watch_t {
+    int fd; /* the inotify instance */
+    watched_source *sources;
+    int count;
+    watched_directory directories[MAX_WATCH_DIRECTORIES];
+    int directoryCount;
+} watch_t;
+
+/**
+ * Starts watching source files and the files they include. Only supported on Linux.
+ * Ctrl-C (or SIGTERM) makes waitForChanges return instead of ending the program.
+ * @param watch The watch to start.
+ * @param names The base names of the source files (without the '.as' extension), which must stay valid.
+ * @param count The number of source files.
+ * @return TRUE if watching started, FALSE otherwise.
+ */
+boolean initWatch(watch_t *watch, char *names[], int count);
+
+/**
+ * Reads the files a source includes again, after it was assembled, and watches their directories.
+ * @param watch The watch.
+ * @param index The index of the source file.
+ */
+void refreshWatch(watch_t *watch, int index);
+
+/**
+ * Waits until at least one watched source file or a file it includes changes, and then until no more
+ * changes come for WATCH_DEBOUNCE_MS. A changed included file is dropped from the included files of the run.
+ * @param watch The watch.
+ * @param changed Receives TRUE for every source file that changed (room for the number of source files).
+ * @return The number of source files that changed, or -1 when stopped by a signal or an error.
+ */
+int waitForChanges(watch_t *watch, boolean changed[]);
+
+/**
+ * Stops watching and frees the watch.
+ * @param watch The watch.
+ */
+void closeWatch(watch_t *watch);
+
+#endif /* WATCH_H */